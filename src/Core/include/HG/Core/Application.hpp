@@ -1,6 +1,7 @@
 #pragma once
 
 // C++ STL
+#include <chrono>
 #include <string>
 
 namespace HG::Physics::Base
@@ -14,6 +15,11 @@ class SystemController;
 class Renderer;
 } // namespace HG::Rendering::Base
 
+namespace HG::Utils
+{
+class ContinuationQueue;
+}
+
 namespace HG::Core
 {
 class Scene;
@@ -24,6 +30,9 @@ class CountStatistics;
 class ThreadPool;
 class Benchmark;
 class ResourceCache;
+class FrameGraph;
+class MainThreadDispatcher;
+class SceneStreamer;
 
 /**
  * @brief Class, that describes
@@ -49,7 +58,8 @@ public:
     /**
      * @brief Method for setting current scene.
      * Actual scene change will happen at next
-     * frame begin.
+     * frame begin. Pending scene loading of
+     * scene streamer is cancelled.
      * @param scene Pointer to scene object.
      * `nullptr` will throw `std::invalid_argument`
      * exception.
@@ -81,6 +91,9 @@ public:
 
     /**
      * @brief Method for performing one game cycle.
+     * Cycle stages (physics tick, scene processing, events
+     * polling, scene update and rendering) are executed
+     * as frame graph tasks.
      * @return Cycle success.
      */
     virtual bool performCycle();
@@ -140,6 +153,45 @@ public:
      */
     [[nodiscard]] HG::Core::ResourceCache* resourceCache() const;
 
+    /**
+     * @brief Method for getting application frame graph.
+     * User systems can be added to it, to be executed
+     * every frame concurrently with independent stages.
+     * @return Pointer to application frame graph.
+     */
+    [[nodiscard]] HG::Core::FrameGraph* frameGraph() const;
+
+    /**
+     * @brief Method for getting queue of continuations,
+     * that are executed in main thread once per frame,
+     * before updating scene.
+     *
+     * Sample usage:
+     * ```cpp
+     * resourceManager()->load<HG::Utils::STBImageLoader>("image.png")
+     *     .then([this](HG::Utils::SurfacePtr surface) { onLoaded(surface); }, mainThreadQueue());
+     * ```
+     * @return Pointer to main thread queue.
+     */
+    [[nodiscard]] HG::Utils::ContinuationQueue* mainThreadQueue() const;
+
+    /**
+     * @brief Method for getting dispatcher of main thread jobs,
+     * like uploading data to GPU. Jobs are executed once per
+     * frame until dispatcher time budget is spent.
+     * @return Pointer to main thread dispatcher.
+     */
+    [[nodiscard]] HG::Core::MainThreadDispatcher* mainThreadDispatcher() const;
+
+    /**
+     * @brief Method for getting scene streamer, that
+     * prepares scenes and sub-scenes in background.
+     * Prepared scene replaces current one at frame begin,
+     * when all it's staged main thread jobs are executed.
+     * @return Pointer to scene streamer.
+     */
+    [[nodiscard]] HG::Core::SceneStreamer* sceneStreamer() const;
+
     /**
      * @brief Method for receiving pointer to
      * input controller/receiver. If you are
@@ -189,6 +241,12 @@ protected:
     virtual void proceedScene();
 
 private:
+    /**
+     * @brief Method for adding engine stages
+     * to frame graph.
+     */
+    void setupFrameGraph();
+
     // Title for created window
     std::string m_applicationTitle;
 
@@ -222,6 +280,21 @@ private:
     // Cache for objects
     HG::Core::ResourceCache* m_resourceCache;
 
+    // Frame stages
+    HG::Core::FrameGraph* m_frameGraph;
+
+    // Continuations for main thread
+    HG::Utils::ContinuationQueue* m_mainThreadQueue;
+
+    // Budgeted main thread jobs
+    HG::Core::MainThreadDispatcher* m_mainThreadDispatcher;
+
+    // Background scenes and sub-scenes loading
+    HG::Core::SceneStreamer* m_sceneStreamer;
+
+    // Current frame delta time
+    std::chrono::microseconds m_deltaTime;
+
     // Scene has to be changed only at new frame.
     // Using caching new scene, until new frame will begin.
     HG::Core::Scene* m_currentScene;
@@ -0,0 +1,236 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+
+namespace HG::Core
+{
+/**
+ * @brief Trait, that checks is loader result
+ * can be cached. Only shared pointers to non
+ * const objects are cached.
+ */
+template <typename T>
+struct IsCachableAsset : std::false_type
+{
+};
+
+template <typename T>
+struct IsCachableAsset<std::shared_ptr<T>> : std::bool_constant<!std::is_const_v<T>>
+{
+};
+
+/**
+ * @brief Class, that describes cache of loaded assets,
+ * that's used by HG::Core::ResourceManager. Assets are
+ * identified by resource id and loader type. While asset
+ * is used by somebody - cache keeps only weak reference
+ * to it, so same asset is returned on every request.
+ * Released assets are kept in LRU list until total size
+ * of them exceeds budget. Size of asset is size of it's
+ * raw data.
+ *
+ * Cache itself is type erased, typed access is
+ * implemented in HG::Core::ResourceManager::load.
+ */
+class AssetCache
+{
+public:
+    /**
+     * @brief Asset identifier.
+     */
+    struct Key
+    {
+        std::string id;
+        std::type_index loader;
+
+        bool operator==(const Key& rhs) const
+        {
+            return loader == rhs.loader && id == rhs.id;
+        }
+    };
+
+    /**
+     * @brief Result of asset lookup.
+     */
+    enum class LookupResult
+    {
+        Found,   ///< Asset is alive or retained
+        Pending, ///< Asset is loading now
+        Missing  ///< Asset has to be loaded by caller
+    };
+
+    /**
+     * @brief Constructor.
+     * @param budget Maximum size of retained assets in bytes.
+     */
+    explicit AssetCache(std::size_t budget = 64 * 1024 * 1024);
+
+    /**
+     * @brief Destructor. Assets, that are still used,
+     * are not affected.
+     */
+    ~AssetCache();
+
+    // Disable copying
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    /**
+     * @brief Method for searching asset. If asset is missing -
+     * `pending` object is registered as loading asset and
+     * caller has to call `complete` after loading.
+     * @param key Asset key.
+     * @param object Asset if it was found, or pending object
+     * of loading asset.
+     * @param pending Object, that will be returned to
+     * requests of same asset, until it's loaded.
+     * @param owner Object, that's alive while asset is loading.
+     * If it's destroyed without `complete` call - asset
+     * is considered missing.
+     * @return Lookup result.
+     */
+    LookupResult lookup(const Key& key,
+                        std::shared_ptr<void>& object,
+                        std::shared_ptr<void> pending,
+                        std::weak_ptr<void> owner);
+
+    /**
+     * @brief Method for finishing asset loading.
+     * @param key Asset key.
+     * @param asset Loaded asset or nullptr, if
+     * asset can't be loaded.
+     * @param size Size of asset in bytes.
+     * @return Asset, that has to be passed to users
+     * instead of loaded one.
+     */
+    std::shared_ptr<void> complete(const Key& key, std::shared_ptr<void> asset, std::size_t size);
+
+    /**
+     * @brief Method for dropping all retained assets.
+     */
+    void clear();
+
+    /**
+     * @brief Method for setting maximum size of
+     * retained assets. Exceeding assets are
+     * dropped immediately.
+     * @param budget Size in bytes.
+     */
+    void setBudget(std::size_t budget);
+
+    /**
+     * @brief Method for getting maximum size of
+     * retained assets.
+     * @return Size in bytes.
+     */
+    [[nodiscard]] std::size_t budget() const;
+
+    /**
+     * @brief Method for getting size of retained assets.
+     * @return Size in bytes.
+     */
+    [[nodiscard]] std::size_t retainedSize() const;
+
+    /**
+     * @brief Method for getting number of requests,
+     * that were satisfied with alive or retained assets.
+     */
+    [[nodiscard]] std::size_t numberOfHits() const;
+
+    /**
+     * @brief Method for getting number of requests,
+     * that were joined to loading of same asset.
+     */
+    [[nodiscard]] std::size_t numberOfCoalesced() const;
+
+    /**
+     * @brief Method for getting number of requests,
+     * that required loading.
+     */
+    [[nodiscard]] std::size_t numberOfMisses() const;
+
+    /**
+     * @brief Method for getting number of retained assets,
+     * that were dropped because of budget or clearing.
+     */
+    [[nodiscard]] std::size_t numberOfEvictions() const;
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            return std::hash<std::string>()(key.id) ^ (key.loader.hash_code() << 1u);
+        }
+    };
+
+    struct Entry
+    {
+        // Loading state
+        std::shared_ptr<void> pending;
+        std::weak_ptr<void> owner;
+
+        // Asset, that's passed to users
+        std::weak_ptr<void> alive;
+
+        // Released asset in LRU list
+        std::shared_ptr<void> retained;
+        std::list<Key>::iterator position;
+
+        std::size_t size = 0;
+    };
+
+    struct State
+    {
+        std::mutex mutex;
+        std::unordered_map<Key, Entry, KeyHash> entries;
+
+        // Most recently released first
+        std::list<Key> released;
+
+        std::size_t budget       = 0;
+        std::size_t retainedSize = 0;
+
+        std::size_t hits      = 0;
+        std::size_t coalesced = 0;
+        std::size_t misses    = 0;
+        std::size_t evictions = 0;
+    };
+
+    /**
+     * @brief Method for wrapping asset into pointer, that
+     * returns asset into cache, when last user releases it.
+     */
+    static std::shared_ptr<void> share(const std::shared_ptr<State>& state,
+                                       const Key& key,
+                                       std::shared_ptr<void> asset);
+
+    /**
+     * @brief Method for placing released asset into LRU list.
+     */
+    static void release(const std::weak_ptr<State>& weakState, const Key& key, std::shared_ptr<void> asset);
+
+    /**
+     * @brief Method for dropping least recently released
+     * assets, until retained size fits budget. Has to be
+     * called under mutex.
+     * @param state State.
+     * @param budget Required retained size.
+     * @param dropped Dropped assets. They have to be
+     * destroyed without lock.
+     */
+    static void evict(State& state, std::size_t budget, std::list<std::shared_ptr<void>>& dropped);
+
+    // State is shared with assets, that are
+    // used outside of cache.
+    std::shared_ptr<State> m_state;
+};
+} // namespace HG::Core
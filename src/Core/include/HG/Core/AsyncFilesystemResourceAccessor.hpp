@@ -0,0 +1,100 @@
+#pragma once
+
+// C++ STL
+#include <memory>
+#include <string>
+
+// HG::Core
+#include <HG/Core/FilesystemResourceAccessor.hpp> // Required for inheritance
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes filesystem resource
+ * accessor, that keeps many reads in flight at once.
+ * On Linux reads are submitted to io_uring, if it's
+ * available. Otherwise reads are executed by own
+ * threads with blocking `FilesystemResourceAccessor::loadRaw`.
+ * If io_uring read can't be submitted, it's finished
+ * with nullptr data. File size is
+ * requested before reading, so data is read
+ * into pre sized buffer.
+ *
+ * Sample usage:
+ * ```cpp
+ * auto accessor = new HG::Core::AsyncFilesystemResourceAccessor();
+ *
+ * accessor->loadRawAsync("texture.png").then([](HG::Core::DataPtr data) { ... });
+ * ```
+ */
+class AsyncFilesystemResourceAccessor : public HG::Core::FilesystemResourceAccessor
+{
+public:
+    /**
+     * @brief Implementation, that's used for reading.
+     */
+    enum class Backend
+    {
+        IoUring,
+        Threads
+    };
+
+    /**
+     * @brief Constructor.
+     * @param queueDepth Maximum number of reads in flight.
+     * Other reads are waiting for free slot.
+     * @param numberOfThreads Number of reading threads, if
+     * io_uring is not available.
+     * @param backend Preferred backend. If io_uring is not
+     * available - threads will be used.
+     */
+    explicit AsyncFilesystemResourceAccessor(std::size_t queueDepth      = 64,
+                                             std::size_t numberOfThreads = 4,
+                                             Backend backend             = Backend::IoUring);
+
+    /**
+     * @brief Destructor. Waits for all reads in flight.
+     */
+    ~AsyncFilesystemResourceAccessor() override;
+
+    // Disable copying
+    AsyncFilesystemResourceAccessor(const AsyncFilesystemResourceAccessor&) = delete;
+    AsyncFilesystemResourceAccessor& operator=(const AsyncFilesystemResourceAccessor&) = delete;
+
+    /**
+     * @brief Method for loading raw data. Blocks calling
+     * thread until read is completed.
+     * @param id Path to file.
+     * @return Loaded data or nullptr if file can't be read.
+     */
+    HG::Core::DataPtr loadRaw(const std::string& id) override;
+
+    /**
+     * @brief Method for loading raw data without blocking.
+     * @param id Path to file.
+     * @return Handler for loaded data. Data is nullptr if
+     * file can't be read.
+     */
+    HG::Utils::FutureHandler<HG::Core::DataPtr> loadRawAsync(const std::string& id) override;
+
+    /**
+     * @brief Method for getting used backend.
+     */
+    [[nodiscard]] Backend backend() const;
+
+    /**
+     * @brief Method for getting maximum number
+     * of reads in flight.
+     */
+    [[nodiscard]] std::size_t queueDepth() const;
+
+private:
+    class Implementation;
+    class UringImplementation;
+    class ThreadsImplementation;
+
+    std::unique_ptr<Implementation> m_implementation;
+    Backend m_backend;
+    std::size_t m_queueDepth;
+};
+} // namespace HG::Core
@@ -2,18 +2,30 @@
 
 // Declarations for simple behaviour coding
 // C++ STL
-#include <any>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
-#define HG_PROPERTY_INITIALIZER_RAW_OBJ(BEHAVIOUR, METHOD_OWNER, NAME, TYPE, SETTER, GETTER)                           \
-    HG::Core::PropertyInitializer<TYPE> __##NAME##Init = HG::Core::PropertyInitializer<TYPE>(                          \
-        BEHAVIOUR,                                                                                                     \
-        #NAME,                                                                                                         \
-        #TYPE,                                                                                                         \
-        std::bind(&std::remove_reference<decltype(*METHOD_OWNER)>::type::SETTER, METHOD_OWNER, std::placeholders::_1), \
-        std::bind(&std::remove_reference<decltype(*METHOD_OWNER)>::type::GETTER, METHOD_OWNER))
+// HG::Core
+#include <HG/Core/Handle.hpp>
+#include <HG/Core/PropertyTable.hpp>
+
+#define HG_PROPERTY_INITIALIZER_RAW_OBJ(BEHAVIOUR, METHOD_OWNER, NAME, TYPE, SETTER, GETTER)                \
+    HG::Core::PropertyInitializer __##NAME##Init = HG::Core::PropertyInitializer(                           \
+        BEHAVIOUR,                                                                                          \
+        METHOD_OWNER,                                                                                       \
+        #NAME,                                                                                              \
+        #TYPE,                                                                                              \
+        HG::Core::PropertyAccessor<std::remove_reference<decltype(*METHOD_OWNER)>::type,                    \
+                                   TYPE,                                                                    \
+                                   &std::remove_reference<decltype(*METHOD_OWNER)>::type::SETTER,           \
+                                   &std::remove_reference<decltype(*METHOD_OWNER)>::type::GETTER>())
 
 #define HG_PROPERTY_INITIALIZER_RAW(NAME, TYPE, SETTER, GETTER) \
     HG_PROPERTY_INITIALIZER_RAW_OBJ(this, this, NAME, TYPE, SETTER, GETTER)
@@ -66,53 +78,102 @@ class Scene;
 class Behaviour
 {
 public:
-    // Property system
-    // todo: Low std::any overhead with another api
-    struct Property
+    /**
+     * @brief Class, that describes property of
+     * behaviour instance. It's a light view to
+     * static property description, so it can be
+     * copied and stored freely while behaviour exists.
+     */
+    class Property
     {
-        Property(std::string name, std::string type, std::any setter, std::any getter, const std::type_info& typeInfo) :
-            m_name(std::move(name)),
-            m_type(std::move(type)),
-            m_setter(std::move(setter)),
-            m_getter(std::move(getter)),
-            m_typeInfo(typeInfo)
+    public:
+        /**
+         * @brief Constructor.
+         * @param entry Property description.
+         * @param behaviour Behaviour.
+         */
+        Property(const HG::Core::PropertyTable::Entry* entry, HG::Core::Behaviour* behaviour) :
+            m_entry(entry),
+            m_behaviour(behaviour)
         {
         }
 
         [[nodiscard]] const std::string& name() const
         {
-            return m_name;
+            return m_entry->name;
         }
 
         [[nodiscard]] const std::string& type() const
         {
-            return m_type;
+            return m_entry->type;
         }
 
         [[nodiscard]] const std::type_info& typeInfo() const
         {
-            return m_typeInfo;
+            return *m_entry->typeInfo;
+        }
+
+        /**
+         * @brief Method for getting property value.
+         * Can throw `std::invalid_argument` if type
+         * does not match property type.
+         * @tparam Type Property type.
+         */
+        template <typename Type>
+        [[nodiscard]] Type get() const
+        {
+            checkType(typeid(Type));
+
+            Type value;
+
+            m_entry->getter(m_behaviour, m_entry->offset, &value);
+
+            return value;
+        }
+
+        /**
+         * @brief Method for setting property value.
+         * Can throw `std::invalid_argument` if type
+         * does not match property type.
+         * @tparam Type Property type.
+         * @param value Value.
+         */
+        template <typename Type>
+        void set(const Type& value) const
+        {
+            checkType(typeid(Type));
+
+            m_entry->setter(m_behaviour, m_entry->offset, &value);
         }
 
         template <typename Type>
         [[nodiscard]] std::function<Type()> getGetter() const
         {
-            return std::any_cast<std::function<Type()>>(m_getter);
+            checkType(typeid(Type));
+
+            return [property = *this]() { return property.get<Type>(); };
         }
 
         template <typename Type>
         [[nodiscard]] std::function<void(Type)> getSetter() const
         {
-            return std::any_cast<std::function<void(Type)>>(m_setter);
-        }
+            checkType(typeid(Type));
 
-        std::string m_name;
-        std::string m_type;
+            return [property = *this](Type value) { property.set<Type>(value); };
+        }
 
-        std::any m_setter;
-        std::any m_getter;
+    private:
+        void checkType(const std::type_info& typeInfo) const
+        {
+            if (*m_entry->typeInfo != typeInfo)
+            {
+                throw std::invalid_argument("Property \"" + m_entry->name + "\" has type \"" + m_entry->type +
+                                            "\"");
+            }
+        }
 
-        const std::type_info& m_typeInfo;
+        const HG::Core::PropertyTable::Entry* m_entry;
+        HG::Core::Behaviour* m_behaviour;
     };
 
     enum class Type
@@ -121,6 +182,26 @@ public:
         Render
     };
 
+    /**
+     * @brief Way, how behaviour is updated by scene.
+     * Serial behaviours are updated one after another in
+     * gameobjects order. Concurrent behaviours are updated
+     * after serial ones on thread pool user threads. Concurrent
+     * behaviour must not touch other behaviours or gameobjects
+     * state in `onUpdate`. Adding or removing gameobjects and
+     * behaviours is allowed, it will be applied after all
+     * concurrent behaviours are updated. Global transform
+     * values can be read (see HG::Core::Transform). System behaviours
+     * are not updated by gameobject, they are updated by
+     * scene system of their type. (See HG::Core::ComponentBehaviour)
+     */
+    enum class UpdateMode
+    {
+        Serial,
+        Concurrent,
+        System
+    };
+
     /**
      * @brief Constructor.
      */
@@ -150,6 +231,12 @@ public:
      */
     void setEnabled(bool value);
 
+    /**
+     * @brief Method for getting behaviour update mode.
+     * @return Update mode.
+     */
+    [[nodiscard]] UpdateMode updateMode() const;
+
     /**
      * @brief Public method for calling
      * overridden update methods.
@@ -162,6 +249,12 @@ public:
      */
     void start();
 
+    /**
+     * @brief Method for checking was behaviour
+     * started.
+     */
+    [[nodiscard]] bool isStarted() const;
+
     /**
      * @brief Method for getting gameobject.
      * @return Pointer to parent gameobject.
@@ -174,6 +267,16 @@ public:
      */
     [[nodiscard]] HG::Core::Scene* scene() const;
 
+    /**
+     * @brief Method for getting handle of behaviour.
+     * Handle is issued, when behaviour is attached to
+     * gameobject in scene, and is resolved with
+     * HG::Core::Scene::behaviour until behaviour is
+     * removed from gameobject or scene.
+     * @return Handle or null handle.
+     */
+    [[nodiscard]] HG::Core::Handle<HG::Core::Behaviour> handle() const;
+
     /**
      * @brief Method for getting input controller
      * from application;
@@ -181,57 +284,43 @@ public:
      */
     [[nodiscard]] const Input* input() const;
 
-    /**
-     * @brief Method for adding property to behaviour.
-     * @param name Property name.
-     * @param property Property object.
-     */
-    void addProperty(Property property);
-
     /**
      * @brief Method for setting property value.
+     * Can throw `std::invalid_argument` if property
+     * does not exist or has another type.
      * @tparam ArgumentType Argument type.
      * @param name Property name.
      * @param value Value.
-     * @return Setting result.
      */
     template <typename ArgumentType>
-    void setProperty(const std::string& name, ArgumentType value)
+    void setProperty(std::string_view name, const ArgumentType& value)
     {
-        auto propertyIter =
-            std::find_if(m_properties.begin(),
-                         m_properties.end(),
-                         [&name](const std::pair<std::string, Property>& pair) { return pair.first == name; });
-
-        if (propertyIter == m_properties.end())
-        {
-            throw std::invalid_argument("Unknown property \"" + name + "\"");
-        }
-
-        propertyIter->second.template getSetter<ArgumentType>()(value);
+        Property(findProperty(name), this).set<ArgumentType>(value);
     }
 
     /**
      * @brief Method for getting property value.
+     * Can throw `std::invalid_argument` if property
+     * does not exist or has another type.
      * @tparam Type Argument type.
      * @param name Property name.
      */
     template <typename Type>
-    [[nodiscard]] Type getProperty(const std::string& name) const
+    [[nodiscard]] Type getProperty(std::string_view name) const
     {
-        auto propertyIter =
-            std::find_if(m_properties.begin(),
-                         m_properties.end(),
-                         [&name](const std::pair<std::string, Property>& pair) { return pair.first == name; });
-
-        if (propertyIter == m_properties.end())
-        {
-            throw std::invalid_argument("Unknown property \"" + name + "\"");
-        }
-
-        return propertyIter->second.template getGetter<Type>()();
+        return Property(findProperty(name), const_cast<Behaviour*>(this)).get<Type>();
     }
 
+    /**
+     * @brief Method for getting table of properties,
+     * declared by most derived type with properties.
+     * Tables of base types are available through
+     * HG::Core::PropertyTable::parent.
+     * @return Pointer to table or nullptr if behaviour
+     * has no properties.
+     */
+    [[nodiscard]] const HG::Core::PropertyTable* propertyTable() const;
+
     /**
      * @brief Method for getting all properties.
      * @return Vector with all properties.
@@ -240,6 +329,7 @@ public:
 
     /**
      * @brief Method for getting all properties.
+     * Properties of base types go first.
      * @param container Vector, that will be filled with properties.
      */
     void getProperties(std::vector<Property>& container) const;
@@ -264,7 +354,17 @@ protected:
      */
     virtual void onFixedUpdate();
 
+    /**
+     * @brief Method for setting behaviour update mode.
+     * Behaviour has to set `UpdateMode::Concurrent` only
+     * if it's `onUpdate` is safe for concurrent execution.
+     * @param mode Update mode.
+     */
+    void setUpdateMode(UpdateMode mode);
+
     friend class GameObject;
+    friend class Scene;
+    friend class PropertyInitializer;
 
     /**
      * @brief Method for setting parent gameobject.
@@ -273,27 +373,99 @@ protected:
     void setParentGameObject(HG::Core::GameObject* ptr);
 
 private:
+    /**
+     * @brief Method for searching for property description.
+     * Can throw `std::invalid_argument` if property
+     * does not exist.
+     */
+    [[nodiscard]] const HG::Core::PropertyTable::Entry* findProperty(std::string_view name) const;
+
+    /**
+     * @brief Method for collecting properties
+     * of table and it's parents.
+     */
+    void collectProperties(const HG::Core::PropertyTable* table, std::vector<Property>& container) const;
+
     Type m_type;
 
     bool m_enabled;
 
+    UpdateMode m_updateMode;
+
+    bool m_started;
+
     HG::Core::GameObject* m_parent;
 
-    std::vector<std::pair<std::string, Property>> m_properties;
+    HG::Core::Handle<HG::Core::Behaviour> m_handle;
+
+    const HG::Core::PropertyTable* m_propertyTable;
 };
 
-template <typename T>
+/**
+ * @brief Class, that provides typed access to property
+ * through setter and getter of object.
+ * @tparam Object Type of object, that owns setter and getter.
+ * @tparam Type Property type.
+ * @tparam Setter Setter method.
+ * @tparam Getter Getter method.
+ */
+template <typename Object, typename Type, auto Setter, auto Getter>
+struct PropertyAccessor
+{
+    static void set(HG::Core::Behaviour* behaviour, std::ptrdiff_t offset, const void* value)
+    {
+        auto object = reinterpret_cast<Object*>(reinterpret_cast<std::uint8_t*>(behaviour) + offset);
+
+        (object->*Setter)(*static_cast<const Type*>(value));
+    }
+
+    static void get(const HG::Core::Behaviour* behaviour, std::ptrdiff_t offset, void* value)
+    {
+        auto object = reinterpret_cast<const Object*>(reinterpret_cast<const std::uint8_t*>(behaviour) + offset);
+
+        *static_cast<Type*>(value) = (object->*Getter)();
+    }
+};
+
+/**
+ * @brief Class, that registers property in static
+ * table of behaviour type on first construction and
+ * binds behaviour to this table. It's created by
+ * `HG_PROPERTY` macros.
+ */
 class PropertyInitializer
 {
 public:
-    PropertyInitializer(HG::Core::Behaviour* b,
-                        std::string valName,
-                        std::string typeName,
-                        std::function<void(T)> setter,
-                        std::function<T()> getter)
+    template <typename BehaviourType, typename Object, typename Type, auto Setter, auto Getter>
+    PropertyInitializer(BehaviourType* behaviour,
+                        Object* object,
+                        const char* name,
+                        const char* typeName,
+                        PropertyAccessor<Object, Type, Setter, Getter>)
     {
-        b->addProperty(HG::Core::Behaviour::Property(
-            std::move(valName), std::move(typeName), std::move(setter), std::move(getter), typeid(T)));
+        using Accessor = PropertyAccessor<Object, Type, Setter, Getter>;
+
+        auto base   = static_cast<HG::Core::Behaviour*>(behaviour);
+        auto& table = HG::Core::PropertyTable::of<BehaviourType>();
+
+        // One flag for every declared property
+        static std::once_flag registered;
+
+        std::call_once(registered, [&]() {
+            auto offset = reinterpret_cast<std::uint8_t*>(object) - reinterpret_cast<std::uint8_t*>(base);
+
+            table.add({name,
+                       typeName,
+                       &typeid(Type),
+                       offset,
+                       &Accessor::set,
+                       &Accessor::get,
+                       sizeof(Type),
+                       std::is_trivially_copyable<Type>::value && !std::is_pointer<Type>::value},
+                      base->m_propertyTable);
+        });
+
+        base->m_propertyTable = &table;
     }
 };
 } // namespace HG::Core
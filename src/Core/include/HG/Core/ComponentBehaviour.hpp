@@ -0,0 +1,106 @@
+#pragma once
+
+// C++ STL
+#include <stdexcept>
+#include <type_traits>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/ComponentStorage.hpp>
+#include <HG/Core/Scene.hpp>
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes behaviour, that's
+ * stored in contiguous component storage of scene
+ * and updated by scene system of it's type instead
+ * of gameobject. Such behaviours can be allocated
+ * only with scene:
+ * @code{.cpp}
+ * class Mover : public HG::Core::ComponentBehaviour<Mover>
+ * {
+ *     ...
+ * };
+ *
+ * gameObject->addBehaviour(new (scene) Mover());
+ * @endcode
+ * Behaviour is still added to gameobject, so
+ * HG::Core::GameObject::findBehaviour and other
+ * gameobject methods work as usual.
+ * @tparam RealBehaviourType Type of derived behaviour.
+ */
+template <typename RealBehaviourType>
+class ComponentBehaviour : public HG::Core::Behaviour
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    ComponentBehaviour() : Behaviour(Type::Logic)
+    {
+        setUpdateMode(UpdateMode::System);
+    }
+
+    /**
+     * @brief Overriding over placement new for allocating
+     * behaviour in component storage of scene.
+     * Can throw `std::invalid_argument` if allocated
+     * type does not match storage type.
+     * @param n Size of object.
+     * @param scene Pointer to scene.
+     * @return Pointer to raw data.
+     */
+    void* operator new(std::size_t n, HG::Core::Scene* scene)
+    {
+        if (n != sizeof(RealBehaviourType))
+        {
+            throw std::invalid_argument("Component behaviour has to inherit ComponentBehaviour of it's own type.");
+        }
+
+        return scene->template componentStorage<RealBehaviourType>()->allocate();
+    }
+
+    /**
+     * @brief Overriding over delete for returning
+     * memory to component storage.
+     * @param ptr Pointer to memory.
+     */
+    void operator delete(void* ptr)
+    {
+        HG::Core::ComponentStorage<RealBehaviourType>::deallocate(ptr);
+    }
+
+    /**
+     * @brief Delete, that's called if constructor
+     * has thrown exception.
+     * @param ptr Pointer to memory.
+     */
+    void operator delete(void* ptr, HG::Core::Scene*)
+    {
+        HG::Core::ComponentStorage<RealBehaviourType>::deallocate(ptr);
+    }
+};
+
+/**
+ * @brief Function for creating behaviour with default
+ * constructor. Behaviours, derived from
+ * HG::Core::ComponentBehaviour, are allocated in
+ * component storage of scene.
+ * @tparam BehaviourType Behaviour type.
+ * @param scene Scene, behaviour is created for.
+ * @return Pointer to behaviour.
+ */
+template <typename BehaviourType>
+HG::Core::Behaviour* createBehaviour([[maybe_unused]] HG::Core::Scene* scene)
+{
+    if constexpr (std::is_base_of<HG::Core::ComponentBehaviour<BehaviourType>, BehaviourType>::value)
+    {
+        return new (scene) BehaviourType();
+    }
+    else
+    {
+        return new BehaviourType();
+    }
+}
+} // namespace HG::Core
@@ -0,0 +1,312 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes type independent
+ * interface of component storage, that's used by
+ * scene to execute systems.
+ */
+class ComponentStorageBase
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    ComponentStorageBase() : m_systemUpdateMode(Behaviour::UpdateMode::Serial)
+    {
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~ComponentStorageBase() = default;
+
+    // Disable copying
+    ComponentStorageBase(const ComponentStorageBase&) = delete;
+    ComponentStorageBase& operator=(const ComponentStorageBase&) = delete;
+
+    /**
+     * @brief Method for setting how system of this storage
+     * is updated. `Behaviour::UpdateMode::Serial` system updates
+     * components one after another on main thread.
+     * `Behaviour::UpdateMode::Concurrent` system splits
+     * components between thread pool user threads.
+     * Can throw `std::invalid_argument` if mode is
+     * `Behaviour::UpdateMode::System`.
+     * @param mode Update mode.
+     */
+    void setSystemUpdateMode(Behaviour::UpdateMode mode)
+    {
+        if (mode == Behaviour::UpdateMode::System)
+        {
+            throw std::invalid_argument("System can be updated only serially or concurrently.");
+        }
+
+        m_systemUpdateMode = mode;
+    }
+
+    /**
+     * @brief Method for getting how system of
+     * this storage is updated.
+     */
+    [[nodiscard]] Behaviour::UpdateMode systemUpdateMode() const
+    {
+        return m_systemUpdateMode;
+    }
+
+    /**
+     * @brief Method for getting number of
+     * allocated components.
+     */
+    [[nodiscard]] virtual std::size_t size() const = 0;
+
+    /**
+     * @brief Method for updating all active components
+     * in storage order. Components may be created and
+     * deleted during update.
+     */
+    virtual void update() = 0;
+
+    /**
+     * @brief Method for collecting active components
+     * for concurrent update.
+     * @return Number of collected components.
+     */
+    virtual std::size_t prepareConcurrentUpdate() = 0;
+
+    /**
+     * @brief Method for updating range of components,
+     * collected by `prepareConcurrentUpdate`. Components
+     * may be created during concurrent update, but can't
+     * be deleted.
+     * @param first Index of first component.
+     * @param last Index after last component.
+     */
+    virtual void updatePrepared(std::size_t first, std::size_t last) = 0;
+
+private:
+    Behaviour::UpdateMode m_systemUpdateMode;
+};
+
+/**
+ * @brief Class, that describes contiguous storage
+ * of behaviours of one type. Components are placed
+ * in chunks of slots, so addresses of components
+ * don't change and neighbour components are close
+ * in memory. Released slots are reused.
+ * Components are allocated with
+ * HG::Core::ComponentBehaviour `new` operator.
+ * @tparam BehaviourType Type of stored behaviours.
+ */
+template <typename BehaviourType>
+class ComponentStorage final : public ComponentStorageBase
+{
+public:
+    static constexpr std::size_t ChunkSize = 128;
+
+    /**
+     * @brief Constructor.
+     */
+    ComponentStorage() : m_chunks(), m_used(), m_free(), m_size(0), m_prepared(), m_mutex()
+    {
+    }
+
+    /**
+     * @brief Destructor. Components, that was not
+     * deleted, are destroyed.
+     */
+    ~ComponentStorage() override
+    {
+        for (std::size_t index = 0; index < m_used.size(); ++index)
+        {
+            if (m_used[index])
+            {
+                component(index)->~BehaviourType();
+            }
+        }
+    }
+
+    /**
+     * @brief Method for allocating memory for
+     * one component. Thread safe.
+     * @return Pointer to raw memory.
+     */
+    [[nodiscard]] void* allocate()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        std::size_t index;
+
+        if (m_free.empty())
+        {
+            index = m_used.size();
+
+            if (index % ChunkSize == 0)
+            {
+                m_chunks.emplace_back(new Slot[ChunkSize]);
+            }
+
+            m_used.push_back(0);
+        }
+        else
+        {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+
+        auto& slot = slotAt(index);
+
+        slot.storage = this;
+        slot.index   = index;
+
+        m_used[index] = 1;
+        ++m_size;
+
+        return &slot.object;
+    }
+
+    /**
+     * @brief Method for returning memory of component
+     * to it's storage. Thread safe.
+     * @param pointer Pointer, returned by `allocate`.
+     */
+    static void deallocate(void* pointer)
+    {
+        auto slot = reinterpret_cast<Slot*>(static_cast<std::uint8_t*>(pointer) - offsetof(Slot, object));
+
+        slot->storage->release(slot->index);
+    }
+
+    /**
+     * @brief Method for getting number of
+     * allocated components.
+     */
+    [[nodiscard]] std::size_t size() const override
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Method for executing function for every
+     * allocated component in storage order.
+     * @tparam Function Function type.
+     * @param function Function, that takes pointer to component.
+     */
+    template <typename Function>
+    void forEach(Function function)
+    {
+        for (std::size_t index = 0; index < m_used.size(); ++index)
+        {
+            if (m_used[index])
+            {
+                function(component(index));
+            }
+        }
+    }
+
+    void update() override
+    {
+        // Size is taken on every iteration, because
+        // components may be created during update
+        for (std::size_t index = 0; index < m_used.size(); ++index)
+        {
+            if (!m_used[index])
+            {
+                continue;
+            }
+
+            auto behaviour = component(index);
+
+            if (isActive(behaviour))
+            {
+                behaviour->update();
+            }
+        }
+    }
+
+    std::size_t prepareConcurrentUpdate() override
+    {
+        m_prepared.clear();
+
+        forEach([this](BehaviourType* behaviour) {
+            if (isActive(behaviour))
+            {
+                m_prepared.push_back(behaviour);
+            }
+        });
+
+        return m_prepared.size();
+    }
+
+    void updatePrepared(std::size_t first, std::size_t last) override
+    {
+        for (auto index = first; index < last; ++index)
+        {
+            m_prepared[index]->update();
+        }
+    }
+
+private:
+    struct Slot
+    {
+        ComponentStorage* storage;
+        std::size_t index;
+        typename std::aligned_storage<sizeof(BehaviourType), alignof(BehaviourType)>::type object;
+    };
+
+    /**
+     * @brief Method for checking is component
+     * has to be updated by system.
+     */
+    static bool isActive(BehaviourType* behaviour)
+    {
+        return behaviour->updateMode() == Behaviour::UpdateMode::System && behaviour->isStarted() &&
+               behaviour->isEnabled() && behaviour->gameObject() != nullptr &&
+               behaviour->gameObject()->isEnabled();
+    }
+
+    Slot& slotAt(std::size_t index)
+    {
+        return m_chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    BehaviourType* component(std::size_t index)
+    {
+        return std::launder(reinterpret_cast<BehaviourType*>(&slotAt(index).object));
+    }
+
+    void release(std::size_t index)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_used[index] = 0;
+        m_free.push_back(index);
+        --m_size;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+    std::vector<std::uint8_t> m_used;
+    std::vector<std::size_t> m_free;
+    std::size_t m_size;
+
+    // Active components of current concurrent update
+    std::vector<BehaviourType*> m_prepared;
+
+    std::mutex m_mutex;
+};
+} // namespace HG::Core
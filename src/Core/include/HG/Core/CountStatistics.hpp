@@ -32,7 +32,9 @@ public:
 
     enum CommonCounter
     {
-        NumberOfVertices
+        NumberOfVertices,
+        DispatchedJobs,
+        PendingDispatchJobs
     };
 
     using ValueType = uint64_t;
@@ -13,6 +13,11 @@ namespace HG::Core
 class Data
 {
 public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Data() = default;
+
     /**
      * @brief Method for getting received data
      * size.
@@ -0,0 +1,198 @@
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace HG::Core
+{
+class ThreadPool;
+
+/**
+ * @brief Class, that describes per frame task graph.
+ * Every task declares resources it reads and writes.
+ * Two tasks depends on each other if one of them writes
+ * resource, that another one reads or writes. In this case
+ * task, that was added earlier will be executed first.
+ * Independent tasks are executed concurrently on
+ * user threads of thread pool. Task dependencies are
+ * recalculated only after adding or removing tasks.
+ *
+ * Sample usage:
+ * ```cpp
+ * application->frameGraph()->addTask(
+ *     "AIPlanning",
+ *     [this]() { planning(); },
+ *     {HG::Core::FrameGraph::Resources::Input},
+ *     {"AI"}
+ * );
+ * ```
+ */
+class FrameGraph
+{
+public:
+    /**
+     * @brief Names of resources, that are used
+     * by engine stages.
+     */
+    struct Resources
+    {
+        static constexpr const char* Physics  = "Physics";
+        static constexpr const char* Scene    = "Scene";
+        static constexpr const char* Input    = "Input";
+        static constexpr const char* Gizmos   = "Gizmos";
+        static constexpr const char* Renderer = "Renderer";
+    };
+
+    /**
+     * @brief Thread, where task can be executed.
+     */
+    enum class Affinity
+    {
+        MainThread,
+        AnyThread
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    FrameGraph();
+
+    // Disable copying
+    FrameGraph(const FrameGraph&) = delete;
+    FrameGraph& operator=(const FrameGraph&) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    ~FrameGraph();
+
+    /**
+     * @brief Method for adding task to graph.
+     * Can throw `std::invalid_argument` exception if
+     * task with this name is already presented.
+     * @param name Unique task name.
+     * @param function Task function.
+     * @param reads Names of resources, task reads.
+     * @param writes Names of resources, task writes.
+     * @param affinity Thread, where task can be executed.
+     */
+    void addTask(std::string name,
+                 std::function<void()> function,
+                 std::vector<std::string> reads,
+                 std::vector<std::string> writes,
+                 Affinity affinity = Affinity::AnyThread);
+
+    /**
+     * @brief Method for removing task from graph.
+     * Can throw `std::invalid_argument` exception if
+     * there is no task with this name.
+     * @param name Task name.
+     */
+    void removeTask(const std::string& name);
+
+    /**
+     * @brief Method for checking is task with specified
+     * name presented.
+     * @param name Task name.
+     */
+    [[nodiscard]] bool hasTask(const std::string& name) const;
+
+    /**
+     * @brief Method for getting number of tasks.
+     */
+    [[nodiscard]] std::size_t numberOfTasks() const;
+
+    /**
+     * @brief Method for executing all tasks once.
+     * Main thread tasks are executed in calling thread.
+     * Method returns after all tasks are finished.
+     * If some task throws - first exception will be rethrown
+     * after all other tasks finished.
+     * @param pool Pool for executing tasks with any thread
+     * affinity. If `nullptr` - all tasks will be executed
+     * in calling thread.
+     */
+    void execute(HG::Core::ThreadPool* pool);
+
+    /**
+     * @brief Method for getting duration of longest dependency
+     * chain of last execution.
+     * @return Time in microseconds.
+     */
+    [[nodiscard]] std::chrono::microseconds criticalPathTime() const;
+
+    /**
+     * @brief Method for getting names of tasks from longest
+     * dependency chain of last execution.
+     * @return Names of tasks in execution order.
+     */
+    [[nodiscard]] std::vector<std::string> criticalPath() const;
+
+private:
+    struct Task
+    {
+        std::string name;
+        std::function<void()> function;
+        std::vector<std::string> reads;
+        std::vector<std::string> writes;
+        Affinity affinity;
+
+        // Indices of dependent and dependency tasks
+        std::vector<std::size_t> successors;
+        std::vector<std::size_t> predecessors;
+
+        std::chrono::steady_clock::duration duration;
+    };
+
+    /**
+     * @brief Method for checking if task `later` has
+     * to be executed after task `earlier`.
+     */
+    static bool isConflicting(const Task& earlier, const Task& later);
+
+    /**
+     * @brief Method for rebuilding task dependencies.
+     */
+    void rebuild();
+
+    /**
+     * @brief Method for executing task and scheduling
+     * tasks, that depends on it.
+     * @param index Task index.
+     */
+    void runTask(std::size_t index);
+
+    /**
+     * @brief Method for scheduling ready task.
+     * @param index Task index.
+     */
+    void schedule(std::size_t index);
+
+    std::vector<Task> m_tasks;
+    bool m_dirty;
+
+    // Execution state
+    HG::Core::ThreadPool* m_pool;
+    std::unique_ptr<std::atomic_size_t[]> m_remainingDependencies;
+
+    std::mutex m_mainThreadMutex;
+    std::condition_variable m_mainThreadNotifier;
+    std::deque<std::size_t> m_mainThreadTasks;
+    std::size_t m_finishedTasks;
+
+    std::exception_ptr m_exception;
+
+    // Last execution statistics
+    std::chrono::microseconds m_criticalPathTime;
+    std::vector<std::size_t> m_criticalPath;
+};
+} // namespace HG::Core
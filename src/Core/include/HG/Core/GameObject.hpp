@@ -1,10 +1,23 @@
 #pragma once
 
+// C++ STL
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 // HG::Core
 #include <HG/Core/CachableResource.hpp>
+#include <HG/Core/Handle.hpp>
 
 // HG::Utils
 #include <HG/Utils/DoubleBufferContainer.hpp>
+#include <HG/Utils/TypeId.hpp>
 
 namespace HG::Rendering::Base
 {
@@ -60,6 +73,15 @@ public:
      */
     [[nodiscard]] HG::Core::Scene* scene() const;
 
+    /**
+     * @brief Method for getting handle of gameobject.
+     * Handle is issued, when gameobject is added to scene,
+     * and is resolved with HG::Core::Scene::gameObject
+     * until gameobject is removed from scene.
+     * @return Handle or null handle.
+     */
+    [[nodiscard]] HG::Core::Handle<HG::Core::GameObject> handle() const;
+
     /**
      * @brief Method for adding new behaviour.
      * @param behaviour New behaviour.
@@ -68,18 +90,17 @@ public:
 
     /**
      * @brief Method for removing behaviour from
-     * game object. If behaviour is deleting
-     * this method will be called from `Behaviour` destructor.
-     * If behaviour was not deleted it has to be
-     * deleted manually, because GameObject `clear`
-     * method fill not handle this behaviour anymore.
+     * game object. Removed behaviour is deleted at the
+     * end of scene frame (or on next gameobject update,
+     * if gameobject is not in scene), so pointer to it
+     * stays valid until then.
      * @param behaviour Pointer to behaviour.
      */
     void removeBehaviour(HG::Core::Behaviour* behaviour);
 
     /**
      * @brief Method for setting internal game object
-     * name.
+     * name. Scene name index is updated.
      * @param name Name.
      */
     void setName(std::string name);
@@ -89,7 +110,35 @@ public:
      * name.
      * @return String name.
      */
-    [[nodiscard]] std::string name() const;
+    [[nodiscard]] const std::string& name() const;
+
+    /**
+     * @brief Method for setting game object tag.
+     * Scene tag index is updated.
+     * @param tag Tag.
+     */
+    void setTag(std::string tag);
+
+    /**
+     * @brief Method for getting game object tag.
+     * Empty by default.
+     * @return String tag.
+     */
+    [[nodiscard]] const std::string& tag() const;
+
+    /**
+     * @brief Method for setting game object layer.
+     * Scene layer index is updated.
+     * @param layer Layer.
+     */
+    void setLayer(std::uint32_t layer);
+
+    /**
+     * @brief Method for getting game object layer.
+     * 0 by default.
+     * @return Layer.
+     */
+    [[nodiscard]] std::uint32_t layer() const;
 
     /**
      * @brief Method for checking is gameobject enabled.
@@ -136,6 +185,17 @@ public:
     template <typename Container>
     void getRenderingBehaviours(Container& container) const
     {
+        // Nothing to skip, so removing checks are not required
+        if (m_renderBehaviours.removable().empty())
+        {
+            for (auto&& behaviour : m_renderBehaviours)
+            {
+                container.push_back((typename Container::value_type)behaviour);
+            }
+
+            return;
+        }
+
         for (auto&& behaviour : m_renderBehaviours)
         {
             if (m_renderBehaviours.isRemoving(behaviour))
@@ -147,67 +207,59 @@ public:
         }
     }
 
-    // todo: Add commentary
+    /**
+     * @brief Method for searching for behaviour by type.
+     * Behaviours of every requested type are collected
+     * on first search and kept up to date, when behaviours
+     * are added or removed, so search is a table lookup.
+     * Types are identified by `HG::Utils::TypeId`, so type
+     * has to be searched from one module. Thread safe.
+     * @tparam BehaviourType Behaviour type.
+     * @return Pointer to first behaviour of type or nullptr.
+     */
     template <typename BehaviourType>
     BehaviourType* findBehaviour() const
     {
-        for (auto&& behaviour : m_behaviours)
-        {
-            if (m_behaviours.isRemoving(behaviour))
-            {
-                continue;
-            }
-
-            auto casted = dynamic_cast<BehaviourType*>(behaviour);
-
-            if (casted != nullptr)
-            {
-                return casted;
-            }
-        }
+        auto& behaviours = behavioursOfType<BehaviourType>();
 
-        if constexpr (std::is_base_of<HG::Rendering::Base::RenderBehaviour, BehaviourType>::value)
+        if (behaviours.empty())
         {
-            for (auto&& behaviour : m_renderBehaviours)
-            {
-                if (m_renderBehaviours.isRemoving(behaviour))
-                {
-                    continue;
-                }
-
-                auto casted = dynamic_cast<BehaviourType*>(behaviour);
-
-                if (casted != nullptr)
-                {
-                    return casted;
-                }
-            }
+            return nullptr;
         }
 
-        return nullptr;
+        return static_cast<BehaviourType*>(behaviours.front().second);
     }
 
-    // todo: Add commentary
+    /**
+     * @brief Method for searching for all behaviours
+     * by type. Thread safe.
+     * @tparam BehaviourType Behaviour type.
+     * @tparam Container Container type.
+     * @param container Container object.
+     */
     template <typename BehaviourType, typename Container>
     void findBehaviours(Container& container) const
     {
-        for (auto&& behaviour : m_behaviours)
+        for (auto&& [behaviour, casted] : behavioursOfType<BehaviourType>())
         {
-            if (m_behaviours.isRemoving(behaviour))
-            {
-                continue;
-            }
-
-            auto casted = dynamic_cast<BehaviourType*>(behaviour);
-
-            if (casted != nullptr)
-            {
-                container.push_back(behaviour);
-            }
+            container.push_back(behaviour);
         }
     }
 
-    // todo: Add commentary
+    /**
+     * @brief Method for executing function for every
+     * behaviour, that's attached to gameobject, including
+     * added on current frame.
+     * @param function Function.
+     */
+    void forEachAttachedBehaviour(const std::function<void(HG::Core::Behaviour*)>& function) const;
+
+    /**
+     * @brief Method for receiving logic
+     * behaviours of gameobject.
+     * @tparam Container Container type.
+     * @param container Container object.
+     */
     template <typename Container>
     void getBehaviours(Container& container) const
     {
@@ -224,6 +276,7 @@ public:
 
 protected:
     friend class Scene;
+    friend class Behaviour;
 
     /**
      * @brief Method for setting parent scene.
@@ -231,16 +284,140 @@ protected:
      */
     void setParentScene(Scene* parent);
 
+    /**
+     * @brief Method for updating gameobject behaviours.
+     * Behaviours with `Behaviour::UpdateMode::Concurrent` update
+     * mode are not updated, but appended to container. Behaviours
+     * with `Behaviour::UpdateMode::System` update mode are
+     * updated by scene systems.
+     * @param concurrentBehaviours Container for concurrent behaviours.
+     */
+    void update(std::vector<HG::Core::Behaviour*>& concurrentBehaviours);
+
+    /**
+     * @brief Method for deleting removed behaviours
+     * and dropping them from containers. Added behaviours
+     * are kept until next update.
+     */
+    void destroyRemovedBehaviours();
+
+    /**
+     * @brief Method for removing behaviour from
+     * containers. During concurrent update whole removing
+     * is deferred, so behaviour stays attached until
+     * deferred changes are applied.
+     * @param behaviour Pointer to behaviour.
+     * @param destroyed Is behaviour destroyed already.
+     * Destroyed behaviour itself is not touched.
+     */
+    void detachBehaviour(HG::Core::Behaviour* behaviour, bool destroyed);
+
 private:
+    // Behaviour and it's pointer, casted to requested type
+    using TypedBehaviours = std::vector<std::pair<HG::Core::Behaviour*, void*>>;
+
+    /**
+     * @brief Behaviours of one requested type. Entry is
+     * created on first request of type and updated, when
+     * behaviours are added or removed. Entries are not
+     * deleted until gameobject destruction, so they are
+     * looked up without locking.
+     */
+    struct TypeIndexEntry
+    {
+        // Identifier of requested type
+        std::size_t typeId;
+
+        // Function, that casts behaviour to requested type or returns nullptr
+        void* (*cast)(HG::Core::Behaviour*);
+
+        // Are render behaviours of requested type
+        bool render;
+
+        // Behaviours of requested type in order of adding
+        TypedBehaviours behaviours;
+
+        TypeIndexEntry* next;
+    };
+
+    /**
+     * @brief Method for casting behaviour
+     * to requested type.
+     * @tparam BehaviourType Requested type.
+     */
+    template <typename BehaviourType>
+    static void* castBehaviour(HG::Core::Behaviour* behaviour)
+    {
+        return dynamic_cast<BehaviourType*>(behaviour);
+    }
+
+    /**
+     * @brief Method for getting behaviours of type.
+     * @tparam BehaviourType Behaviour type.
+     */
+    template <typename BehaviourType>
+    const TypedBehaviours& behavioursOfType() const
+    {
+        auto typeId = HG::Utils::TypeId::get<BehaviourType>();
+
+        for (auto entry = m_typeIndex.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+        {
+            if (entry->typeId == typeId)
+            {
+                return entry->behaviours;
+            }
+        }
+
+        return indexType(typeId,
+                         &castBehaviour<BehaviourType>,
+                         std::is_base_of<HG::Rendering::Base::RenderBehaviour, BehaviourType>::value);
+    }
+
+    /**
+     * @brief Method for creating type index entry
+     * with current behaviours of requested type.
+     * @param typeId Requested type identifier.
+     * @param cast Cast function.
+     * @param render Are render behaviours of requested type.
+     * @return Behaviours of requested type.
+     */
+    const TypedBehaviours& indexType(std::size_t typeId, void* (*cast)(HG::Core::Behaviour*), bool render) const;
+
+    /**
+     * @brief Method for adding merged behaviour
+     * to type index entries.
+     * @param behaviour Pointer to behaviour.
+     */
+    void indexBehaviour(HG::Core::Behaviour* behaviour);
+
+    /**
+     * @brief Method for removing behaviour from type
+     * index entries. Behaviour is not dereferenced.
+     * @param behaviour Pointer to behaviour.
+     */
+    void unindexBehaviour(HG::Core::Behaviour* behaviour);
+
     Transform* m_transform;
 
     HG::Utils::DoubleBufferContainer<HG::Core::Behaviour*> m_behaviours;
 
     HG::Utils::DoubleBufferContainer<HG::Rendering::Base::RenderBehaviour*> m_renderBehaviours;
 
+    // Behaviours by requested type identifier. Mutex
+    // is locked only on first request of type.
+    mutable std::atomic<TypeIndexEntry*> m_typeIndex;
+    mutable std::mutex m_typeIndexMutex;
+
     std::string m_name;
+    std::string m_tag;
+    std::uint32_t m_layer;
 
     HG::Core::Scene* m_parentScene;
+    HG::Core::Handle<HG::Core::GameObject> m_handle;
+
+    // Number of adding to scene, scene
+    // indices are ordered by it
+    std::uint64_t m_sceneOrder;
 
     bool m_enabled;
     bool m_hidden;
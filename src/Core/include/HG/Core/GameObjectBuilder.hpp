@@ -1,6 +1,7 @@
 #pragma once
 
 // C++ STL
+#include <cstdint>
 #include <string>
 
 // GLM
@@ -117,6 +118,20 @@ public:
      */
     GameObjectBuilder& setName(std::string name);
 
+    /**
+     * @brief Method to set game object tag.
+     * @param tag ASCII tag.
+     * @return Reference to builder instance.
+     */
+    GameObjectBuilder& setTag(std::string tag);
+
+    /**
+     * @brief Method to set game object layer.
+     * @param layer Layer.
+     * @return Reference to builder instance.
+     */
+    GameObjectBuilder& setLayer(std::uint32_t layer);
+
     /**
      * @brief Method to set game object parent.
      * @param parent Parent GameObject.
@@ -0,0 +1,169 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace HG::Core
+{
+/**
+ * @brief Generational handle of object. Unlike raw
+ * pointer handle can be kept after object is removed:
+ * handle table increments slot generation on removing,
+ * so outdated handle is resolved to nullptr.
+ * @tparam T Object type.
+ */
+template <typename T>
+struct Handle
+{
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index      = InvalidIndex;
+    std::uint32_t generation = 0;
+
+    /**
+     * @brief Method for checking was handle
+     * issued by some table. It's not checking
+     * is object still alive.
+     */
+    [[nodiscard]] bool isNull() const
+    {
+        return index == InvalidIndex;
+    }
+
+    bool operator==(const Handle& rhs) const
+    {
+        return index == rhs.index && generation == rhs.generation;
+    }
+
+    bool operator!=(const Handle& rhs) const
+    {
+        return !(*this == rhs);
+    }
+};
+
+/**
+ * @brief Class, that describes table of objects,
+ * referenced by generational handles. Slots of removed
+ * objects are reused. Adding, removing and resolving
+ * are O(1). Table is not thread safe, but resolving
+ * can be performed concurrently if table is not changed.
+ * @tparam T Object type.
+ */
+template <typename T>
+class HandleTable
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    HandleTable() : m_slots(), m_free()
+    {
+    }
+
+    /**
+     * @brief Method for adding object to table.
+     * @param object Pointer to object.
+     * @return Handle of object.
+     */
+    Handle<T> add(T* object)
+    {
+        Handle<T> handle;
+
+        if (m_free.empty())
+        {
+            handle.index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.push_back({object, 0});
+        }
+        else
+        {
+            handle.index = m_free.back();
+            m_free.pop_back();
+
+            m_slots[handle.index].object = object;
+        }
+
+        handle.generation = m_slots[handle.index].generation;
+
+        return handle;
+    }
+
+    /**
+     * @brief Method for reserving slots for
+     * `count` objects.
+     * @param count Number of objects.
+     */
+    void reserve(std::size_t count)
+    {
+        if (count > size())
+        {
+            m_slots.reserve(m_slots.size() + count - size());
+        }
+    }
+
+    /**
+     * @brief Method for removing object from table.
+     * All handles of object become outdated.
+     * Outdated handles are ignored.
+     * @param handle Handle of object.
+     */
+    void remove(Handle<T> handle)
+    {
+        if (get(handle) == nullptr)
+        {
+            return;
+        }
+
+        auto& slot = m_slots[handle.index];
+
+        slot.object = nullptr;
+        ++slot.generation;
+
+        m_free.push_back(handle.index);
+    }
+
+    /**
+     * @brief Method for resolving handle.
+     * @param handle Handle of object.
+     * @return Pointer to object or nullptr if
+     * handle is outdated or null.
+     */
+    [[nodiscard]] T* get(Handle<T> handle) const
+    {
+        if (handle.index >= m_slots.size())
+        {
+            return nullptr;
+        }
+
+        auto& slot = m_slots[handle.index];
+
+        if (slot.generation != handle.generation)
+        {
+            return nullptr;
+        }
+
+        return slot.object;
+    }
+
+    /**
+     * @brief Method for getting number of
+     * objects in table.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_slots.size() - m_free.size();
+    }
+
+private:
+    struct Slot
+    {
+        T* object;
+        std::uint32_t generation;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_free;
+};
+} // namespace HG::Core
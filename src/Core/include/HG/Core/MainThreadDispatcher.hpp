@@ -0,0 +1,122 @@
+#pragma once
+
+// C++ STL
+#include <array>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes queue of jobs, that
+ * has to be executed in main (rendering) thread, like
+ * uploading data to GPU. Jobs can be pushed from any
+ * thread. Application executes jobs once per frame,
+ * until frame time budget is spent, so big amount of
+ * jobs is spread over several frames instead of
+ * causing frame spikes.
+ *
+ * Sample usage:
+ * ```cpp
+ * application->mainThreadDispatcher()->push(
+ *     [this, surface]() { upload(surface); },
+ *     HG::Core::MainThreadDispatcher::Priority::High
+ * );
+ * ```
+ */
+class MainThreadDispatcher
+{
+public:
+    /**
+     * @brief Job priority. Jobs with higher priority
+     * are executed first. Jobs with same priority are
+     * executed in pushing order.
+     */
+    enum class Priority
+    {
+        High,
+        Normal,
+        Low,
+        NumberOfPriorities
+    };
+
+    using Job = std::function<void()>;
+
+    /**
+     * @brief Constructor.
+     */
+    MainThreadDispatcher();
+
+    // Disable copying
+    MainThreadDispatcher(const MainThreadDispatcher&) = delete;
+    MainThreadDispatcher& operator=(const MainThreadDispatcher&) = delete;
+
+    /**
+     * @brief Method for pushing job.
+     * Can be called from any thread.
+     * @param job Job.
+     * @param priority Job priority.
+     */
+    void push(Job job, Priority priority = Priority::Normal);
+
+    /**
+     * @brief Method for setting time budget for
+     * one `execute` call.
+     * @param budget Time budget in microseconds.
+     */
+    void setBudget(std::chrono::microseconds budget);
+
+    /**
+     * @brief Method for getting time budget for
+     * one `execute` call.
+     * @return Time budget in microseconds.
+     */
+    [[nodiscard]] std::chrono::microseconds budget() const;
+
+    /**
+     * @brief Method for executing jobs until time budget
+     * is spent. At least one job is executed if there is
+     * any, so progress is made even if job takes more time,
+     * than budget. Exceptions, thrown by jobs are logged.
+     * Has to be called from main thread.
+     * @return Number of executed jobs.
+     */
+    std::size_t execute();
+
+    /**
+     * @brief Method for getting number of jobs,
+     * waiting for execution.
+     */
+    [[nodiscard]] std::size_t numberOfPendingJobs() const;
+
+    /**
+     * @brief Method for getting number of jobs with
+     * specified priority, waiting for execution.
+     * @param priority Priority.
+     */
+    [[nodiscard]] std::size_t numberOfPendingJobs(Priority priority) const;
+
+    /**
+     * @brief Method for getting time, spent by last
+     * `execute` call.
+     * @return Time in microseconds.
+     */
+    [[nodiscard]] std::chrono::microseconds lastExecutionTime() const;
+
+private:
+    /**
+     * @brief Method for taking job with highest priority.
+     * @param job Result job.
+     * @return Was job taken.
+     */
+    bool takeJob(Job& job);
+
+    mutable std::mutex m_mutex;
+    std::array<std::deque<Job>, static_cast<std::size_t>(Priority::NumberOfPriorities)> m_jobs;
+
+    std::chrono::microseconds m_budget;
+    std::chrono::microseconds m_lastExecutionTime;
+};
+} // namespace HG::Core
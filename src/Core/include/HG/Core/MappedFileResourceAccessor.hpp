@@ -0,0 +1,81 @@
+#pragma once
+
+// C++ STL
+#include <string>
+
+// HG::Core
+#include <HG/Core/FilesystemResourceAccessor.hpp> // Required for inheritance
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes filesystem resource
+ * accessor, that maps files into memory instead of
+ * copying them. Loaders are parsing data right from
+ * page cache and file is unmapped, when last
+ * HG::Core::DataPtr is destroyed. If file can't
+ * be mapped (or platform doesn't support mapping)
+ * it's loaded as HG::Core::FilesystemResourceAccessor does.
+ *
+ * Mapped file must not be truncated while data is used.
+ */
+class MappedFileResourceAccessor : public HG::Core::FilesystemResourceAccessor
+{
+public:
+    /**
+     * @brief Class, that describes data object with
+     * mapped file region inside.
+     */
+    class MappedData : public HG::Core::Data
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param address Mapped region.
+         * @param size Size of mapped region.
+         * @param id Data id.
+         */
+        MappedData(void* address, std::size_t size, std::string id);
+
+        /**
+         * @brief Destructor. Unmaps region.
+         */
+        ~MappedData() override;
+
+        // Disable copying
+        MappedData(const MappedData&) = delete;
+        MappedData& operator=(const MappedData&) = delete;
+
+        /**
+         * @brief Method for getting amount of data
+         * in bytes.
+         */
+        [[nodiscard]] std::size_t size() const override;
+
+        /**
+         * @brief Method for getting pointer to data.
+         * @return Pointer to array of bytes.
+         */
+        [[nodiscard]] const std::byte* data() const override;
+
+        /**
+         * @brief Method for getting data id.
+         * @return ID.
+         */
+        [[nodiscard]] std::string id() const override;
+
+    private:
+        void* m_address;
+        std::size_t m_size;
+
+        std::string m_id;
+    };
+
+    /**
+     * @brief Method for mapping file.
+     * @param id Path to file.
+     * @return Mapped data or nullptr if file can't be opened.
+     */
+    HG::Core::DataPtr loadRaw(const std::string& id) override;
+};
+} // namespace HG::Core
@@ -0,0 +1,149 @@
+#pragma once
+
+// C++ STL
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Data.hpp>             // Required, because of package data
+#include <HG/Core/ResourceAccessor.hpp> // Required for inheritance
+
+namespace HG::Core
+{
+/**
+ * @brief Class, that describes resource accessor, that
+ * serves resources right from `.hgpackage` file, created
+ * by HG::Tools::PackageProcessor. Package is mapped
+ * into memory once, it's file structure is kept as index
+ * and entries are inflated on every `loadRaw` call.
+ * Resource id is path of file inside package, like
+ * `textures/player.png`.
+ *
+ * Files of version 2 packages are stored as independent
+ * blocks, so `loadRange` inflates only blocks, that
+ * contain requested range. Every inflated block is
+ * validated with it's CRC32.
+ *
+ * Accessor doesn't change after construction, so it
+ * can be used from several loading threads at once.
+ *
+ * Sample usage:
+ * ```cpp
+ * application->resourceManager()->setResourceAccessor(
+ *     new HG::Core::PackageResourceAccessor("assets.hgpackage")
+ * );
+ * ```
+ */
+class PackageResourceAccessor : public HG::Core::ResourceAccessor
+{
+public:
+    /**
+     * @brief Constructor. Can throw `std::invalid_argument`
+     * if package can't be opened or it's damaged.
+     * Version 1 package control sum is not validated,
+     * because it requires reading of whole package.
+     * @param path Path to package.
+     */
+    explicit PackageResourceAccessor(const std::string& path);
+
+    /**
+     * @brief Method for loading and inflating package entry.
+     * @param id Path of file inside package.
+     * @return Loaded data or nullptr if there is no such
+     * file or it can't be inflated.
+     */
+    HG::Core::DataPtr loadRaw(const std::string& id) override;
+
+    /**
+     * @brief Method for loading part of package entry.
+     * Range is clamped by file size. Entries of version 1
+     * packages are inflated completely.
+     * @param id Path of file inside package.
+     * @param offset Offset of range in uncompressed file.
+     * @param size Size of range in bytes.
+     * @return Loaded data or nullptr if there is no such
+     * file, offset is out of file or data is damaged.
+     */
+    HG::Core::DataPtr loadRange(const std::string& id, std::size_t offset, std::size_t size);
+
+    /**
+     * @brief Method for checking is package
+     * contains file.
+     * @param id Path of file inside package.
+     */
+    [[nodiscard]] bool hasEntry(const std::string& id) const;
+
+    /**
+     * @brief Method for getting number of files
+     * in package.
+     */
+    [[nodiscard]] std::size_t numberOfEntries() const;
+
+private:
+    struct Block
+    {
+        std::uint64_t offset;
+        std::uint32_t compressedSize;
+        std::uint32_t crc;
+    };
+
+    struct Entry
+    {
+        std::uint64_t offset;
+        std::uint64_t compressedSize;
+
+        // Version 2 only. Block size is 0 for
+        // single stream entries.
+        std::uint64_t size;
+        std::uint32_t crc;
+        std::uint32_t blockSize;
+        std::vector<Block> blocks;
+    };
+
+    /**
+     * @brief Method for reading package header and
+     * file structure into index.
+     */
+    void readIndex();
+
+    /**
+     * @brief Method for inflating version 1 entry,
+     * that's stored as single zlib stream.
+     * @return Inflated data or nullptr if entry
+     * is damaged.
+     */
+    HG::Core::DataPtr inflateStream(const Entry& entry, const std::string& id) const;
+
+    /**
+     * @brief Method for inflating range of version 2
+     * entry block by block.
+     * @return Inflated range or nullptr if block
+     * is damaged.
+     */
+    HG::Core::DataPtr inflateBlocks(const Entry& entry,
+                                    const std::string& id,
+                                    std::uint64_t offset,
+                                    std::uint64_t size) const;
+
+    /**
+     * @brief Method for searching entry.
+     * @return Entry or nullptr.
+     */
+    const Entry* findEntry(const std::string& id) const;
+
+    /**
+     * @brief Method for normalizing path to
+     * index key.
+     */
+    static std::string normalize(const std::string& id);
+
+    std::string m_path;
+
+    // Whole package
+    HG::Core::DataPtr m_package;
+
+    std::unordered_map<std::string, Entry> m_entries;
+};
+} // namespace HG::Core
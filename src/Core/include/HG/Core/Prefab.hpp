@@ -0,0 +1,284 @@
+#pragma once
+
+// C++ STL
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/ComponentBehaviour.hpp>
+#include <HG/Core/PropertyTable.hpp>
+
+// GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace HG::Core
+{
+class GameObject;
+class ResourceCache;
+class Scene;
+
+/**
+ * @brief Class, that describes template of gameobjects
+ * hierarchy with behaviours and their property values.
+ * Prefab is instantiated several times with one `spawn`
+ * call. Memory for gameobjects and transforms is taken from
+ * resource cache, that's pre-warmed for whole batch, and
+ * all instances are added to scene at once.
+ *
+ * Sample usage:
+ * ```cpp
+ * HG::Core::Prefab bullet(cache);
+ *
+ * bullet.root()
+ *     .setName("Bullet")
+ *     .addBehaviour<Mover>()
+ *     .setProperty("Speed", 10.0f);
+ *
+ * bullet.addChild(bullet.root())
+ *     .setLocalPosition(glm::vec3(0.0f, 0.0f, 1.0f))
+ *     .addBehaviour<Trail>();
+ *
+ * std::vector<HG::Core::GameObject*> bullets;
+ * bullet.spawn(scene, 200, bullets);
+ * ```
+ */
+class Prefab
+{
+public:
+    /**
+     * @brief Class, that describes behaviour of
+     * prefab node and it's property values.
+     */
+    class BehaviourTemplate
+    {
+    public:
+        using Factory = std::function<HG::Core::Behaviour*(HG::Core::Scene*)>;
+
+        /**
+         * @brief Constructor.
+         * @param factory Function, that creates behaviour.
+         */
+        explicit BehaviourTemplate(Factory factory);
+
+        /**
+         * @brief Method for setting value of property for
+         * all instances. Property is searched once on first
+         * spawn. `spawn` will throw `std::invalid_argument`
+         * if property does not exist or has another type.
+         * @tparam Type Property type.
+         * @param name Property name.
+         * @param value Value.
+         * @return Reference to template.
+         */
+        template <typename Type>
+        BehaviourTemplate& setProperty(std::string name, Type value)
+        {
+            m_properties.push_back({std::move(name), nullptr, [value](HG::Core::Behaviour::Property property) {
+                                        property.set<Type>(value);
+                                    }});
+
+            return (*this);
+        }
+
+        /**
+         * @brief Method for creating behaviour with
+         * property values.
+         * @param scene Scene, behaviour is created for.
+         * @return Pointer to behaviour.
+         */
+        [[nodiscard]] HG::Core::Behaviour* instantiate(HG::Core::Scene* scene);
+
+    private:
+        struct PropertyValue
+        {
+            std::string name;
+            const HG::Core::PropertyTable::Entry* entry;
+            std::function<void(HG::Core::Behaviour::Property)> apply;
+        };
+
+        Factory m_factory;
+
+        std::vector<PropertyValue> m_properties;
+    };
+
+    /**
+     * @brief Class, that describes one gameobject of
+     * prefab hierarchy.
+     */
+    class Node
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param index Index of node.
+         * @param parent Index of parent node.
+         */
+        Node(std::size_t index, std::size_t parent);
+
+        /**
+         * @brief Method to set gameobject name.
+         * @param name ASCII name.
+         * @return Reference to node.
+         */
+        Node& setName(std::string name);
+
+        /**
+         * @brief Method to set gameobject tag.
+         * @param tag ASCII tag.
+         * @return Reference to node.
+         */
+        Node& setTag(std::string tag);
+
+        /**
+         * @brief Method to set gameobject layer.
+         * @param layer Layer.
+         * @return Reference to node.
+         */
+        Node& setLayer(std::uint32_t layer);
+
+        /**
+         * @brief Method for setting gameobject
+         * enabled state.
+         * @param enabled Enabled state.
+         * @return Reference to node.
+         */
+        Node& setEnabled(bool enabled);
+
+        /**
+         * @brief Method for setting gameobject
+         * hidden state.
+         * @param hidden Hidden state.
+         * @return Reference to node.
+         */
+        Node& setHidden(bool hidden);
+
+        /**
+         * @brief Method to set gameobject local position.
+         * @param position Vector3 position value.
+         * @return Reference to node.
+         */
+        Node& setLocalPosition(const glm::vec3& position);
+
+        /**
+         * @brief Method to set gameobject local rotation.
+         * @param rotation Quaternion rotation value.
+         * @return Reference to node.
+         */
+        Node& setLocalRotation(const glm::quat& rotation);
+
+        /**
+         * @brief Method to set gameobject local scale.
+         * @param scale Vector3 scale value.
+         * @return Reference to node.
+         */
+        Node& setLocalScale(const glm::vec3& scale);
+
+        /**
+         * @brief Method for adding behaviour, that's
+         * created with default constructor. Behaviours,
+         * derived from HG::Core::ComponentBehaviour, are
+         * allocated in component storage of scene.
+         * @tparam BehaviourType Behaviour type.
+         * @return Reference to behaviour template.
+         */
+        template <typename BehaviourType>
+        BehaviourTemplate& addBehaviour()
+        {
+            return addBehaviour(&HG::Core::createBehaviour<BehaviourType>);
+        }
+
+        /**
+         * @brief Method for adding behaviour, that's
+         * created by factory.
+         * @param factory Function, that creates behaviour.
+         * @return Reference to behaviour template.
+         */
+        BehaviourTemplate& addBehaviour(BehaviourTemplate::Factory factory);
+
+    private:
+        friend class Prefab;
+
+        std::size_t m_index;
+        std::size_t m_parent;
+
+        std::string m_name;
+        std::string m_tag;
+        std::uint32_t m_layer;
+
+        bool m_enabled;
+        bool m_hidden;
+
+        glm::vec3 m_localPosition;
+        glm::quat m_localRotation;
+        glm::vec3 m_localScale;
+
+        // Deque, because references to
+        // templates are given to user
+        std::deque<BehaviourTemplate> m_behaviours;
+    };
+
+    /**
+     * @brief Constructor. Prefab is created
+     * with root node.
+     * @param cache Cache, gameobjects are allocated in.
+     */
+    explicit Prefab(HG::Core::ResourceCache* cache);
+
+    // Disable copying
+    Prefab(const Prefab&) = delete;
+    Prefab& operator=(const Prefab&) = delete;
+
+    /**
+     * @brief Method for getting root node.
+     * @return Reference to node.
+     */
+    Node& root();
+
+    /**
+     * @brief Method for adding child node.
+     * Can throw `std::invalid_argument` if parent
+     * node belongs to another prefab.
+     * @param parent Parent node.
+     * @return Reference to new node.
+     */
+    Node& addChild(const Node& parent);
+
+    /**
+     * @brief Method for getting number of
+     * gameobjects in one instance.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Method for pre-warming resource cache,
+     * so `count` instances are spawned without
+     * gameobjects and transforms allocation.
+     * @param count Number of instances.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Method for creating instances of prefab
+     * and adding them to scene. Gameobjects, created
+     * before exception, are deleted.
+     * Can throw `std::invalid_argument` if scene is nullptr.
+     * @param scene Pointer to scene.
+     * @param count Number of instances.
+     * @param roots Container, that receives root
+     * gameobjects of instances.
+     */
+    void spawn(HG::Core::Scene* scene, std::size_t count, std::vector<HG::Core::GameObject*>& roots);
+
+private:
+    HG::Core::ResourceCache* m_cache;
+
+    // Parent nodes are placed before children.
+    // Deque, because references to nodes are given to user
+    std::deque<Node> m_nodes;
+};
+} // namespace HG::Core
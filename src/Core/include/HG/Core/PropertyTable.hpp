@@ -0,0 +1,109 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace HG::Core
+{
+class Behaviour;
+
+/**
+ * @brief Class, that describes reflected properties,
+ * declared by one behaviour type. Table is shared by
+ * all instances of type and filled once, when first
+ * instance is constructed. Properties of base types
+ * are stored in parent table.
+ */
+class PropertyTable
+{
+public:
+    /**
+     * @brief Description of one property. Property
+     * is accessed through object, that's placed
+     * `offset` bytes after behaviour. Values of trivial
+     * properties (trivially copyable, not pointers)
+     * can be copied as `size` raw bytes.
+     */
+    struct Entry
+    {
+        using Setter = void (*)(HG::Core::Behaviour* behaviour, std::ptrdiff_t offset, const void* value);
+        using Getter = void (*)(const HG::Core::Behaviour* behaviour, std::ptrdiff_t offset, void* value);
+
+        std::string name;
+        std::string type;
+        const std::type_info* typeInfo;
+        std::ptrdiff_t offset;
+        Setter setter;
+        Getter getter;
+        std::size_t size;
+        bool trivial;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    PropertyTable();
+
+    // Disable copying
+    PropertyTable(const PropertyTable&) = delete;
+    PropertyTable& operator=(const PropertyTable&) = delete;
+
+    /**
+     * @brief Method for getting table of
+     * behaviour type.
+     * @tparam BehaviourType Behaviour type.
+     * @return Reference to table.
+     */
+    template <typename BehaviourType>
+    static PropertyTable& of()
+    {
+        static PropertyTable table;
+
+        return table;
+    }
+
+    /**
+     * @brief Method for adding property to table.
+     * Parent table is taken from first property.
+     * Thread safe.
+     * @param entry Property description.
+     * @param parent Table of base type or nullptr.
+     */
+    void add(Entry entry, const PropertyTable* parent);
+
+    /**
+     * @brief Method for searching for property in
+     * this table and parent tables.
+     * @param name Property name.
+     * @return Pointer to property description or nullptr.
+     */
+    [[nodiscard]] const Entry* find(std::string_view name) const;
+
+    /**
+     * @brief Method for getting table of base type.
+     * @return Pointer to table or nullptr.
+     */
+    [[nodiscard]] const PropertyTable* parent() const;
+
+    /**
+     * @brief Method for getting properties, declared
+     * by this type, in declaration order.
+     */
+    [[nodiscard]] const std::deque<Entry>& entries() const;
+
+private:
+    const PropertyTable* m_parent;
+
+    // Deque, because names index refers to entries
+    std::deque<Entry> m_entries;
+    std::unordered_map<std::string_view, const Entry*> m_names;
+
+    std::mutex m_mutex;
+};
+} // namespace HG::Core
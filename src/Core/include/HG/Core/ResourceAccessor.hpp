@@ -5,6 +5,9 @@
 #include <memory>
 #include <string>
 
+// HG::Utils
+#include <HG/Utils/FutureHandler.hpp>
+
 namespace HG::Core
 {
 class Data;
@@ -32,5 +35,17 @@ public:
      * @return Loaded data.
      */
     virtual HG::Core::DataPtr loadRaw(const std::string& id) = 0;
+
+    /**
+     * @brief Method for loading raw data without blocking.
+     * By default data is loaded with `loadRaw` in calling
+     * thread.
+     * @param id ID of resource.
+     * @return Handler for loaded data.
+     */
+    virtual HG::Utils::FutureHandler<HG::Core::DataPtr> loadRawAsync(const std::string& id)
+    {
+        return HG::Utils::FutureHandler<HG::Core::DataPtr>(loadRaw(id));
+    }
 };
 } // namespace HG::Core
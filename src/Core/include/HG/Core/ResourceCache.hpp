@@ -90,6 +90,77 @@ public:
         return resource;
     }
 
+    /**
+     * @brief Method for allocating memory for resources
+     * ahead. After this call at least `count` resources
+     * of type are taken from cache without allocation.
+     * Missing memory is allocated in one block.
+     * @tparam T Resource type.
+     * @param count Number of resources.
+     */
+    template <typename T>
+    void reserve(std::size_t count)
+    {
+        decltype(m_objects)::iterator cache;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            cache = m_objects.find(typeid(T).hash_code());
+        }
+
+        if (std::shared_lock<std::shared_mutex>(m_mutex), cache == m_objects.end())
+        {
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            cache = m_objects.insert(std::make_pair(typeid(T).hash_code(), TypeCache())).first;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(cache->second.mutex);
+
+        if (cache->second.available.size() >= count)
+        {
+            return;
+        }
+
+        auto missing = count - cache->second.available.size();
+
+        // Cached memory is never released, so
+        // block is not tracked as a whole
+        auto raw = new uint8_t[missing * sizeof(T)];
+
+        cache->second.available.reserve(count);
+
+        for (std::size_t index = 0; index < missing; ++index)
+        {
+            cache->second.available.insert(static_cast<CachableObject*>(static_cast<void*>(raw + index * sizeof(T))));
+        }
+    }
+
+    /**
+     * @brief Method for getting number of cached
+     * resources of type, that are available
+     * without allocation.
+     * @tparam T Resource type.
+     */
+    template <typename T>
+    [[nodiscard]] std::size_t availableResources() const
+    {
+        decltype(m_objects)::const_iterator cache;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            cache = m_objects.find(typeid(T).hash_code());
+        }
+
+        if (std::shared_lock<std::shared_mutex>(m_mutex), cache == m_objects.end())
+        {
+            return 0;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(cache->second.mutex);
+
+        return cache->second.available.size();
+    }
+
     /**
      * @brief Method for caching resource that was
      * create in current cache instance.
@@ -2,6 +2,7 @@
 
 // HG::Core
 #include <HG/Core/Application.hpp> // Required, because of template `load` method.
+#include <HG/Core/AssetCache.hpp>  // Required, because of template `load` method.
 #include <HG/Core/Data.hpp>        // Required, because of template `load` method.
 #include <HG/Core/ThreadPool.hpp>
 
@@ -9,9 +10,13 @@
 #include <HG/Utils/FutureHandler.hpp>
 
 // C++ STL
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <thread>
 
@@ -21,12 +26,32 @@ class ResourceAccessor;
 
 /**
  * @brief Class, that describes resource manager.
+ * Resources are loaded in two stages. Raw data is
+ * read by file loading threads, then it's decoded
+ * by user threads. So long decoding doesn't block
+ * reading of other resources. Each stage has it's
+ * own limit of simultaneously executed jobs, other
+ * jobs are waiting in stage queue.
+ *
+ * Results of loaders, that are shared pointers, are
+ * cached by resource id and loader type. So same
+ * resource is loaded once, while it's used or stays
+ * in HG::Core::AssetCache budget.
  */
 class ResourceManager
 {
     friend class Application;
 
 public:
+    /**
+     * @brief Resource loading stage.
+     */
+    enum class Stage
+    {
+        Reading,
+        Decoding
+    };
+
     // Disable copying
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
@@ -37,7 +62,9 @@ public:
     explicit ResourceManager(HG::Core::Application* parent);
 
     /**
-     * @brief Destructor.
+     * @brief Destructor. Waits for active loading jobs.
+     * Queued jobs are dropped, their handlers receive
+     * exception.
      */
     virtual ~ResourceManager();
 
@@ -54,6 +81,12 @@ public:
      */
     [[nodiscard]] HG::Core::ResourceAccessor* resourceAccessor() const;
 
+    /**
+     * @brief Method for getting cache of loaded assets.
+     * @return Pointer to asset cache.
+     */
+    [[nodiscard]] HG::Core::AssetCache* assetCache();
+
     /**
      * @brief Method for setting resource accessor for
      * resource manager. Implemented as template method
@@ -64,6 +97,43 @@ public:
      */
     void setResourceAccessor(HG::Core::ResourceAccessor* accessor);
 
+    /**
+     * @brief Method for setting maximum number of
+     * simultaneously executed stage jobs. For `Reading` stage
+     * it's number of reads in flight, that makes sense with
+     * asynchronous resource accessor. For `Decoding` stage
+     * it's number of user threads, that may be occupied
+     * by decoding.
+     * Can throw `std::invalid_argument` if concurrency is 0.
+     * @param stage Stage.
+     * @param concurrency Number of jobs.
+     */
+    void setStageConcurrency(Stage stage, std::size_t concurrency);
+
+    /**
+     * @brief Method for getting maximum number of
+     * simultaneously executed stage jobs.
+     * @param stage Stage.
+     * @return Number of jobs.
+     */
+    [[nodiscard]] std::size_t stageConcurrency(Stage stage) const;
+
+    /**
+     * @brief Method for getting number of stage jobs,
+     * that are waiting for execution.
+     * @param stage Stage.
+     * @return Number of jobs.
+     */
+    [[nodiscard]] std::size_t numberOfQueuedJobs(Stage stage) const;
+
+    /**
+     * @brief Method for getting number of stage jobs,
+     * that are executed now.
+     * @param stage Stage.
+     * @return Number of jobs.
+     */
+    [[nodiscard]] std::size_t numberOfActiveJobs(Stage stage) const;
+
     /**
      * @brief Method for loading some resource
      * with using of specified formatter.
@@ -85,33 +155,156 @@ public:
     template <typename Loader>
     typename HG::Utils::FutureHandler<typename Loader::ResultType> load(const std::string& id)
     {
-        return application()->threadPool()->push(
-            [this, id]() -> typename Loader::ResultType {
-                auto data = loadRawFromAccessor(id);
+        using ResultType           = typename Loader::ResultType;
+        constexpr bool IsCachable = HG::Core::IsCachableAsset<ResultType>::value;
+
+        // Decode function has to be copyable
+        auto promise = std::make_shared<HG::Utils::Promise<ResultType>>();
+        auto handler = promise->handler();
+
+        HG::Core::AssetCache::Key key{id, typeid(Loader)};
 
-                if (data == nullptr)
+        if constexpr (IsCachable)
+        {
+            using ElementType = typename ResultType::element_type;
+
+            std::shared_ptr<void> object;
+
+            switch (m_assetCache.lookup(
+                key, object, std::make_shared<HG::Utils::FutureHandler<ResultType>>(handler), promise))
+            {
+            case HG::Core::AssetCache::LookupResult::Found:
+                return HG::Utils::FutureHandler<ResultType>(std::static_pointer_cast<ElementType>(object));
+            case HG::Core::AssetCache::LookupResult::Pending:
+                return *std::static_pointer_cast<HG::Utils::FutureHandler<ResultType>>(object);
+            case HG::Core::AssetCache::LookupResult::Missing:
+                break;
+            }
+        }
+
+        loadInStages(id, [this, promise, key](HG::Core::DataPtr data) {
+            ResultType result = ResultType();
+
+            try
+            {
+                if (data != nullptr)
+                {
+                    Loader loader;
+
+                    result = loader.load(data->data(), data->size());
+                }
+            }
+            catch (...)
+            {
+                if constexpr (IsCachable)
                 {
-                    return nullptr;
+                    m_assetCache.complete(key, nullptr, 0);
                 }
 
-                Loader loader;
+                promise->setException(std::current_exception());
+                return;
+            }
 
-                return loader.load(data->data(), data->size());
-            },
-            HG::Core::ThreadPool::Type::FileLoadingThread);
+            if constexpr (IsCachable)
+            {
+                using ElementType = typename ResultType::element_type;
+
+                result = std::static_pointer_cast<ElementType>(
+                    m_assetCache.complete(key, std::move(result), data == nullptr ? 0 : data->size()));
+            }
+
+            promise->setValue(std::move(result));
+        });
+
+        return handler;
     }
 
 private:
+    using DecodeFunction = std::function<void(HG::Core::DataPtr)>;
+
+    struct StageData
+    {
+        StageData(HG::Core::ThreadPool::Type type, std::size_t maximum) :
+            threadType(type),
+            concurrency(maximum),
+            active(0),
+            waiting(),
+            mutex(),
+            idle()
+        {
+        }
+
+        HG::Core::ThreadPool::Type threadType;
+        std::size_t concurrency;
+        std::size_t active;
+        std::deque<HG::Core::ThreadPool::Job> waiting;
+        mutable std::mutex mutex;
+        std::condition_variable idle;
+    };
+
     /**
-     * @brief Method for loading data from accessor and
-     * log errors if smth will go wrong.
+     * @brief Object, that finishes stage job on
+     * destruction. So stage slot is released even
+     * if job was not completed normally.
+     */
+    class StageSlot
+    {
+    public:
+        StageSlot(ResourceManager* manager, StageData* stage);
+        ~StageSlot();
+
+        // Disable copying
+        StageSlot(const StageSlot&) = delete;
+        StageSlot& operator=(const StageSlot&) = delete;
+
+    private:
+        ResourceManager* m_manager;
+        StageData* m_stage;
+    };
+
+    /**
+     * @brief Method for reading resource on `Reading` stage
+     * and passing it to decode function on `Decoding` stage.
+     * Errors are logged and nullptr data is passed.
      * @param id Resource id for resource accessor.
-     * @return Pointer to raw data, or nullptr if
-     * some error acquired.
+     * @param decode Decode function.
      */
-    HG::Core::DataPtr loadRawFromAccessor(const std::string& id);
+    void loadInStages(const std::string& id, DecodeFunction decode);
+
+    /**
+     * @brief Method for starting stage job or placing
+     * it into stage queue, if stage is busy.
+     * @param stage Stage.
+     * @param job Job.
+     */
+    void enqueue(StageData& stage, HG::Core::ThreadPool::Job job);
+
+    /**
+     * @brief Method for releasing stage slot and
+     * starting next queued job.
+     * @param stage Stage.
+     */
+    void finish(StageData& stage);
+
+    /**
+     * @brief Method for dropping queued stage jobs
+     * and waiting for active ones.
+     * @param stage Stage.
+     */
+    void stop(StageData& stage);
+
+    /**
+     * @brief Method for getting stage data.
+     */
+    StageData& stageData(Stage stage);
+    const StageData& stageData(Stage stage) const;
 
     HG::Core::ResourceAccessor* m_accessor;
     HG::Core::Application* m_application;
+
+    HG::Core::AssetCache m_assetCache;
+
+    StageData m_readingStage;
+    StageData m_decodingStage;
 };
 } // namespace HG::Core
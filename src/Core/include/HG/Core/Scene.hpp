@@ -2,10 +2,25 @@
 
 // C++ STL
 #include <chrono>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/ComponentStorage.hpp>
+#include <HG/Core/Handle.hpp>
+#include <HG/Core/TransformPool.hpp>
 
 // HG::Utils
 #include <HG/Utils/DoubleBufferContainer.hpp>
+#include <HG/Utils/TypeId.hpp>
 
 namespace HG::Rendering::Base
 {
@@ -17,6 +32,7 @@ namespace HG::Core
 // Forward definition
 class Application;
 class GameObject;
+class Behaviour;
 
 /**
  * @brief Class, that describes
@@ -63,6 +79,15 @@ public:
 
     /**
      * @brief Method, that's called every frame.
+     * At first behaviours with serial update mode are
+     * updated in gameobjects order. After that behaviours with
+     * concurrent update mode are updated on thread pool user threads
+     * in chunks. Structural changes, made during concurrent update,
+     * are buffered per chunk and applied in chunks order after
+     * all concurrent behaviours are updated. After that systems
+     * update behaviours of registered types. (See
+     * `registerSystem`) At last gameobjects and behaviours,
+     * removed since previous frame end, are deleted in one pass.
      */
     void update();
 
@@ -79,7 +104,11 @@ public:
 
     /**
      * @brief Method for removing gameobject
-     * from scene.
+     * from scene. Gameobject is detached from scene and
+     * it's handle becomes outdated right away, but it's
+     * deleted (cached) with it's behaviours at the end of
+     * frame, so raw pointers to them stay valid until then.
+     * Removed gameobject can't be added to scene again.
      * @param gameObject GameObject.
      */
     void removeGameObject(HG::Core::GameObject* gameObject);
@@ -93,8 +122,63 @@ public:
      */
     void addGameObject(HG::Core::GameObject* gameObject);
 
+    /**
+     * @brief Method for adding several gameobjects
+     * at once. Space for gameobjects is reserved once
+     * and during concurrent update only one change
+     * is deferred.
+     * @param gameObjects Pointers to gameobjects.
+     */
+    void addGameObjects(const std::vector<HG::Core::GameObject*>& gameObjects);
+
+    /**
+     * @brief Method for adding gameobjects as named
+     * sub-scene (chunk), that can be removed at once
+     * with `removeSubScene`. Can throw `std::invalid_argument`
+     * if sub-scene with same name is loaded already.
+     * @param name Sub-scene name.
+     * @param gameObjects Pointers to gameobjects.
+     */
+    void addSubScene(const std::string& name, const std::vector<HG::Core::GameObject*>& gameObjects);
+
+    /**
+     * @brief Method for removing gameobjects of sub-scene,
+     * that are still in scene. Unknown names are ignored.
+     * @param name Sub-scene name.
+     */
+    void removeSubScene(const std::string& name);
+
+    /**
+     * @brief Method for checking is sub-scene loaded.
+     * @param name Sub-scene name.
+     */
+    [[nodiscard]] bool hasSubScene(const std::string& name) const;
+
+    /**
+     * @brief Method for resolving gameobject handle.
+     * See HG::Core::GameObject::handle.
+     * @param handle Gameobject handle.
+     * @return Pointer to gameobject or nullptr if
+     * gameobject was removed from scene.
+     */
+    [[nodiscard]] HG::Core::GameObject* gameObject(HG::Core::Handle<HG::Core::GameObject> handle) const;
+
+    /**
+     * @brief Method for resolving behaviour handle.
+     * See HG::Core::Behaviour::handle.
+     * @param handle Behaviour handle.
+     * @return Pointer to behaviour or nullptr if
+     * behaviour was removed from gameobject or scene.
+     */
+    [[nodiscard]] HG::Core::Behaviour* behaviour(HG::Core::Handle<HG::Core::Behaviour> handle) const;
+
     /**
      * @brief Method for searching for gameobject by name.
+     * Gameobjects are indexed by name, so search
+     * doesn't depend on number of gameobjects. If several
+     * gameobjects have same name, first added one is returned.
+     * Gameobjects, added on current frame, are not found
+     * until next `update`.
      * @param name Gameobject name.
      * @return Pointer to found game object or nullptr if
      * game object was not found.
@@ -103,17 +187,148 @@ public:
 
     /**
      * @brief Method for searching several objects by name.
+     * Gameobjects are returned in adding order.
      * @param name Game Object name.
      * @param container Container for results.
      */
     void findGameObjects(const std::string& name, std::vector<HG::Core::GameObject*>& container) const;
 
+    /**
+     * @brief Method for searching objects by tag.
+     * @param tag Gameobject tag.
+     * @param container Container for results.
+     */
+    void findGameObjectsWithTag(const std::string& tag, std::vector<HG::Core::GameObject*>& container) const;
+
+    /**
+     * @brief Method for searching objects by layer.
+     * @param layer Gameobject layer.
+     * @param container Container for results.
+     */
+    void findGameObjectsInLayer(std::uint32_t layer, std::vector<HG::Core::GameObject*>& container) const;
+
+    /**
+     * @brief Method for executing function for every
+     * not hidden gameobject with tag. Function can't
+     * change tags of gameobjects or add and remove them.
+     * @param tag Gameobject tag.
+     * @param function Function.
+     */
+    void forEachWithTag(const std::string& tag, const std::function<void(HG::Core::GameObject*)>& function) const;
+
+    /**
+     * @brief Method for executing function for every
+     * not hidden gameobject in layer. Function can't
+     * change layers of gameobjects or add and remove them.
+     * @param layer Gameobject layer.
+     * @param function Function.
+     */
+    void forEachInLayer(std::uint32_t layer, const std::function<void(HG::Core::GameObject*)>& function) const;
+
     /**
      * @brief Method for getting all active gameobjects.
      * @param container Container object.
      */
     void getGameObjects(std::vector<GameObject*>& container) const;
 
+    /**
+     * @brief Method for setting number of concurrent behaviours,
+     * updated by one thread pool job.
+     * @param size Chunk size. Can't be 0.
+     */
+    void setConcurrentUpdateChunkSize(std::size_t size);
+
+    /**
+     * @brief Method for getting number of concurrent behaviours,
+     * updated by one thread pool job.
+     * @return Chunk size.
+     */
+    [[nodiscard]] std::size_t concurrentUpdateChunkSize() const;
+
+    /**
+     * @brief Method for enabling storing transforms of
+     * scene gameobjects in transform pool. If enabled, dirty
+     * transforms are recalculated in one pass at the end of
+     * `update`. Disabled by default.
+     * @param enabled Is transform pool enabled.
+     */
+    void setTransformPoolEnabled(bool enabled);
+
+    /**
+     * @brief Method for checking is transform
+     * pool enabled.
+     */
+    [[nodiscard]] bool isTransformPoolEnabled() const;
+
+    /**
+     * @brief Method for getting transform pool of scene.
+     * @return Reference to transform pool.
+     */
+    [[nodiscard]] HG::Core::TransformPool& transformPool();
+
+    /**
+     * @brief Method for getting component storage of
+     * behaviour type. Storage is created on first call,
+     * after that it's system is updated every frame.
+     * Thread safe.
+     * @tparam BehaviourType Type of behaviour, derived
+     * from HG::Core::ComponentBehaviour.
+     * @return Pointer to storage.
+     */
+    template <typename BehaviourType>
+    HG::Core::ComponentStorage<BehaviourType>* componentStorage()
+    {
+        std::unique_lock<std::mutex> lock(m_componentStoragesMutex);
+
+        auto iterator = m_componentStoragesIndex.find(HG::Utils::TypeId::get<BehaviourType>());
+
+        if (iterator != m_componentStoragesIndex.end())
+        {
+            return static_cast<HG::Core::ComponentStorage<BehaviourType>*>(iterator->second);
+        }
+
+        auto storage = new HG::Core::ComponentStorage<BehaviourType>();
+
+        m_componentStorages.emplace_back(storage);
+        m_componentStoragesIndex[HG::Utils::TypeId::get<BehaviourType>()] = storage;
+
+        return storage;
+    }
+
+    /**
+     * @brief Method for registering system, that
+     * updates all behaviours of type in storage order.
+     * Systems are updated in registration order after
+     * gameobjects. Can throw `std::invalid_argument` if
+     * mode is `Behaviour::UpdateMode::System`.
+     * @tparam BehaviourType Type of behaviour, derived
+     * from HG::Core::ComponentBehaviour.
+     * @param mode Is system updated serially or
+     * concurrently.
+     */
+    template <typename BehaviourType>
+    void registerSystem(HG::Core::Behaviour::UpdateMode mode = HG::Core::Behaviour::UpdateMode::Serial)
+    {
+        componentStorage<BehaviourType>()->setSystemUpdateMode(mode);
+    }
+
+    /**
+     * @brief Method for checking is calling thread
+     * executing concurrent behaviours update now.
+     */
+    [[nodiscard]] static bool isConcurrentUpdate();
+
+    /**
+     * @brief Method for deferring structural change (adding or
+     * removing gameobjects or behaviours), that's requested from
+     * concurrent behaviours update. Change will be applied after
+     * all concurrent behaviours are updated.
+     * Can throw `std::runtime_error` if called not from concurrent
+     * update.
+     * @param change Change function.
+     */
+    static void deferStructuralChange(std::function<void()> change);
+
     /**
      * @brief Method for registrating resource
      * for deleting after scene delete.
@@ -130,8 +345,170 @@ public:
     }
 
 private:
+    friend class GameObject;
+    friend class SceneSnapshot;
+
+    // Gameobjects of index bucket by adding order
+    using IndexBucket = std::map<std::uint64_t, HG::Core::GameObject*>;
+
+    /**
+     * @brief Class, that describes index of gameobjects
+     * by attribute value. Buckets are ordered by number
+     * of gameobject adding, so gameobjects are found in
+     * same order, they are updated in. Gameobject is
+     * added and removed in O(log n).
+     */
+    template <typename Key>
+    class Index
+    {
+    public:
+        Index() : m_buckets()
+        {
+        }
+
+        void add(const Key& key, HG::Core::GameObject* gameObject, std::uint64_t order)
+        {
+            m_buckets[key].emplace(order, gameObject);
+        }
+
+        void remove(const Key& key, std::uint64_t order)
+        {
+            auto iterator = m_buckets.find(key);
+
+            if (iterator == m_buckets.end())
+            {
+                return;
+            }
+
+            iterator->second.erase(order);
+
+            if (iterator->second.empty())
+            {
+                m_buckets.erase(iterator);
+            }
+        }
+
+        [[nodiscard]] const IndexBucket* find(const Key& key) const
+        {
+            auto iterator = m_buckets.find(key);
+
+            if (iterator == m_buckets.end())
+            {
+                return nullptr;
+            }
+
+            return &iterator->second;
+        }
+
+    private:
+        std::unordered_map<Key, IndexBucket> m_buckets;
+    };
+
+    /**
+     * @brief Method for adding gameobject to
+     * name, tag and layer indices.
+     */
+    void indexGameObject(HG::Core::GameObject* gameObject);
+
+    /**
+     * @brief Method for removing gameobject from
+     * name, tag and layer indices.
+     */
+    void unindexGameObject(HG::Core::GameObject* gameObject);
+
+    /**
+     * @brief Method for executing function for not hidden
+     * gameobjects of index bucket, that were added before
+     * last `update`.
+     */
+    void forEachVisible(const IndexBucket* bucket, const std::function<void(HG::Core::GameObject*)>& function) const;
+
+    /**
+     * @brief Method for issuing handle
+     * to attached behaviour.
+     */
+    void registerBehaviour(HG::Core::Behaviour* behaviour);
+
+    /**
+     * @brief Method for deleting gameobjects and
+     * behaviours, removed since previous call.
+     */
+    void destroyRemoved();
+
+    /**
+     * @brief Method for updating concurrent behaviours,
+     * collected by serial update.
+     */
+    void updateConcurrentBehaviours();
+
+    /**
+     * @brief Method for updating systems
+     * of component storages.
+     */
+    void updateSystems();
+
+    /**
+     * @brief Method for recalculating cache of dirty
+     * transforms, so reading global values during
+     * concurrent update doesn't change transforms.
+     */
+    void refreshTransforms();
+
+    /**
+     * @brief Method for executing function for range
+     * split in chunks on thread pool user threads.
+     * Dirty transforms are refreshed before.
+     * Structural changes are buffered per chunk and
+     * applied in chunks order.
+     * @param size Number of elements.
+     * @param function Function, that takes first and
+     * after last indices of chunk.
+     */
+    void updateConcurrently(std::size_t size, const std::function<void(std::size_t, std::size_t)>& function);
+
     HG::Core::Application* m_mainApplication;
     GameObjectsContainer m_gameObjects;
     std::vector<std::function<void()>> m_deleteExecutors;
+
+    // Concurrent behaviours of current frame and
+    // gameobjects, that owns them. (Owner and index after
+    // last owned behaviour)
+    std::vector<HG::Core::Behaviour*> m_concurrentBehaviours;
+    std::vector<std::pair<HG::Core::GameObject*, std::size_t>> m_concurrentOwners;
+
+    // Structural changes for every chunk
+    std::vector<std::vector<std::function<void()>>> m_deferredChanges;
+
+    std::size_t m_concurrentChunkSize;
+
+    HG::Core::TransformPool m_transformPool;
+    bool m_transformPoolEnabled;
+
+    Index<std::string> m_nameIndex;
+    Index<std::string> m_tagIndex;
+    Index<std::uint32_t> m_layerIndex;
+
+    // Number of next adding and first adding
+    // after last merge of gameobjects
+    std::uint64_t m_nextOrder;
+    std::uint64_t m_mergedOrder;
+
+    HG::Core::HandleTable<HG::Core::GameObject> m_gameObjectHandles;
+    HG::Core::HandleTable<HG::Core::Behaviour> m_behaviourHandles;
+
+    // Removed gameobjects and gameobjects with removed
+    // behaviours, that are deleted at the end of frame
+    std::vector<HG::Core::GameObject*> m_destroyedGameObjects;
+    std::vector<HG::Core::GameObject*> m_behaviourRemovals;
+
+    // Gameobjects of loaded sub-scenes. Handles are kept,
+    // because gameobjects may be removed separately
+    std::unordered_map<std::string, std::vector<HG::Core::Handle<HG::Core::GameObject>>> m_subScenes;
+
+    // Storages in systems update order and
+    // storages by behaviour type id
+    std::vector<std::unique_ptr<HG::Core::ComponentStorageBase>> m_componentStorages;
+    std::unordered_map<std::size_t, HG::Core::ComponentStorageBase*> m_componentStoragesIndex;
+    std::mutex m_componentStoragesMutex;
 };
 } // namespace HG::Core
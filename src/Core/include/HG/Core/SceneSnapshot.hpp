@@ -0,0 +1,293 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/ComponentBehaviour.hpp>
+#include <HG/Core/PropertyTable.hpp>
+
+namespace HG::Core
+{
+class Behaviour;
+class GameObject;
+class ResourceCache;
+class Scene;
+
+class SceneSnapshot;
+using SceneSnapshotPtr = std::shared_ptr<SceneSnapshot>;
+
+/**
+ * @brief Class, that describes binary image of scene:
+ * gameobjects, transforms hierarchy, behaviours with their
+ * reflected properties and ids of referenced resources.
+ *
+ * Image is laid out as header and arrays of fixed size
+ * records, that refer each other and strings by index.
+ * It's read with one read (or mapped) and records are used
+ * in place: loading only validates image and fixes up
+ * section offsets into pointers. Image is little endian.
+ *
+ * Behaviour types have to be registered with
+ * `registerBehaviour`. Trivially copyable properties are
+ * stored as raw bytes, other property types have to be
+ * registered with `registerPropertyType` or, for references
+ * to resources, with `registerResourceType`. Unregistered
+ * behaviours and properties are skipped on capture.
+ *
+ * Snapshot can be loaded and instantiated on thread pool
+ * before scene is set to application:
+ * @code{.cpp}
+ * application->resourceManager()
+ *     ->load<HG::Core::SceneSnapshotLoader>("Levels/1.hgscene")
+ *     .then([cache](HG::Core::SceneSnapshotPtr snapshot) {
+ *         auto scene = new HG::Core::Scene;
+ *         snapshot->instantiate(scene, cache);
+ *         return scene;
+ *     })
+ *     .then([application](HG::Core::Scene* scene) { application->setScene(scene); },
+ *           application->mainThreadQueue());
+ * @endcode
+ */
+class SceneSnapshot
+{
+public:
+    static constexpr std::uint32_t Version = 2;
+
+    using BehaviourFactory = std::function<HG::Core::Behaviour*(HG::Core::Scene*)>;
+
+    /**
+     * @brief Constructor. Can throw `std::runtime_error`
+     * if data is not valid snapshot image of current version.
+     * @param data Snapshot image.
+     */
+    explicit SceneSnapshot(std::vector<std::byte> data);
+
+    // Disable copying
+    SceneSnapshot(const SceneSnapshot&) = delete;
+    SceneSnapshot& operator=(const SceneSnapshot&) = delete;
+
+    /**
+     * @brief Method for creating snapshot image of
+     * all scene gameobjects, including hidden ones and
+     * added on current frame.
+     * @param scene Pointer to scene.
+     * @return Snapshot image.
+     */
+    [[nodiscard]] static std::vector<std::byte> capture(HG::Core::Scene* scene);
+
+    /**
+     * @brief Method for creating gameobjects of snapshot
+     * and adding them to scene. It can be called from any
+     * thread, if scene is not used by other threads yet.
+     * Gameobjects, created before exception, are deleted.
+     * Can throw `std::runtime_error` if behaviour type is
+     * not registered.
+     * @param scene Pointer to scene.
+     * @param cache Cache, gameobjects are allocated in.
+     */
+    void instantiate(HG::Core::Scene* scene, HG::Core::ResourceCache* cache) const;
+
+    /**
+     * @brief Method for creating gameobjects of snapshot
+     * without adding them to scene, for example to add
+     * them as sub-scene. Scene is used for allocating
+     * component behaviours. Gameobjects, created before
+     * exception, are deleted. Can throw `std::runtime_error`
+     * if behaviour type is not registered.
+     * @param scene Pointer to scene.
+     * @param cache Cache, gameobjects are allocated in.
+     * @param gameObjects Container, that receives created
+     * gameobjects. Parents are placed before children.
+     */
+    void create(HG::Core::Scene* scene,
+                HG::Core::ResourceCache* cache,
+                std::vector<HG::Core::GameObject*>& gameObjects) const;
+
+    /**
+     * @brief Method for getting number of
+     * gameobjects in snapshot.
+     */
+    [[nodiscard]] std::size_t numberOfGameObjects() const;
+
+    /**
+     * @brief Method for getting ids of resources,
+     * referenced by behaviour properties. It can be
+     * used to load resources before instantiation.
+     */
+    [[nodiscard]] const std::vector<std::string_view>& resources() const;
+
+    /**
+     * @brief Method for registering behaviour type,
+     * that's created with default constructor. Thread safe.
+     * @tparam BehaviourType Behaviour type.
+     * @param name Unique name, that's stored in snapshot.
+     */
+    template <typename BehaviourType>
+    static void registerBehaviour(std::string name)
+    {
+        registerBehaviour(typeid(BehaviourType), std::move(name), &HG::Core::createBehaviour<BehaviourType>);
+    }
+
+    /**
+     * @brief Method for registering behaviour type.
+     * Thread safe.
+     * @param type Behaviour type.
+     * @param name Unique name, that's stored in snapshot.
+     * @param factory Function, that creates behaviour.
+     */
+    static void registerBehaviour(const std::type_info& type, std::string name, BehaviourFactory factory);
+
+    /**
+     * @brief Method for registering not trivially
+     * copyable property type. Thread safe.
+     * @tparam Type Property type.
+     * @param encode Function, that converts value to bytes.
+     * @param decode Function, that restores value from bytes.
+     */
+    template <typename Type>
+    static void registerPropertyType(std::function<std::string(const Type&)> encode,
+                                     std::function<Type(std::string_view)> decode)
+    {
+        registerCodec(typeid(Type), false, makeCodec<Type>(std::move(encode), std::move(decode)));
+    }
+
+    /**
+     * @brief Method for registering property type, that
+     * references resource. Resource ids are stored in
+     * resources table of snapshot. Thread safe.
+     * @tparam Type Property type. (Usually pointer
+     * to resource)
+     * @param id Function, that returns id of resource.
+     * @param resolve Function, that returns resource by id.
+     */
+    template <typename Type>
+    static void registerResourceType(std::function<std::string(const Type&)> id,
+                                     std::function<Type(std::string_view)> resolve)
+    {
+        registerCodec(typeid(Type), true, makeCodec<Type>(std::move(id), std::move(resolve)));
+    }
+
+private:
+    struct Registry;
+    struct Header;
+    struct StringRecord;
+    struct GameObjectRecord;
+    struct BehaviourRecord;
+    struct PropertyRecord;
+
+    /**
+     * @brief Functions, that convert property
+     * value to bytes and back.
+     */
+    struct Codec
+    {
+        bool resource;
+        std::function<std::string(const HG::Core::Behaviour*, const HG::Core::PropertyTable::Entry&)> save;
+        std::function<void(HG::Core::Behaviour*, const HG::Core::PropertyTable::Entry&, std::string_view)> load;
+    };
+
+    template <typename Type>
+    static Codec makeCodec(std::function<std::string(const Type&)> encode, std::function<Type(std::string_view)> decode)
+    {
+        Codec codec{};
+
+        codec.save = [encode = std::move(encode)](const HG::Core::Behaviour* behaviour,
+                                                  const HG::Core::PropertyTable::Entry& entry) {
+            Type value{};
+            entry.getter(behaviour, entry.offset, &value);
+
+            return encode(value);
+        };
+
+        codec.load = [decode = std::move(decode)](HG::Core::Behaviour* behaviour,
+                                                  const HG::Core::PropertyTable::Entry& entry,
+                                                  std::string_view data) {
+            Type value = decode(data);
+            entry.setter(behaviour, entry.offset, &value);
+        };
+
+        return codec;
+    }
+
+    /**
+     * @brief Method for getting registered
+     * behaviours and property types.
+     */
+    static Registry& registry();
+
+    /**
+     * @brief Method for registering property codec.
+     */
+    static void registerCodec(const std::type_info& type, bool resource, Codec codec);
+
+    /**
+     * @brief Method for searching for codec of type.
+     * Returned codec is never removed.
+     * @return Pointer to codec or nullptr.
+     */
+    static const Codec* findCodec(const std::type_info& type);
+
+    /**
+     * @brief Method for searching for behaviour factory
+     * by name. Returned factory is never removed.
+     * @return Pointer to factory or nullptr.
+     */
+    static const BehaviourFactory* findFactory(std::string_view name);
+
+    /**
+     * @brief Method for searching for registered
+     * name of behaviour type.
+     * @return Pointer to name or nullptr.
+     */
+    static const std::string* findName(const std::type_info& type);
+
+    /**
+     * @brief Method for checking image and
+     * fixing up pointers to it's sections.
+     */
+    void fixUp();
+
+    std::vector<std::byte> m_data;
+
+    // Pointers to sections of image
+    const Header* m_header;
+    const GameObjectRecord* m_gameObjects;
+    const BehaviourRecord* m_behaviours;
+    const PropertyRecord* m_properties;
+    const std::byte* m_blob;
+
+    std::vector<std::string_view> m_strings;
+    std::vector<std::string_view> m_resources;
+};
+
+/**
+ * @brief Scene snapshot loader for resource manager.
+ * Image is validated on user thread.
+ */
+class SceneSnapshotLoader
+{
+public:
+    using ResultType = SceneSnapshotPtr;
+
+    /**
+     * @brief Constructor.
+     */
+    SceneSnapshotLoader();
+
+    /**
+     * @brief Method for loading snapshot from raw data.
+     * @param data Pointer to data.
+     * @param size Amount of data.
+     * @return Loaded snapshot or nullptr if error acquired.
+     */
+    ResultType load(const std::byte* data, std::size_t size);
+};
+} // namespace HG::Core
@@ -0,0 +1,292 @@
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/MainThreadDispatcher.hpp>
+#include <HG/Core/SceneSnapshot.hpp>
+
+namespace HG::Core
+{
+class ResourceCache;
+class Scene;
+class ThreadPool;
+
+class SceneLoading;
+using SceneLoadingPtr = std::shared_ptr<SceneLoading>;
+
+/**
+ * @brief Class, that describes scene or sub-scene,
+ * prepared in background. Preparation function
+ * receives it to report progress and to stage main
+ * thread jobs (like GPU uploads). Loading becomes
+ * ready only after preparation is finished and
+ * all staged jobs are executed. Has to be created
+ * with `std::make_shared`. Thread safe.
+ */
+class SceneLoading : public std::enable_shared_from_this<SceneLoading>
+{
+public:
+    enum class State
+    {
+        Preparing, // Preparation function is executed
+        Staging,   // Staged main thread jobs are executed
+        Ready,     // Waiting for scene swap or sub-scene adding
+        Finished,
+        Failed,
+        Cancelled
+    };
+
+    /**
+     * @brief Constructor.
+     * @param dispatcher Dispatcher for staged jobs.
+     */
+    explicit SceneLoading(HG::Core::MainThreadDispatcher* dispatcher);
+
+    // Disable copying
+    SceneLoading(const SceneLoading&) = delete;
+    SceneLoading& operator=(const SceneLoading&) = delete;
+
+    /**
+     * @brief Destructor. Prepared scene, that was
+     * not taken, is deleted.
+     */
+    ~SceneLoading();
+
+    /**
+     * @brief Method for getting loading state.
+     */
+    [[nodiscard]] State state() const;
+
+    /**
+     * @brief Method for setting preparation progress.
+     * Value is clamped to [0, 1].
+     * @param progress Progress.
+     */
+    void setProgress(float progress);
+
+    /**
+     * @brief Method for getting loading progress in
+     * [0, 1]. It's set by preparation function and
+     * becomes 1 when loading is ready.
+     */
+    [[nodiscard]] float progress() const;
+
+    /**
+     * @brief Method for staging job, that has to be executed
+     * in main thread, like uploading data to GPU. Jobs are
+     * executed by main thread dispatcher within it's frame
+     * budget. Jobs of cancelled loading are not staged
+     * and staged ones are skipped.
+     * @param job Job.
+     * @param priority Job priority.
+     */
+    void dispatch(HG::Core::MainThreadDispatcher::Job job,
+                  HG::Core::MainThreadDispatcher::Priority priority =
+                      HG::Core::MainThreadDispatcher::Priority::Normal);
+
+    /**
+     * @brief Method for getting number of staged
+     * jobs, that are not executed yet.
+     */
+    [[nodiscard]] std::size_t numberOfPendingJobs() const;
+
+    /**
+     * @brief Method for cancelling loading. Preparation
+     * function can check it with `isCancelled` to stop
+     * early. Prepared scene is deleted.
+     */
+    void cancel();
+
+    /**
+     * @brief Method for checking is loading cancelled.
+     */
+    [[nodiscard]] bool isCancelled() const;
+
+    /**
+     * @brief Method for getting exception, loading was
+     * failed with. State has to be `Failed`.
+     */
+    [[nodiscard]] std::exception_ptr exception() const;
+
+private:
+    friend class SceneStreamer;
+
+    /**
+     * @brief Method for finishing loading with exception.
+     */
+    void fail(std::exception_ptr exception);
+
+    HG::Core::MainThreadDispatcher* m_dispatcher;
+
+    std::atomic<float> m_progress;
+    std::atomic_size_t m_pendingJobs;
+
+    std::atomic_bool m_prepared;
+    std::atomic_bool m_finished;
+    std::atomic_bool m_failed;
+    std::atomic_bool m_cancelled;
+
+    // Set before `m_prepared` or `m_failed`
+    std::exception_ptr m_exception;
+
+    // Result of scene loading
+    HG::Core::Scene* m_scene;
+
+    // Target and result of sub-scene loading
+    HG::Core::Scene* m_target;
+    std::string m_name;
+    HG::Core::SceneSnapshotPtr m_snapshot;
+};
+
+/**
+ * @brief Class, that prepares scenes and sub-scenes
+ * on thread pool, so objects construction, assets
+ * loading and decoding don't stall main thread.
+ * Application checks loadings once per frame: prepared
+ * scene replaces current one and sub-scenes are added
+ * to scene, they were loaded for. Methods have to be
+ * called from main thread.
+ *
+ * Sample usage:
+ * ```cpp
+ * auto loading = application->sceneStreamer()->loadScene(
+ *     [application](HG::Core::SceneLoading& loading) {
+ *         auto scene = new Level;
+ *         auto mesh = application->resourceManager()
+ *             ->load<HG::Utils::AssimpLoader>("Models/level.obj")
+ *             .guaranteeGet();
+ *         loading.setProgress(0.5f);
+ *         loading.dispatch([mesh]() { upload(mesh); });
+ *         return scene;
+ *     });
+ *
+ * // Open world chunk
+ * application->sceneStreamer()->loadSubScene(
+ *     application->scene(), "Chunk_3_4",
+ *     [application](HG::Core::SceneLoading&) {
+ *         return application->resourceManager()
+ *             ->load<HG::Core::SceneSnapshotLoader>("Chunks/3_4.hgscene")
+ *             .guaranteeGet();
+ *     });
+ *
+ * application->scene()->removeSubScene("Chunk_2_4");
+ * ```
+ */
+class SceneStreamer
+{
+public:
+    using ScenePreparation    = std::function<HG::Core::Scene*(HG::Core::SceneLoading&)>;
+    using SubScenePreparation = std::function<HG::Core::SceneSnapshotPtr(HG::Core::SceneLoading&)>;
+
+    /**
+     * @brief Constructor.
+     * @param threadPool Pool, preparation is executed on.
+     * @param dispatcher Dispatcher for staged jobs.
+     */
+    SceneStreamer(HG::Core::ThreadPool* threadPool, HG::Core::MainThreadDispatcher* dispatcher);
+
+    // Disable copying
+    SceneStreamer(const SceneStreamer&) = delete;
+    SceneStreamer& operator=(const SceneStreamer&) = delete;
+
+    /**
+     * @brief Destructor. Pending loadings are cancelled
+     * and running preparations are waited for, so they
+     * don't outlive dispatcher and resources they use.
+     */
+    ~SceneStreamer();
+
+    /**
+     * @brief Method for preparing scene on thread pool
+     * user thread. Scene is not used by other threads until
+     * it's ready, so preparation can build it completely.
+     * Previous pending scene loading is cancelled.
+     * @param preparation Function, that creates scene.
+     * @return Loading.
+     */
+    HG::Core::SceneLoadingPtr loadScene(ScenePreparation preparation);
+
+    /**
+     * @brief Method for loading sub-scene on thread pool user
+     * thread. Preparation loads snapshot of sub-scene and
+     * it's resources, gameobjects are created from snapshot
+     * in main thread and added as sub-scene, when loading is
+     * ready. Can throw `std::invalid_argument` if sub-scene
+     * is loaded or loading already.
+     * @param scene Scene, sub-scene is added to.
+     * @param name Sub-scene name.
+     * @param preparation Function, that loads snapshot.
+     * @return Loading.
+     */
+    HG::Core::SceneLoadingPtr loadSubScene(HG::Core::Scene* scene, std::string name, SubScenePreparation preparation);
+
+    /**
+     * @brief Method for cancelling pending scene loading.
+     */
+    void cancelScene();
+
+    /**
+     * @brief Method for cancelling sub-scene loadings into
+     * scene. Has to be called before scene deletion.
+     * @param scene Pointer to scene.
+     */
+    void cancelSubScenes(HG::Core::Scene* scene);
+
+    /**
+     * @brief Method for taking scene, that's ready.
+     * Failed loading is logged and dropped.
+     * @return Pointer to scene or nullptr if there
+     * is no ready scene.
+     */
+    [[nodiscard]] HG::Core::Scene* takeReadyScene();
+
+    /**
+     * @brief Method for adding ready sub-scenes to scene.
+     * Failed loadings are logged and dropped.
+     * @param scene Pointer to scene.
+     * @param cache Cache, gameobjects are allocated in.
+     */
+    void proceedSubScenes(HG::Core::Scene* scene, HG::Core::ResourceCache* cache);
+
+    /**
+     * @brief Method for getting number of
+     * pending scene and sub-scene loadings.
+     */
+    [[nodiscard]] std::size_t numberOfLoadings() const;
+
+private:
+    /**
+     * @brief Running preparations, shared with pool
+     * jobs, because queued job may outlive streamer.
+     */
+    struct Preparations
+    {
+        std::mutex mutex;
+        std::condition_variable notifier;
+        std::size_t running = 0;
+    };
+
+    /**
+     * @brief Method for executing preparation
+     * on thread pool.
+     */
+    void prepare(HG::Core::SceneLoadingPtr loading, std::function<void(HG::Core::SceneLoading&)> preparation);
+
+    HG::Core::ThreadPool* m_threadPool;
+    HG::Core::MainThreadDispatcher* m_dispatcher;
+
+    HG::Core::SceneLoadingPtr m_sceneLoading;
+    std::vector<HG::Core::SceneLoadingPtr> m_subSceneLoadings;
+
+    std::shared_ptr<Preparations> m_preparations;
+};
+} // namespace HG::Core
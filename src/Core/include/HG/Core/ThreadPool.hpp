@@ -1,12 +1,21 @@
 #pragma once
 
 // C++ STL
-#include <functional>
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <shared_mutex>
 #include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 // HG::Utils
 #include <HG/Utils/FutureHandler.hpp>
@@ -18,6 +27,14 @@ namespace HG::Core
  * By default it starts 1 file loading thread,
  * and (N - 2) user threads, for user tasks. Where N
  * is number of system cores. (at least 1 user thread)
+ *
+ * Every pool thread owns it's own jobs deques. Jobs pushed
+ * from pool thread are placed into it's own deque (and executed
+ * in LIFO order for better cache locality), jobs pushed from
+ * outside are distributed between threads and executed in FIFO
+ * order, so older requests are not starved. Idle threads are
+ * stealing jobs from other threads deques. Only one sleeping
+ * thread is woken up per pushed job.
  */
 class ThreadPool
 {
@@ -29,6 +46,186 @@ public:
         UserThread
     };
 
+    /**
+     * @brief Class, that describes type erased
+     * `void()` job. Small callables are stored
+     * inside job object without heap allocation.
+     */
+    class Job
+    {
+    public:
+        // Size of inplace storage for callables
+        static constexpr std::size_t StorageSize = 64;
+
+        /**
+         * @brief Default constructor. Creates empty job.
+         */
+        Job() noexcept : m_storage(), m_operations(nullptr)
+        {
+        }
+
+        /**
+         * @brief Initializer constructor.
+         * @tparam FunctionType Callable type.
+         * @param function Callable object.
+         */
+        template <typename FunctionType,
+                  typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctionType>, Job>>>
+        Job(FunctionType&& function) : m_storage(), m_operations(nullptr) // NOLINT
+        {
+            using StoredType = std::decay_t<FunctionType>;
+
+            if constexpr (isInplace<StoredType>())
+            {
+                new (&m_storage) StoredType(std::forward<FunctionType>(function));
+            }
+            else
+            {
+                new (&m_storage) StoredType*(new StoredType(std::forward<FunctionType>(function)));
+            }
+
+            m_operations = &operationsFor<StoredType>;
+        }
+
+        /**
+         * @brief Move constructor.
+         */
+        Job(Job&& rhs) noexcept : m_storage(), m_operations(rhs.m_operations)
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->move(&m_storage, &rhs.m_storage);
+                rhs.m_operations = nullptr;
+            }
+        }
+
+        /**
+         * @brief Move operator.
+         */
+        Job& operator=(Job&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                reset();
+
+                m_operations = rhs.m_operations;
+
+                if (m_operations != nullptr)
+                {
+                    m_operations->move(&m_storage, &rhs.m_storage);
+                    rhs.m_operations = nullptr;
+                }
+            }
+
+            return (*this);
+        }
+
+        // Disable copying
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        /**
+         * @brief Destructor.
+         */
+        ~Job()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Method for executing job.
+         */
+        void operator()()
+        {
+            m_operations->invoke(&m_storage);
+        }
+
+        /**
+         * @brief Method for checking is job
+         * contains callable.
+         */
+        explicit operator bool() const noexcept
+        {
+            return m_operations != nullptr;
+        }
+
+    private:
+        struct Operations
+        {
+            void (*invoke)(void*);
+            void (*move)(void* destination, void* source);
+            void (*destroy)(void*);
+        };
+
+        template <typename T>
+        static constexpr bool isInplace()
+        {
+            return sizeof(T) <= StorageSize && alignof(T) <= alignof(std::max_align_t) &&
+                   std::is_nothrow_move_constructible_v<T>;
+        }
+
+        template <typename T>
+        static T* target(void* storage)
+        {
+            if constexpr (isInplace<T>())
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+            else
+            {
+                return *std::launder(reinterpret_cast<T**>(storage));
+            }
+        }
+
+        template <typename T>
+        static void invokeImpl(void* storage)
+        {
+            (*target<T>(storage))();
+        }
+
+        template <typename T>
+        static void moveImpl(void* destination, void* source)
+        {
+            if constexpr (isInplace<T>())
+            {
+                new (destination) T(std::move(*target<T>(source)));
+                target<T>(source)->~T();
+            }
+            else
+            {
+                new (destination) T*(target<T>(source));
+            }
+        }
+
+        template <typename T>
+        static void destroyImpl(void* storage)
+        {
+            if constexpr (isInplace<T>())
+            {
+                target<T>(storage)->~T();
+            }
+            else
+            {
+                delete target<T>(storage);
+            }
+        }
+
+        template <typename T>
+        static constexpr Operations operationsFor = {&invokeImpl<T>, &moveImpl<T>, &destroyImpl<T>};
+
+        void reset() noexcept
+        {
+            if (m_operations != nullptr)
+            {
+                m_operations->destroy(&m_storage);
+                m_operations = nullptr;
+            }
+        }
+
+        std::aligned_storage_t<StorageSize, alignof(std::max_align_t)> m_storage;
+        const Operations* m_operations;
+    };
+
     /**
      * @brief Constructor.
      */
@@ -59,32 +256,190 @@ public:
                               typename HG::Utils::FutureHandler<typename std::invoke_result<FunctionType>::type>>::type
     push(FunctionType function, Type type = Type::UserThread)
     {
-        // todo: Fix promise to lambda capture lately
         using ResultType            = typename std::invoke_result<FunctionType>::type;
-        using FutureResultType      = typename HG::Utils::FutureHandler<ResultType>;
         constexpr bool IsResultVoid = std::is_void<ResultType>::value;
 
         if constexpr (IsResultVoid)
         {
-            pushInternal(function, type);
+            pushInternal(Job(std::move(function)), type);
         }
         else
         {
             // Making promise and pushing job
-            auto promise = std::make_shared<std::promise<ResultType>>();
+            HG::Utils::Promise<ResultType> promise;
 
-            auto future = std::shared_future(promise->get_future());
+            auto handler = promise.handler();
 
             // Creating custom void() job
-            auto job = [prom = std::move(promise), function]() { prom->set_value(function()); };
+            pushInternal(Job([prom = std::move(promise), function = std::move(function)]() mutable {
+                             try
+                             {
+                                 prom.setValue(function());
+                             }
+                             catch (...)
+                             {
+                                 prom.setException(std::current_exception());
+                             }
+                         }),
+                         type);
+
+            return handler;
+        }
+    }
+
+    /**
+     * @brief Method for executing function for every
+     * index in range [begin, end) on pool threads.
+     * Range is split into chunks, calling thread is
+     * executing chunks too. Method returns only after
+     * all indices were processed. If any chunk throws -
+     * first exception will be rethrown in calling thread.
+     * @tparam IndexType Integral index type.
+     * @tparam FunctionType Function type with `void(IndexType)` signature.
+     * @param begin First index.
+     * @param end Index after last.
+     * @param function Function.
+     * @param type Thread type.
+     * @param grainSize Number of indices in one chunk. If 0 -
+     * it will be calculated from number of pool threads.
+     */
+    template <typename IndexType, typename FunctionType>
+    void parallelFor(IndexType begin,
+                     IndexType end,
+                     FunctionType function,
+                     Type type             = Type::UserThread,
+                     std::size_t grainSize = 0)
+    {
+        static_assert(std::is_integral_v<IndexType>, "parallelFor requires integral index type");
+
+        if (end <= begin)
+        {
+            return;
+        }
+
+        auto count   = static_cast<std::size_t>(end - begin);
+        auto threads = numberOfThreads(type);
 
-            // Pushing to queue
-            pushInternal(job, type);
+        if (grainSize == 0)
+        {
+            grainSize = std::max<std::size_t>(1, count / (std::max<std::size_t>(1, threads) * 4));
+        }
+
+        auto chunks = (count + grainSize - 1) / grainSize;
+
+        // Nothing to share
+        if (chunks == 1 || threads == 0)
+        {
+            for (auto index = begin; index < end; ++index)
+            {
+                function(index);
+            }
+
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState<FunctionType>>(std::move(function));
+
+        auto runChunks = [state, begin, count, grainSize, chunks]() {
+            std::size_t chunk;
+
+            while ((chunk = state->nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunks)
+            {
+                auto first = chunk * grainSize;
+                auto last  = std::min(first + grainSize, count);
+
+                try
+                {
+                    for (auto index = first; index < last; ++index)
+                    {
+                        state->function(static_cast<IndexType>(begin + static_cast<IndexType>(index)));
+                    }
+                }
+                catch (...)
+                {
+                    std::unique_lock<std::mutex> lock(state->exceptionMutex);
+
+                    if (!state->exception)
+                    {
+                        state->exception = std::current_exception();
+                    }
+                }
+
+                state->doneChunks.fetch_add(1, std::memory_order_acq_rel);
+            }
+        };
+
+        // Calling thread takes chunks too
+        auto helpers = std::min(threads, chunks - 1);
+
+        for (std::size_t i = 0; i < helpers; ++i)
+        {
+            pushInternal(Job(runChunks), type);
+        }
 
-            return FutureResultType(std::move(future));
+        runChunks();
+
+        while (state->doneChunks.load(std::memory_order_acquire) != chunks)
+        {
+            std::this_thread::yield();
+        }
+
+        if (state->exception)
+        {
+            std::rethrow_exception(state->exception);
         }
     }
 
+    /**
+     * @brief Method for executing function for every
+     * element in range [first, last) on pool threads.
+     * See `parallelFor` for details.
+     * @tparam IteratorType Random access iterator type.
+     * @tparam FunctionType Function type, that accepts element reference.
+     * @param first Iterator to first element.
+     * @param last Iterator after last element.
+     * @param function Function.
+     * @param type Thread type.
+     * @param grainSize Number of elements in one chunk.
+     */
+    template <typename IteratorType, typename FunctionType>
+    void parallelForEach(IteratorType first,
+                         IteratorType last,
+                         FunctionType function,
+                         Type type             = Type::UserThread,
+                         std::size_t grainSize = 0)
+    {
+        static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<IteratorType>::iterator_category>,
+                      "parallelForEach requires random access iterators");
+
+        parallelFor(std::size_t(0),
+                    static_cast<std::size_t>(std::distance(first, last)),
+                    [first, &function](std::size_t index) { function(*(first + index)); },
+                    type,
+                    grainSize);
+    }
+
+    /**
+     * @brief Method for executing function for every
+     * container element on pool threads.
+     * See `parallelFor` for details.
+     * @tparam Container Container with random access iterators.
+     * @tparam FunctionType Function type, that accepts element reference.
+     * @param container Container.
+     * @param function Function.
+     * @param type Thread type.
+     * @param grainSize Number of elements in one chunk.
+     */
+    template <typename Container, typename FunctionType>
+    void parallelForEach(Container& container,
+                         FunctionType function,
+                         Type type             = Type::UserThread,
+                         std::size_t grainSize = 0)
+    {
+        parallelForEach(std::begin(container), std::end(container), std::move(function), type, grainSize);
+    }
+
     /**
      * @brief Method for starting pool with
      * defined amount of threads.
@@ -101,7 +456,8 @@ public:
 
     /**
      * @brief Method for waiting until pool
-     * threads will stop.
+     * threads will stop. Jobs, that were not
+     * taken by threads, are dropped.
      * @param type Pool type.
      */
     void joinPool(Type type);
@@ -115,25 +471,68 @@ public:
      */
     [[nodiscard]] std::size_t numberOfJobs(Type type) const;
 
+    /**
+     * @brief Method for getting number of pool
+     * threads.
+     * @param type Pool type.
+     * @return Number of threads. If there is no
+     * such pool - 0.
+     */
+    [[nodiscard]] std::size_t numberOfThreads(Type type) const;
+
 private:
-    struct PoolData
+    template <typename FunctionType>
+    struct ParallelForState
     {
-        // Jobs for pool
-        std::queue<std::function<void()>> jobs;
+        explicit ParallelForState(FunctionType f) : function(std::move(f)), exception(), exceptionMutex()
+        {
+        }
+
+        FunctionType function;
+
+        std::atomic_size_t nextChunk  = 0;
+        std::atomic_size_t doneChunks = 0;
+
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+    };
+
+    /**
+     * @brief Jobs deques, owned by one pool thread.
+     * Aligned to cache line to prevent false sharing.
+     */
+    struct alignas(64) WorkerData
+    {
+        // Jobs, pushed by this thread
+        std::deque<Job> jobs;
+
+        // Jobs, pushed from outside of pool
+        std::deque<Job> externalJobs;
+
         std::mutex jobsMutex;
+    };
+
+    struct PoolData
+    {
+        // Per thread jobs
+        std::vector<std::unique_ptr<WorkerData>> workers;
+
+        // Number of pushed, but not taken jobs
+        std::atomic_size_t pendingJobs = 0;
+
+        // Worker for next job, pushed from outside of pool
+        std::atomic_size_t nextWorker = 0;
 
         // Is pool running
         std::atomic_bool running = false;
 
-        // ID for next created thread
-        std::atomic_size_t nextId = 0;
-
-        // Notifier for jobs
-        std::condition_variable jobsNotifier;
+        // Sleeping threads
+        std::mutex idleMutex;
+        std::condition_variable idleNotifier;
+        std::atomic_size_t idleThreads = 0;
 
         // Actual pool threads
-        std::mutex threadsMutex;
-        std::unordered_map<std::size_t, std::thread> threads;
+        std::vector<std::thread> threads;
     };
 
     /**
@@ -142,12 +541,25 @@ private:
      * @param job Job.
      * @param type Pool type.
      */
-    void pushInternal(std::function<void()> job, Type type);
+    void pushInternal(Job job, Type type);
 
     /**
      * @brief Actual thread function.
+     * @param data Pool data.
+     * @param index Index of thread in pool.
+     * @param type Pool type.
+     */
+    static void threadFunction(std::shared_ptr<PoolData> data, std::size_t index, Type type);
+
+    /**
+     * @brief Method for taking job from thread's own
+     * deque or stealing it from another thread.
+     * @param data Pool data.
+     * @param index Index of thread in pool.
+     * @param job Job result.
+     * @return Was job taken.
      */
-    void threadFunction(std::size_t id, Type type);
+    static bool takeJob(PoolData* data, std::size_t index, Job& job);
 
     /**
      * @brief Method for getting pool data.
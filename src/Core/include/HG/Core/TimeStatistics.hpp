@@ -23,6 +23,8 @@ public:
         RenderTime       = 1,
         UpdateTime       = 2,
         PhysicsTime      = 3,
+        CriticalPathTime = 4,
+        DispatchTime     = 5,
         LastSystemTimer
     };
 
@@ -86,6 +88,24 @@ public:
      */
     [[nodiscard]] std::chrono::microseconds lastFrameUpdateTime() const;
 
+    /**
+     * @brief Method for getting estimate duration of
+     * frame graph critical path for several last frames.
+     * Number of frames for estimation can be changed by
+     * method `changeEstimateBuffer` with `CriticalPathTime` timer.
+     * @return Estimate critical path time in microseconds.
+     */
+    [[nodiscard]] std::chrono::microseconds criticalPathTime() const;
+
+    /**
+     * @brief Method for getting estimate time, spent on
+     * main thread jobs for several last frames. Number of
+     * frames for estimation can be changed by method
+     * `changeEstimateBuffer` with `DispatchTime` timer.
+     * @return Estimate dispatch time in microseconds.
+     */
+    [[nodiscard]] std::chrono::microseconds dispatchTime() const;
+
     /**
      * @brief Method for changing estimate buffer size.
      * If number of frames will be lower then current,
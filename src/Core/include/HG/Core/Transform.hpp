@@ -13,11 +13,29 @@
 namespace HG::Core
 {
 class GameObject;
+class Scene;
+class TransformPool;
 
 /**
  * @brief Class, that describes
  * world coordinates transformation
  * with rotation, position and scale.
+ *
+ * Global values and local to world matrix
+ * are cached. Change of local values marks
+ * transform and all it's children as dirty
+ * and cache is recalculated on next
+ * request. Cache is not synchronized, so
+ * transforms of one hierarchy have to be
+ * used from one thread. Exception is concurrent
+ * scene update: scene recalculates dirty caches
+ * before it, so global values are only read. Concurrent
+ * behaviour may change only transforms, that are not
+ * read by other concurrent behaviours.
+ *
+ * Transform can be added to HG::Core::TransformPool.
+ * In this case it's values are stored in pool and
+ * transform is used as handle to them.
  */
 class Transform : public HG::Core::CachableResource<Transform>
 {
@@ -145,10 +163,38 @@ public:
 
     /**
      * @brief Method for taking model local to world matrix.
-     * @return 4x4 matrix.
+     * Matrix is returned by value, because pooled
+     * matrix storage is reallocated on pool changes.
+     * @return Cached 4x4 matrix.
      */
     [[nodiscard]] glm::mat4 localToWorldMatrix() const;
 
+    /**
+     * @brief Method for getting cached local to world
+     * matrices of several transforms at once. Dirty
+     * caches are recalculated, shared parents only once.
+     * @param transforms Transforms.
+     * @param matrices Resulting matrices in same order.
+     */
+    static void localToWorldMatrices(const std::vector<Transform*>& transforms, std::vector<glm::mat4>& matrices);
+
+    /**
+     * @brief Method for getting cached global positions
+     * of several transforms at once. Dirty caches are
+     * recalculated, shared parents only once.
+     * @param transforms Transforms.
+     * @param positions Resulting positions in same order.
+     */
+    static void globalPositions(const std::vector<Transform*>& transforms, std::vector<glm::vec3>& positions);
+
+    /**
+     * @brief Method for getting local positions
+     * of several transforms at once.
+     * @param transforms Transforms.
+     * @param positions Resulting positions in same order.
+     */
+    static void localPositions(const std::vector<Transform*>& transforms, std::vector<glm::vec3>& positions);
+
     /**
      * @brief Method for setting translation, rotation and scale
      * from local to world matrix.
@@ -169,11 +215,86 @@ public:
     [[nodiscard]] HG::Core::GameObject* gameObject() const;
 
 private:
+    /**
+     * @brief Method for marking transform and
+     * it's children for cache recalculation.
+     */
+    void markDirty();
+
+    /**
+     * @brief Method for recalculating global values
+     * and matrix if transform is dirty. Parent
+     * cache is updated first.
+     */
+    void updateCache() const;
+
+    /**
+     * @brief Method for calculating global values
+     * of child transform.
+     */
+    static void calculateGlobal(const glm::vec3& parentPosition,
+                                const glm::quat& parentRotation,
+                                const glm::vec3& parentScale,
+                                const glm::vec3& localPosition,
+                                const glm::quat& localRotation,
+                                const glm::vec3& localScale,
+                                glm::vec3& globalPosition,
+                                glm::quat& globalRotation,
+                                glm::vec3& globalScale);
+
+    /**
+     * @brief Method for calculating local to
+     * world matrix from global values.
+     */
+    static void calculateMatrix(const glm::vec3& position, const glm::quat& rotation, glm::vec3 scale, glm::mat4& matrix);
+
+    /**
+     * @brief Method for getting value, that's stored
+     * in transform or in transform pool.
+     */
+    template <typename Type>
+    Type& field(Type Transform::*member, std::vector<Type> TransformPool::*array) const;
+
+    // Stored values. Local values are changed
+    // only by non constant methods.
+    glm::quat& localRotationData() const;
+    glm::vec3& localScaleData() const;
+    glm::vec3& localPositionData() const;
+    glm::quat& globalRotationData() const;
+    glm::vec3& globalScaleData() const;
+    glm::vec3& globalPositionData() const;
+    glm::mat4& matrixData() const;
+
+    [[nodiscard]] bool isDirty() const;
+
+    void setDirty(bool dirty) const;
+
+    /**
+     * @brief Method for notifying pools of transform
+     * and it's children about hierarchy change.
+     */
+    void invalidatePoolOrder();
+
+    friend class HG::Core::TransformPool;
+    friend class HG::Core::Scene;
+
     glm::quat m_localRotation;
     glm::vec3 m_localScale;
     glm::vec3 m_localPosition;
     HG::Core::GameObject* m_owner;
     Transform* m_parent;
     std::vector<Transform*> m_children;
+
+    // Cache. If transform is dirty,
+    // all it's children are dirty too.
+    mutable bool m_dirty;
+    mutable glm::quat m_globalRotation;
+    mutable glm::vec3 m_globalScale;
+    mutable glm::vec3 m_globalPosition;
+    mutable glm::mat4 m_localToWorldMatrix;
+
+    // Pool, that stores values
+    HG::Core::TransformPool* m_pool;
+    std::size_t m_poolIndex;
 };
 } // namespace HG::Core
@@ -0,0 +1,163 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace HG::Core
+{
+class Transform;
+class ThreadPool;
+
+/**
+ * @brief Class, that describes contiguous storage
+ * of transforms. Local values, global values and
+ * local to world matrices of added transforms are
+ * stored in parallel arrays, that are sorted by
+ * hierarchy depth. Transform objects keep working
+ * as handles to this storage.
+ *
+ * `update` recalculates all dirty transforms in one
+ * pass, parents before children. Transforms of same
+ * depth don't depend on each other, so big depth
+ * levels are split between pool threads.
+ *
+ * Parent of transform may be not added to pool. Such
+ * transforms are placed on first level.
+ */
+class TransformPool
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    TransformPool();
+
+    /**
+     * @brief Destructor. Transforms are removed
+     * from pool and keep their values.
+     */
+    ~TransformPool();
+
+    // Disable copying
+    TransformPool(const TransformPool&) = delete;
+    TransformPool& operator=(const TransformPool&) = delete;
+
+    /**
+     * @brief Method for adding transform to pool.
+     * Transform is removed from previous pool.
+     * @param transform Pointer to transform.
+     */
+    void add(HG::Core::Transform* transform);
+
+    /**
+     * @brief Method for removing transform from pool.
+     * Transform values are moved back to transform.
+     * @param transform Pointer to transform.
+     */
+    void remove(HG::Core::Transform* transform);
+
+    /**
+     * @brief Method for removing all transforms.
+     */
+    void clear();
+
+    /**
+     * @brief Method for getting number of
+     * transforms in pool.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Method for recalculating global values
+     * and local to world matrices of all dirty
+     * transforms.
+     * @param threadPool Thread pool for splitting big
+     * depth levels. If nullptr - levels are calculated
+     * on current thread.
+     */
+    void update(HG::Core::ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Method for getting local to world
+     * matrices, that are sorted by hierarchy depth.
+     * Matrices are valid after `update` call.
+     */
+    [[nodiscard]] const std::vector<glm::mat4>& localToWorldMatrices() const;
+
+    /**
+     * @brief Method for getting transforms in same
+     * order as `localToWorldMatrices`.
+     */
+    [[nodiscard]] const std::vector<HG::Core::Transform*>& transforms() const;
+
+    /**
+     * @brief Method for setting number of transforms,
+     * that are calculated by one pool thread. Depth
+     * levels, that contain more transforms, are split
+     * between threads. Can throw `std::invalid_argument`
+     * if size is 0.
+     * @param size Number of transforms.
+     */
+    void setConcurrentChunkSize(std::size_t size);
+
+    /**
+     * @brief Method for getting number of transforms,
+     * that are calculated by one pool thread.
+     */
+    [[nodiscard]] std::size_t concurrentChunkSize() const;
+
+private:
+    friend class HG::Core::Transform;
+
+    static constexpr std::size_t NoParent = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Method for marking, that transforms
+     * have to be sorted before next update.
+     */
+    void invalidateOrder();
+
+    /**
+     * @brief Method for sorting transforms by
+     * depth and updating parents indices.
+     */
+    void rebuildOrder();
+
+    /**
+     * @brief Method for calculating dirty
+     * transforms in range.
+     */
+    void updateRange(std::size_t first, std::size_t last);
+
+    std::vector<HG::Core::Transform*> m_transforms;
+    std::vector<std::size_t> m_parents;
+
+    // First index of every depth level and
+    // index after last transform
+    std::vector<std::size_t> m_levels;
+
+    std::vector<glm::vec3> m_localPositions;
+    std::vector<glm::quat> m_localRotations;
+    std::vector<glm::vec3> m_localScales;
+
+    std::vector<glm::vec3> m_globalPositions;
+    std::vector<glm::quat> m_globalRotations;
+    std::vector<glm::vec3> m_globalScales;
+    std::vector<glm::mat4> m_matrices;
+
+    // Not `std::vector<bool>`, because levels
+    // are written from several threads
+    std::vector<std::uint8_t> m_dirty;
+
+    bool m_orderChanged;
+
+    std::size_t m_concurrentChunkSize;
+};
+} // namespace HG::Core
@@ -9,10 +9,13 @@
 #include <HG/Core/Benchmark.hpp>
 #include <HG/Core/BuildProperties.hpp>
 #include <HG/Core/CountStatistics.hpp>
+#include <HG/Core/FrameGraph.hpp>
 #include <HG/Core/Input.hpp>
+#include <HG/Core/MainThreadDispatcher.hpp>
 #include <HG/Core/ResourceCache.hpp>
 #include <HG/Core/ResourceManager.hpp>
 #include <HG/Core/Scene.hpp>
+#include <HG/Core/SceneStreamer.hpp>
 #include <HG/Core/ThreadPool.hpp>
 #include <HG/Core/TimeStatistics.hpp>
 
@@ -21,6 +24,7 @@
 #include <HG/Rendering/Base/SystemController.hpp>
 
 // HG::Utils
+#include <HG/Utils/ContinuationQueue.hpp>
 #include <HG/Utils/Logging.hpp>
 
 namespace HG::Core
@@ -37,14 +41,43 @@ Application::Application(std::string name, int /* argc */, char** /* argv */) :
     m_countStatistics(new CountStatistics()),
     m_benchmark(new Benchmark()),
     m_resourceCache(new ResourceCache()),
+    m_frameGraph(new FrameGraph()),
+    m_mainThreadQueue(new HG::Utils::ContinuationQueue()),
+    m_mainThreadDispatcher(new MainThreadDispatcher()),
+    m_sceneStreamer(new SceneStreamer(m_threadPool, m_mainThreadDispatcher)),
+    m_deltaTime(0),
     m_currentScene(nullptr),
     m_cachedScene(nullptr)
 {
     m_renderer = new HG::Rendering::Base::Renderer(this);
+
+    m_countStatistics->addCounter(CountStatistics::CommonCounter::DispatchedJobs,
+                                  CountStatistics::CounterType::LastFrame);
+    m_countStatistics->addCounter(CountStatistics::CommonCounter::PendingDispatchJobs,
+                                  CountStatistics::CounterType::LastFrame);
+
+    setupFrameGraph();
 }
 
 Application::~Application()
 {
+    // Streamer waits for running preparations, so
+    // it's deleted before dispatcher and resources
+    delete m_sceneStreamer;
+
+    // Running reading and decoding jobs are using dispatcher
+    // and main thread queue, resource manager waits for them.
+    // It needs running pool for that, so it's stopped after.
+    delete m_resourceManager;
+    m_resourceManager = nullptr;
+
+    // Other jobs may use application objects as well
+    for (auto type : {ThreadPool::Type::FileLoadingThread, ThreadPool::Type::UserThread})
+    {
+        m_threadPool->stopPool(type);
+        m_threadPool->joinPool(type);
+    }
+
     delete m_cachedScene;
     delete m_currentScene;
 
@@ -52,11 +85,13 @@ Application::~Application()
     delete m_physicsController;
 
     delete m_renderer;
+    delete m_mainThreadDispatcher;
+    delete m_mainThreadQueue;
+    delete m_frameGraph;
     delete m_resourceCache;
     delete m_benchmark;
     delete m_countStatistics;
     delete m_timeStatistics;
-    delete m_resourceManager;
     delete m_input;
     delete m_threadPool;
 }
@@ -83,7 +118,14 @@ void Application::setScene(Scene* scene)
         throw std::runtime_error("New scene can't be nullptr.");
     }
 
-    delete m_cachedScene;
+    m_sceneStreamer->cancelScene();
+
+    if (m_cachedScene != nullptr)
+    {
+        m_sceneStreamer->cancelSubScenes(m_cachedScene);
+        delete m_cachedScene;
+    }
+
     scene->setApplication(this);
     m_cachedScene = scene;
 }
@@ -133,70 +175,143 @@ std::string Application::title() const
 bool Application::performCycle()
 {
     // Saving last deltatime
-    auto dt = m_timeStatistics->tickTimerAtomic(TimeStatistics::FrameTime);
+    m_deltaTime = m_timeStatistics->tickTimerAtomic(TimeStatistics::FrameTime);
 
     // Ticking benchmark
     m_benchmark->tick();
 
-    // Tick counting frame time
+    // Executing frame stages
+    m_frameGraph->execute(m_threadPool);
 
-    if (m_physicsController)
-    {
-        BENCH_D(this, "Physics tick");
-        // Start counting physics time
-        m_timeStatistics->tickTimerBegin(TimeStatistics::PhysicsTime);
-
-        // Processing physics, if available
-        m_physicsController->tick(dt);
+    m_timeStatistics->tickTimer(TimeStatistics::CriticalPathTime, m_frameGraph->criticalPathTime());
 
-        // Finish counting physics time
-        m_timeStatistics->tickTimerEnd(TimeStatistics::PhysicsTime);
-    }
+    m_countStatistics->frameChanged();
 
-    // Start counting update time (events are in update section)
-    m_timeStatistics->tickTimerBegin(TimeStatistics::UpdateTime);
+    return true;
+}
 
-    // Checking for new scene, etc
-    proceedScene();
+void Application::setupFrameGraph()
+{
+    using Resources = FrameGraph::Resources;
+
+    m_frameGraph->addTask(
+        "Physics",
+        [this]() {
+            if (m_physicsController == nullptr)
+            {
+                return;
+            }
+
+            BENCH_D(this, "Physics tick");
+            // Start counting physics time
+            m_timeStatistics->tickTimerBegin(TimeStatistics::PhysicsTime);
+
+            // Processing physics, if available
+            m_physicsController->tick(m_deltaTime);
+
+            // Finish counting physics time
+            m_timeStatistics->tickTimerEnd(TimeStatistics::PhysicsTime);
+        },
+        {},
+        {Resources::Physics, Resources::Gizmos});
+
+    // Checking for new scene, etc. Removing scene
+    // removes it's rigidbodies, so it's physics dependent.
+    m_frameGraph->addTask(
+        "Scene processing",
+        [this]() { proceedScene(); },
+        {},
+        {Resources::Scene, Resources::Physics},
+        FrameGraph::Affinity::MainThread);
 
     // Polling events
-    if (m_renderer->pipeline() != nullptr && systemController() != nullptr)
-    {
-        BENCH_D(this, "Events polling");
-        systemController()->pollEvents();
-    }
-
-    {
-        BENCH_D(this, "Updating");
-        // Calling update on scene.
-        if (m_currentScene)
-        {
-            m_currentScene->update();
-        }
-
-        // Finishing counting update time
-        m_timeStatistics->tickTimerEnd(TimeStatistics::UpdateTime);
-    }
-
-    {
-        BENCH_D(this, "Rendering");
-
-        // Start counting rendering time
-        m_timeStatistics->tickTimerBegin(TimeStatistics::RenderTime);
-
-        // Executing rendering pipeline.
-        if (m_currentScene)
-        {
-            m_currentScene->render(m_renderer);
-        }
-
-        // Finishing counting rendering time
-        m_timeStatistics->tickTimerEnd(TimeStatistics::RenderTime);
-    }
-
-    m_countStatistics->frameChanged();
-
-    return true;
+    m_frameGraph->addTask(
+        "Events polling",
+        [this]() {
+            if (m_renderer->pipeline() != nullptr && systemController() != nullptr)
+            {
+                BENCH_D(this, "Events polling");
+                systemController()->pollEvents();
+            }
+        },
+        {},
+        {Resources::Input},
+        FrameGraph::Affinity::MainThread);
+
+    // Executing continuations of finished asynchronous
+    // operations, before scene will use their results
+    m_frameGraph->addTask(
+        "Continuations",
+        [this]() {
+            BENCH_D(this, "Continuations");
+            m_mainThreadQueue->execute();
+        },
+        {},
+        {Resources::Scene},
+        FrameGraph::Affinity::MainThread);
+
+    m_frameGraph->addTask(
+        "Updating",
+        [this]() {
+            BENCH_D(this, "Updating");
+
+            // Start counting update time
+            m_timeStatistics->tickTimerBegin(TimeStatistics::UpdateTime);
+
+            // Calling update on scene.
+            if (m_currentScene)
+            {
+                m_currentScene->update();
+            }
+
+            // Finishing counting update time
+            m_timeStatistics->tickTimerEnd(TimeStatistics::UpdateTime);
+        },
+        {Resources::Input},
+        {Resources::Scene, Resources::Physics, Resources::Gizmos},
+        FrameGraph::Affinity::MainThread);
+
+    // Executing main thread jobs (GPU uploads, etc)
+    // until frame budget is spent
+    m_frameGraph->addTask(
+        "Dispatching",
+        [this]() {
+            BENCH_D(this, "Dispatching");
+
+            m_timeStatistics->tickTimerBegin(TimeStatistics::DispatchTime);
+
+            auto numberOfExecuted = m_mainThreadDispatcher->execute();
+
+            m_timeStatistics->tickTimerEnd(TimeStatistics::DispatchTime);
+
+            m_countStatistics->add(CountStatistics::CommonCounter::DispatchedJobs, numberOfExecuted);
+            m_countStatistics->add(CountStatistics::CommonCounter::PendingDispatchJobs,
+                                   m_mainThreadDispatcher->numberOfPendingJobs());
+        },
+        {},
+        {Resources::Renderer},
+        FrameGraph::Affinity::MainThread);
+
+    m_frameGraph->addTask(
+        "Rendering",
+        [this]() {
+            BENCH_D(this, "Rendering");
+
+            // Start counting rendering time
+            m_timeStatistics->tickTimerBegin(TimeStatistics::RenderTime);
+
+            // Executing rendering pipeline.
+            if (m_currentScene)
+            {
+                m_currentScene->render(m_renderer);
+            }
+
+            // Finishing counting rendering time
+            m_timeStatistics->tickTimerEnd(TimeStatistics::RenderTime);
+        },
+        {Resources::Scene, Resources::Physics},
+        {Resources::Gizmos, Resources::Renderer},
+        FrameGraph::Affinity::MainThread);
 }
 
 int Application::exec()
@@ -208,6 +323,10 @@ int Application::exec()
         performCycle();
     }
 
+    m_sceneStreamer->cancelScene();
+    m_sceneStreamer->cancelSubScenes(m_currentScene);
+    m_sceneStreamer->cancelSubScenes(m_cachedScene);
+
     delete m_currentScene;
     m_currentScene = nullptr;
 
@@ -222,9 +341,19 @@ int Application::exec()
 void Application::proceedScene()
 {
     BENCH_D(this, "Scene processing");
+
+    // Scene, prepared in background, replaces cached one
+    auto readyScene = m_sceneStreamer->takeReadyScene();
+
+    if (readyScene != nullptr)
+    {
+        setScene(readyScene);
+    }
+
     if (m_cachedScene != nullptr)
     {
         // Deleting current scene
+        m_sceneStreamer->cancelSubScenes(m_currentScene);
         delete m_currentScene;
         m_currentScene = m_cachedScene;
         m_cachedScene  = nullptr;
@@ -232,6 +361,11 @@ void Application::proceedScene()
         // Calling start method
         m_currentScene->start();
     }
+
+    if (m_currentScene != nullptr)
+    {
+        m_sceneStreamer->proceedSubScenes(m_currentScene, m_resourceCache);
+    }
 }
 
 HG::Rendering::Base::Renderer* Application::renderer() const
@@ -264,6 +398,26 @@ ResourceCache* Application::resourceCache() const
     return m_resourceCache;
 }
 
+FrameGraph* Application::frameGraph() const
+{
+    return m_frameGraph;
+}
+
+HG::Utils::ContinuationQueue* Application::mainThreadQueue() const
+{
+    return m_mainThreadQueue;
+}
+
+MainThreadDispatcher* Application::mainThreadDispatcher() const
+{
+    return m_mainThreadDispatcher;
+}
+
+SceneStreamer* Application::sceneStreamer() const
+{
+    return m_sceneStreamer;
+}
+
 ThreadPool* Application::threadPool() const
 {
     return m_threadPool;
@@ -0,0 +1,232 @@
+// HG::Core
+#include <HG/Core/AssetCache.hpp>
+
+namespace HG::Core
+{
+AssetCache::AssetCache(std::size_t budget) : m_state(std::make_shared<State>())
+{
+    m_state->budget = budget;
+}
+
+AssetCache::~AssetCache()
+{
+    clear();
+}
+
+AssetCache::LookupResult AssetCache::lookup(const Key& key,
+                                            std::shared_ptr<void>& object,
+                                            std::shared_ptr<void> pending,
+                                            std::weak_ptr<void> owner)
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    auto iter = m_state->entries.find(key);
+
+    if (iter != m_state->entries.end())
+    {
+        auto& entry = iter->second;
+
+        if (auto alive = entry.alive.lock())
+        {
+            ++m_state->hits;
+            object = std::move(alive);
+
+            return LookupResult::Found;
+        }
+
+        // Reviving released asset
+        if (entry.retained != nullptr)
+        {
+            ++m_state->hits;
+
+            m_state->released.erase(entry.position);
+            m_state->retainedSize -= entry.size;
+
+            object      = share(m_state, key, std::move(entry.retained));
+            entry.alive = object;
+
+            return LookupResult::Found;
+        }
+
+        // Loading was not abandoned
+        if (entry.pending != nullptr && !entry.owner.expired())
+        {
+            ++m_state->coalesced;
+            object = entry.pending;
+
+            return LookupResult::Pending;
+        }
+    }
+
+    ++m_state->misses;
+
+    auto& entry = m_state->entries[key];
+
+    entry.pending = std::move(pending);
+    entry.owner   = std::move(owner);
+    entry.alive.reset();
+
+    object = entry.pending;
+
+    return LookupResult::Missing;
+}
+
+std::shared_ptr<void> AssetCache::complete(const Key& key, std::shared_ptr<void> asset, std::size_t size)
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    // Failed assets are not cached
+    if (asset == nullptr)
+    {
+        m_state->entries.erase(key);
+        return nullptr;
+    }
+
+    auto& entry = m_state->entries[key];
+
+    entry.pending.reset();
+    entry.owner.reset();
+    entry.size = size;
+
+    auto shared = share(m_state, key, std::move(asset));
+
+    entry.alive = shared;
+
+    return shared;
+}
+
+void AssetCache::clear()
+{
+    std::list<std::shared_ptr<void>> dropped;
+
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    evict(*m_state, 0, dropped);
+
+    lock.unlock();
+}
+
+void AssetCache::setBudget(std::size_t budget)
+{
+    std::list<std::shared_ptr<void>> dropped;
+
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    m_state->budget = budget;
+
+    evict(*m_state, budget, dropped);
+
+    lock.unlock();
+}
+
+std::size_t AssetCache::budget() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->budget;
+}
+
+std::size_t AssetCache::retainedSize() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->retainedSize;
+}
+
+std::size_t AssetCache::numberOfHits() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->hits;
+}
+
+std::size_t AssetCache::numberOfCoalesced() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->coalesced;
+}
+
+std::size_t AssetCache::numberOfMisses() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->misses;
+}
+
+std::size_t AssetCache::numberOfEvictions() const
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+
+    return m_state->evictions;
+}
+
+std::shared_ptr<void> AssetCache::share(const std::shared_ptr<State>& state,
+                                        const Key& key,
+                                        std::shared_ptr<void> asset)
+{
+    auto* pointer = asset.get();
+
+    // Deleter is not destroyed until weak references are
+    // alive, so asset is moved out of it.
+    return std::shared_ptr<void>(
+        pointer, [weakState = std::weak_ptr<State>(state), key, asset = std::move(asset)](void*) mutable {
+            release(weakState, key, std::move(asset));
+        });
+}
+
+void AssetCache::release(const std::weak_ptr<State>& weakState, const Key& key, std::shared_ptr<void> asset)
+{
+    auto state = weakState.lock();
+
+    // Cache was destroyed
+    if (state == nullptr)
+    {
+        return;
+    }
+
+    // Assets are destroyed without lock
+    std::list<std::shared_ptr<void>> dropped;
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    auto iter = state->entries.find(key);
+
+    // Asset was reloaded or cache was cleared
+    if (iter == state->entries.end() || iter->second.pending != nullptr || !iter->second.alive.expired() ||
+        iter->second.retained != nullptr)
+    {
+        lock.unlock();
+        return;
+    }
+
+    auto& entry = iter->second;
+
+    entry.retained = std::move(asset);
+
+    state->released.push_front(key);
+    state->retainedSize += entry.size;
+
+    entry.position = state->released.begin();
+
+    evict(*state, state->budget, dropped);
+
+    lock.unlock();
+}
+
+void AssetCache::evict(State& state, std::size_t budget, std::list<std::shared_ptr<void>>& dropped)
+{
+    while (!state.released.empty() && (state.retainedSize > budget || budget == 0))
+    {
+        auto iter = state.entries.find(state.released.back());
+
+        state.retainedSize -= iter->second.size;
+        ++state.evictions;
+
+        dropped.push_back(std::move(iter->second.retained));
+
+        state.entries.erase(iter);
+        state.released.pop_back();
+    }
+}
+} // namespace HG::Core
@@ -0,0 +1,636 @@
+// C++ STL
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/AsyncFilesystemResourceAccessor.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#    define HG_HAS_IO_URING
+
+// Linux
+#    include <fcntl.h>
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <sys/syscall.h>
+#    include <sys/uio.h>
+#    include <unistd.h>
+#endif
+
+namespace HG::Core
+{
+/**
+ * @brief Interface of reading implementation.
+ */
+class AsyncFilesystemResourceAccessor::Implementation
+{
+public:
+    virtual ~Implementation() = default;
+
+    /**
+     * @brief Method for starting reading of file.
+     * @param id Path to file.
+     * @return Handler for loaded data.
+     */
+    virtual HG::Utils::FutureHandler<DataPtr> read(const std::string& id) = 0;
+};
+
+/**
+ * @brief Implementation, that reads files with blocking
+ * calls from several threads.
+ */
+class AsyncFilesystemResourceAccessor::ThreadsImplementation : public AsyncFilesystemResourceAccessor::Implementation
+{
+public:
+    ThreadsImplementation(AsyncFilesystemResourceAccessor* accessor, std::size_t numberOfThreads) :
+        m_accessor(accessor),
+        m_mutex(),
+        m_notifier(),
+        m_requests(),
+        m_running(true),
+        m_threads()
+    {
+        for (std::size_t index = 0; index < numberOfThreads; ++index)
+        {
+            m_threads.emplace_back([this]() { threadFunction(); });
+        }
+    }
+
+    ~ThreadsImplementation() override
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+
+        m_notifier.notify_all();
+
+        for (auto&& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    HG::Utils::FutureHandler<DataPtr> read(const std::string& id) override
+    {
+        Request request;
+        request.id = id;
+
+        auto handler = request.promise.handler();
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_requests.push_back(std::move(request));
+        }
+
+        m_notifier.notify_one();
+
+        return handler;
+    }
+
+private:
+    struct Request
+    {
+        std::string id;
+        HG::Utils::Promise<DataPtr> promise;
+    };
+
+    void threadFunction()
+    {
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            // Requests are finished before stopping
+            m_notifier.wait(lock, [this]() { return !m_requests.empty() || !m_running; });
+
+            if (m_requests.empty())
+            {
+                return;
+            }
+
+            auto request = std::move(m_requests.front());
+            m_requests.pop_front();
+
+            lock.unlock();
+
+            request.promise.setValue(m_accessor->FilesystemResourceAccessor::loadRaw(request.id));
+        }
+    }
+
+    AsyncFilesystemResourceAccessor* m_accessor;
+
+    std::mutex m_mutex;
+    std::condition_variable m_notifier;
+    std::deque<Request> m_requests;
+    bool m_running;
+
+    std::vector<std::thread> m_threads;
+};
+
+#ifdef HG_HAS_IO_URING
+/**
+ * @brief Implementation, that submits reads to io_uring.
+ * Submission is performed by reading thread, completions
+ * are reaped by separate thread, that also resubmits
+ * partial reads and pending requests.
+ */
+class AsyncFilesystemResourceAccessor::UringImplementation : public AsyncFilesystemResourceAccessor::Implementation
+{
+public:
+    /**
+     * @brief Constructor. Can throw `std::runtime_error`
+     * if io_uring is not available.
+     * @param queueDepth Maximum number of reads in flight.
+     */
+    explicit UringImplementation(std::size_t queueDepth) :
+        m_ring(-1),
+        m_sqRing(MAP_FAILED),
+        m_sqRingSize(0),
+        m_cqRing(MAP_FAILED),
+        m_cqRingSize(0),
+        m_sqes(MAP_FAILED),
+        m_sqesSize(0),
+        m_sqHead(nullptr),
+        m_sqTail(nullptr),
+        m_sqMask(nullptr),
+        m_sqArray(nullptr),
+        m_cqHead(nullptr),
+        m_cqTail(nullptr),
+        m_cqMask(nullptr),
+        m_cqes(nullptr),
+        m_mutex(),
+        m_queueDepth(std::min(queueDepth, MaxQueueDepth)),
+        m_inFlight(0),
+        m_pending(),
+        m_failed(),
+        m_running(true),
+        m_completionThread()
+    {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+
+        m_ring = static_cast<int>(syscall(__NR_io_uring_setup, static_cast<unsigned>(m_queueDepth), &params));
+
+        if (m_ring < 0)
+        {
+            throw std::runtime_error(std::string("Can't setup io_uring: ") + std::strerror(errno));
+        }
+
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_sqesSize   = params.sq_entries * sizeof(io_uring_sqe);
+
+        auto singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+        if (singleMap)
+        {
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+        }
+
+        m_sqRing = mmap(
+            nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQ_RING);
+
+        if (!singleMap && m_sqRing != MAP_FAILED)
+        {
+            m_cqRing = mmap(
+                nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_CQ_RING);
+        }
+
+        m_sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, IORING_OFF_SQES);
+
+        auto* cqRing = singleMap ? m_sqRing : m_cqRing;
+
+        if (m_sqRing == MAP_FAILED || cqRing == MAP_FAILED || m_sqes == MAP_FAILED)
+        {
+            auto error = errno;
+            release();
+            throw std::runtime_error(std::string("Can't map io_uring: ") + std::strerror(error));
+        }
+
+        auto* sqBytes = static_cast<std::byte*>(m_sqRing);
+        auto* cqBytes = static_cast<std::byte*>(cqRing);
+
+        m_sqHead  = reinterpret_cast<unsigned*>(sqBytes + params.sq_off.head);
+        m_sqTail  = reinterpret_cast<unsigned*>(sqBytes + params.sq_off.tail);
+        m_sqMask  = reinterpret_cast<unsigned*>(sqBytes + params.sq_off.ring_mask);
+        m_sqArray = reinterpret_cast<unsigned*>(sqBytes + params.sq_off.array);
+
+        m_cqHead = reinterpret_cast<unsigned*>(cqBytes + params.cq_off.head);
+        m_cqTail = reinterpret_cast<unsigned*>(cqBytes + params.cq_off.tail);
+        m_cqMask = reinterpret_cast<unsigned*>(cqBytes + params.cq_off.ring_mask);
+        m_cqes   = reinterpret_cast<io_uring_cqe*>(cqBytes + params.cq_off.cqes);
+
+        m_completionThread = std::thread([this]() { completionFunction(); });
+    }
+
+    ~UringImplementation() override
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_running = false;
+
+            // Waking up completion thread
+            pushEntry(IORING_OP_NOP, nullptr);
+        }
+
+        m_completionThread.join();
+
+        release();
+    }
+
+    HG::Utils::FutureHandler<DataPtr> read(const std::string& id) override
+    {
+        auto fd = open(id.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            HGWarning("Can't open file \"{}\".", id);
+            return HG::Utils::FutureHandler<DataPtr>(nullptr);
+        }
+
+        struct stat status;
+
+        if (fstat(fd, &status) != 0)
+        {
+            HGWarning("Can't get size of file \"{}\".", id);
+            close(fd);
+            return HG::Utils::FutureHandler<DataPtr>(nullptr);
+        }
+
+        if (status.st_size == 0)
+        {
+            close(fd);
+            return HG::Utils::FutureHandler<DataPtr>(std::make_shared<VectorData>(std::vector<std::byte>(), id));
+        }
+
+        auto* request = new Request();
+        request->id   = id;
+        request->fd   = fd;
+        request->buffer.resize(static_cast<std::size_t>(status.st_size));
+        request->offset = 0;
+
+        auto handler = request->promise.handler();
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (m_inFlight < m_queueDepth)
+            {
+                ++m_inFlight;
+                submit(request);
+            }
+            else
+            {
+                m_pending.push_back(request);
+            }
+        }
+
+        finishFailed();
+
+        return handler;
+    }
+
+private:
+    // Limit of io_uring entries and one read size
+    static constexpr std::size_t MaxQueueDepth = 4096;
+    static constexpr std::size_t MaxReadSize   = 1u << 30u;
+
+    struct Request
+    {
+        std::string id;
+        int fd;
+        std::vector<std::byte> buffer;
+        std::size_t offset;
+        iovec vector;
+        HG::Utils::Promise<DataPtr> promise;
+    };
+
+    /**
+     * @brief Method for submitting read of request in
+     * flight. Has to be called under mutex. If read can't
+     * be submitted, request leaves flight and is kept
+     * for `finishFailed`.
+     * @param request Request.
+     */
+    void submit(Request* request)
+    {
+        if (pushEntry(IORING_OP_READV, request))
+        {
+            return;
+        }
+
+        --m_inFlight;
+        m_failed.push_back(request);
+    }
+
+    /**
+     * @brief Method for finishing requests, that can't be
+     * submitted, with nullptr. Has to be called without
+     * mutex, because continuations may start new reads.
+     */
+    void finishFailed()
+    {
+        std::vector<Request*> failed;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            failed.swap(m_failed);
+        }
+
+        for (auto* request : failed)
+        {
+            HGWarning("Can't read file \"{}\": read can't be submitted.", request->id);
+
+            close(request->fd);
+
+            request->promise.setValue(nullptr);
+
+            delete request;
+        }
+    }
+
+    /**
+     * @brief Method for submitting entry. Has to be
+     * called under mutex.
+     * @param opcode Entry operation.
+     * @param request Request or nullptr for NOP.
+     * @return Was entry submitted. If not, it's
+     * taken back from submission queue.
+     */
+    bool pushEntry(std::uint8_t opcode, Request* request)
+    {
+        auto tail  = *m_sqTail;
+        auto index = tail & *m_sqMask;
+
+        auto& entry = static_cast<io_uring_sqe*>(m_sqes)[index];
+
+        std::memset(&entry, 0, sizeof(entry));
+
+        entry.opcode    = opcode;
+        entry.user_data = reinterpret_cast<std::uint64_t>(request);
+
+        if (request != nullptr)
+        {
+            request->vector.iov_base = request->buffer.data() + request->offset;
+            request->vector.iov_len  = std::min(request->buffer.size() - request->offset, MaxReadSize);
+
+            entry.fd   = request->fd;
+            entry.addr = reinterpret_cast<std::uint64_t>(&request->vector);
+            entry.len  = 1;
+            entry.off  = request->offset;
+        }
+
+        m_sqArray[index] = index;
+
+        __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        while (syscall(__NR_io_uring_enter, m_ring, 1, 0, 0, nullptr, 0) < 0)
+        {
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            {
+                HGError("Can't submit io_uring entry: {}", std::strerror(errno));
+
+                // Entry, consumed by kernel, will be completed
+                if (__atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) != tail)
+                {
+                    return true;
+                }
+
+                // Only this thread submits, so entry can be taken back
+                __atomic_store_n(m_sqTail, tail, __ATOMIC_RELEASE);
+
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
+
+        return true;
+    }
+
+    void completionFunction()
+    {
+        while (true)
+        {
+            syscall(__NR_io_uring_enter, m_ring, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+            auto head = *m_cqHead;
+            auto tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+
+            for (; head != tail; ++head)
+            {
+                auto& entry = m_cqes[head & *m_cqMask];
+
+                auto* request = reinterpret_cast<Request*>(entry.user_data);
+                auto result   = entry.res;
+
+                __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+
+                if (request != nullptr)
+                {
+                    complete(request, result);
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (!m_running && m_inFlight == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    void complete(Request* request, int result)
+    {
+        if (result == -EINTR || result == -EAGAIN)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                submit(request);
+            }
+
+            finishFailed();
+            return;
+        }
+
+        DataPtr data = nullptr;
+
+        if (result < 0)
+        {
+            HGWarning("Can't read file \"{}\": {}", request->id, std::strerror(-result));
+        }
+        else
+        {
+            request->offset += static_cast<std::size_t>(result);
+
+            // Continuing partial read
+            if (result != 0 && request->offset < request->buffer.size())
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    submit(request);
+                }
+
+                finishFailed();
+                return;
+            }
+
+            // File was truncated while reading
+            request->buffer.resize(request->offset);
+
+            data = std::make_shared<VectorData>(std::move(request->buffer), request->id);
+        }
+
+        close(request->fd);
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            --m_inFlight;
+
+            while (m_inFlight < m_queueDepth && !m_pending.empty())
+            {
+                auto* pending = m_pending.front();
+                m_pending.pop_front();
+
+                ++m_inFlight;
+                submit(pending);
+            }
+        }
+
+        finishFailed();
+
+        // Continuations may start new reads,
+        // so promise is satisfied without lock
+        request->promise.setValue(std::move(data));
+
+        delete request;
+    }
+
+    void release()
+    {
+        if (m_sqes != MAP_FAILED)
+        {
+            munmap(m_sqes, m_sqesSize);
+        }
+
+        if (m_cqRing != MAP_FAILED)
+        {
+            munmap(m_cqRing, m_cqRingSize);
+        }
+
+        if (m_sqRing != MAP_FAILED)
+        {
+            munmap(m_sqRing, m_sqRingSize);
+        }
+
+        if (m_ring >= 0)
+        {
+            close(m_ring);
+        }
+    }
+
+    int m_ring;
+
+    // Mapped rings
+    void* m_sqRing;
+    std::size_t m_sqRingSize;
+    void* m_cqRing;
+    std::size_t m_cqRingSize;
+    void* m_sqes;
+    std::size_t m_sqesSize;
+
+    unsigned* m_sqHead;
+    unsigned* m_sqTail;
+    unsigned* m_sqMask;
+    unsigned* m_sqArray;
+
+    unsigned* m_cqHead;
+    unsigned* m_cqTail;
+    unsigned* m_cqMask;
+    io_uring_cqe* m_cqes;
+
+    // Submission state
+    std::mutex m_mutex;
+    std::size_t m_queueDepth;
+    std::size_t m_inFlight;
+    std::deque<Request*> m_pending;
+    std::vector<Request*> m_failed;
+    bool m_running;
+
+    std::thread m_completionThread;
+};
+#endif
+
+AsyncFilesystemResourceAccessor::AsyncFilesystemResourceAccessor(std::size_t queueDepth,
+                                                                 std::size_t numberOfThreads,
+                                                                 AsyncFilesystemResourceAccessor::Backend backend) :
+    m_implementation(nullptr),
+    m_backend(Backend::Threads),
+    m_queueDepth(queueDepth)
+{
+    if (queueDepth == 0 || numberOfThreads == 0)
+    {
+        throw std::invalid_argument("Queue depth and number of threads can't be 0.");
+    }
+
+#ifdef HG_HAS_IO_URING
+    if (backend == Backend::IoUring)
+    {
+        try
+        {
+            m_implementation = std::make_unique<UringImplementation>(queueDepth);
+            m_backend        = Backend::IoUring;
+        }
+        catch (const std::runtime_error& error)
+        {
+            HGWarning("{}. Reading threads will be used.", error.what());
+        }
+    }
+#else
+    (void)backend;
+#endif
+
+    if (m_implementation == nullptr)
+    {
+        m_implementation = std::make_unique<ThreadsImplementation>(this, numberOfThreads);
+        m_queueDepth     = numberOfThreads;
+    }
+}
+
+AsyncFilesystemResourceAccessor::~AsyncFilesystemResourceAccessor() = default;
+
+DataPtr AsyncFilesystemResourceAccessor::loadRaw(const std::string& id)
+{
+    return loadRawAsync(id).guaranteeGet();
+}
+
+HG::Utils::FutureHandler<DataPtr> AsyncFilesystemResourceAccessor::loadRawAsync(const std::string& id)
+{
+    return m_implementation->read(id);
+}
+
+AsyncFilesystemResourceAccessor::Backend AsyncFilesystemResourceAccessor::backend() const
+{
+    return m_backend;
+}
+
+std::size_t AsyncFilesystemResourceAccessor::queueDepth() const
+{
+    return m_queueDepth;
+}
+} // namespace HG::Core
@@ -6,7 +6,14 @@
 
 namespace HG::Core
 {
-Behaviour::Behaviour(Type t) : m_type(t), m_enabled(true), m_parent(nullptr), m_properties()
+Behaviour::Behaviour(Type t) :
+    m_type(t),
+    m_enabled(true),
+    m_updateMode(UpdateMode::Serial),
+    m_started(false),
+    m_parent(nullptr),
+    m_handle(),
+    m_propertyTable(nullptr)
 {
 }
 
@@ -14,7 +21,7 @@ Behaviour::~Behaviour()
 {
     if (m_parent)
     {
-        m_parent->removeBehaviour(this);
+        m_parent->detachBehaviour(this, true);
         m_parent = nullptr;
     }
 }
@@ -34,6 +41,16 @@ void Behaviour::setEnabled(bool value)
     m_enabled = value;
 }
 
+Behaviour::UpdateMode Behaviour::updateMode() const
+{
+    return m_updateMode;
+}
+
+void Behaviour::setUpdateMode(UpdateMode mode)
+{
+    m_updateMode = mode;
+}
+
 const Input* Behaviour::input() const
 {
     if (scene() == nullptr || scene()->application() == nullptr)
@@ -51,9 +68,16 @@ void Behaviour::update()
 
 void Behaviour::start()
 {
+    m_started = true;
+
     onStart();
 }
 
+bool Behaviour::isStarted() const
+{
+    return m_started;
+}
+
 void Behaviour::onStart()
 {
 }
@@ -76,6 +100,11 @@ void Behaviour::setParentGameObject(GameObject* ptr)
     m_parent = ptr;
 }
 
+Handle<Behaviour> Behaviour::handle() const
+{
+    return m_handle;
+}
+
 Scene* Behaviour::scene() const
 {
     if (m_parent == nullptr)
@@ -86,19 +115,46 @@ Scene* Behaviour::scene() const
     return m_parent->scene();
 }
 
-void Behaviour::addProperty(Behaviour::Property property)
+const PropertyTable* Behaviour::propertyTable() const
 {
-    // todo: Add checking if property with this name already exists
-    m_properties.emplace_back(property.name(), property);
+    return m_propertyTable;
+}
+
+const PropertyTable::Entry* Behaviour::findProperty(std::string_view name) const
+{
+    const PropertyTable::Entry* entry = nullptr;
+
+    if (m_propertyTable != nullptr)
+    {
+        entry = m_propertyTable->find(name);
+    }
+
+    if (entry == nullptr)
+    {
+        throw std::invalid_argument("Unknown property \"" + std::string(name) + "\"");
+    }
+
+    return entry;
 }
 
 void Behaviour::getProperties(std::vector<Behaviour::Property>& container) const
 {
-    container.reserve(m_properties.size());
+    collectProperties(m_propertyTable, container);
+}
+
+void Behaviour::collectProperties(const PropertyTable* table, std::vector<Property>& container) const
+{
+    if (table == nullptr)
+    {
+        return;
+    }
+
+    // Properties of base types go first
+    collectProperties(table->parent(), container);
 
-    for (auto&& [name, prop] : m_properties)
+    for (auto&& entry : table->entries())
     {
-        container.push_back(prop);
+        container.emplace_back(&entry, const_cast<Behaviour*>(this));
     }
 }
 
@@ -0,0 +1,303 @@
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+
+// HG::Core
+#include <HG/Core/FrameGraph.hpp>
+#include <HG/Core/ThreadPool.hpp>
+
+namespace HG::Core
+{
+FrameGraph::FrameGraph() :
+    m_tasks(),
+    m_dirty(true),
+    m_pool(nullptr),
+    m_remainingDependencies(),
+    m_mainThreadMutex(),
+    m_mainThreadNotifier(),
+    m_mainThreadTasks(),
+    m_finishedTasks(0),
+    m_exception(),
+    m_criticalPathTime(0),
+    m_criticalPath()
+{
+}
+
+FrameGraph::~FrameGraph() = default;
+
+void FrameGraph::addTask(std::string name,
+                         std::function<void()> function,
+                         std::vector<std::string> reads,
+                         std::vector<std::string> writes,
+                         FrameGraph::Affinity affinity)
+{
+    if (hasTask(name))
+    {
+        throw std::invalid_argument("Task \"" + name + "\" is already presented.");
+    }
+
+    Task task;
+    task.name     = std::move(name);
+    task.function = std::move(function);
+    task.reads    = std::move(reads);
+    task.writes   = std::move(writes);
+    task.affinity = affinity;
+    task.duration = std::chrono::steady_clock::duration::zero();
+
+    m_tasks.emplace_back(std::move(task));
+
+    m_dirty = true;
+}
+
+void FrameGraph::removeTask(const std::string& name)
+{
+    auto iterator =
+        std::find_if(m_tasks.begin(), m_tasks.end(), [&name](const Task& task) { return task.name == name; });
+
+    if (iterator == m_tasks.end())
+    {
+        throw std::invalid_argument("There is no task \"" + name + "\".");
+    }
+
+    m_tasks.erase(iterator);
+
+    m_criticalPath.clear();
+
+    m_dirty = true;
+}
+
+bool FrameGraph::hasTask(const std::string& name) const
+{
+    return std::find_if(m_tasks.begin(), m_tasks.end(), [&name](const Task& task) { return task.name == name; }) !=
+           m_tasks.end();
+}
+
+std::size_t FrameGraph::numberOfTasks() const
+{
+    return m_tasks.size();
+}
+
+bool FrameGraph::isConflicting(const FrameGraph::Task& earlier, const FrameGraph::Task& later)
+{
+    auto intersects = [](const std::vector<std::string>& lhs, const std::vector<std::string>& rhs) {
+        for (auto&& resource : lhs)
+        {
+            if (std::find(rhs.begin(), rhs.end(), resource) != rhs.end())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    return intersects(earlier.writes, later.reads) || intersects(earlier.writes, later.writes) ||
+           intersects(earlier.reads, later.writes);
+}
+
+void FrameGraph::rebuild()
+{
+    for (auto&& task : m_tasks)
+    {
+        task.successors.clear();
+        task.predecessors.clear();
+    }
+
+    // Tasks order is already topological, because
+    // dependencies are only directed to later tasks.
+    for (std::size_t later = 0; later < m_tasks.size(); ++later)
+    {
+        for (std::size_t earlier = 0; earlier < later; ++earlier)
+        {
+            if (isConflicting(m_tasks[earlier], m_tasks[later]))
+            {
+                m_tasks[earlier].successors.push_back(later);
+                m_tasks[later].predecessors.push_back(earlier);
+            }
+        }
+    }
+
+    m_remainingDependencies = std::make_unique<std::atomic_size_t[]>(m_tasks.size());
+
+    m_dirty = false;
+}
+
+void FrameGraph::execute(ThreadPool* pool)
+{
+    if (m_dirty)
+    {
+        rebuild();
+    }
+
+    if (m_tasks.empty())
+    {
+        m_criticalPathTime = std::chrono::microseconds(0);
+        m_criticalPath.clear();
+        return;
+    }
+
+    // Pool without threads can't execute anything
+    if (pool != nullptr && pool->numberOfThreads(ThreadPool::Type::UserThread) == 0)
+    {
+        pool = nullptr;
+    }
+
+    m_pool          = pool;
+    m_finishedTasks = 0;
+    m_exception     = nullptr;
+
+    for (std::size_t index = 0; index < m_tasks.size(); ++index)
+    {
+        m_remainingDependencies[index] = m_tasks[index].predecessors.size();
+    }
+
+    for (std::size_t index = 0; index < m_tasks.size(); ++index)
+    {
+        if (m_tasks[index].predecessors.empty())
+        {
+            schedule(index);
+        }
+    }
+
+    // Executing main thread tasks, until all tasks are finished
+    std::unique_lock<std::mutex> lock(m_mainThreadMutex);
+
+    while (m_finishedTasks != m_tasks.size())
+    {
+        if (m_mainThreadTasks.empty())
+        {
+            m_mainThreadNotifier.wait(lock);
+            continue;
+        }
+
+        auto index = m_mainThreadTasks.front();
+        m_mainThreadTasks.pop_front();
+
+        lock.unlock();
+        runTask(index);
+        lock.lock();
+    }
+
+    lock.unlock();
+
+    m_pool = nullptr;
+
+    // Calculating critical path
+    std::vector<std::chrono::steady_clock::duration> pathDuration(m_tasks.size());
+    std::vector<std::size_t> pathPrevious(m_tasks.size(), m_tasks.size());
+    std::size_t pathEnd = 0;
+
+    for (std::size_t index = 0; index < m_tasks.size(); ++index)
+    {
+        auto longest = std::chrono::steady_clock::duration::zero();
+
+        for (auto&& predecessor : m_tasks[index].predecessors)
+        {
+            if (pathPrevious[index] == m_tasks.size() || pathDuration[predecessor] > longest)
+            {
+                longest             = pathDuration[predecessor];
+                pathPrevious[index] = predecessor;
+            }
+        }
+
+        pathDuration[index] = longest + m_tasks[index].duration;
+
+        if (pathDuration[index] > pathDuration[pathEnd])
+        {
+            pathEnd = index;
+        }
+    }
+
+    m_criticalPathTime = std::chrono::duration_cast<std::chrono::microseconds>(pathDuration[pathEnd]);
+
+    m_criticalPath.clear();
+
+    for (auto index = pathEnd; index != m_tasks.size(); index = pathPrevious[index])
+    {
+        m_criticalPath.push_back(index);
+    }
+
+    std::reverse(m_criticalPath.begin(), m_criticalPath.end());
+
+    if (m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+}
+
+void FrameGraph::runTask(std::size_t index)
+{
+    auto& task = m_tasks[index];
+
+    auto start = std::chrono::steady_clock::now();
+
+    try
+    {
+        if (task.function)
+        {
+            task.function();
+        }
+    }
+    catch (...)
+    {
+        std::unique_lock<std::mutex> lock(m_mainThreadMutex);
+
+        if (!m_exception)
+        {
+            m_exception = std::current_exception();
+        }
+    }
+
+    task.duration = std::chrono::steady_clock::now() - start;
+
+    for (auto&& successor : task.successors)
+    {
+        if (--m_remainingDependencies[successor] == 0)
+        {
+            schedule(successor);
+        }
+    }
+
+    // Notifying under lock, because graph may be
+    // destroyed right after last task finished.
+    std::unique_lock<std::mutex> lock(m_mainThreadMutex);
+
+    ++m_finishedTasks;
+
+    m_mainThreadNotifier.notify_one();
+}
+
+void FrameGraph::schedule(std::size_t index)
+{
+    if (m_pool == nullptr || m_tasks[index].affinity == Affinity::MainThread)
+    {
+        std::unique_lock<std::mutex> lock(m_mainThreadMutex);
+
+        m_mainThreadTasks.push_back(index);
+
+        m_mainThreadNotifier.notify_one();
+
+        return;
+    }
+
+    m_pool->push([this, index]() { runTask(index); }, ThreadPool::Type::UserThread);
+}
+
+std::chrono::microseconds FrameGraph::criticalPathTime() const
+{
+    return m_criticalPathTime;
+}
+
+std::vector<std::string> FrameGraph::criticalPath() const
+{
+    std::vector<std::string> result;
+    result.reserve(m_criticalPath.size());
+
+    for (auto&& index : m_criticalPath)
+    {
+        result.push_back(m_tasks[index].name);
+    }
+
+    return result;
+}
+} // namespace HG::Core
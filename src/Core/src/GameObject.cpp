@@ -1,3 +1,6 @@
+// C++ STL
+#include <algorithm>
+
 // HG::Core
 #include <HG/Core/Behaviour.hpp>
 #include <HG/Core/BuildProperties.hpp>
@@ -15,9 +18,17 @@
 namespace HG::Core
 {
 GameObject::GameObject() :
-    m_behaviours(),
     m_transform(new (m_cache) Transform(this)),
+    m_behaviours(),
+    m_renderBehaviours(),
+    m_typeIndex(nullptr),
+    m_typeIndexMutex(),
+    m_name(),
+    m_tag(),
+    m_layer(0),
     m_parentScene(nullptr),
+    m_handle(),
+    m_sceneOrder(0),
     m_enabled(true),
     m_hidden(false)
 {
@@ -29,6 +40,10 @@ GameObject::~GameObject()
 
     m_transform->setParent(nullptr);
 
+    // Removed behaviours are not merged into
+    // current ones, so they are deleted separately
+    destroyRemovedBehaviours();
+
     // Merge, to prevent double free
     m_behaviours.merge();
 
@@ -50,20 +65,55 @@ GameObject::~GameObject()
 
     m_renderBehaviours.clear();
 
+    for (auto entry = m_typeIndex.load(std::memory_order_acquire); entry != nullptr;)
+    {
+        auto next = entry->next;
+        delete entry;
+        entry = next;
+    }
+
     delete m_transform;
 }
 
 void GameObject::update()
 {
+    std::vector<Behaviour*> concurrentBehaviours;
+
+    update(concurrentBehaviours);
+
+    for (auto&& behaviour : concurrentBehaviours)
+    {
+        behaviour->update();
+    }
+}
+
+void GameObject::update(std::vector<Behaviour*>& concurrentBehaviours)
+{
+    // Scene deletes removed behaviours at the end of
+    // frame, so here only gameobjects outside of scene
+    // have something to delete
+    destroyRemovedBehaviours();
+
+    // Removing behaviours are not merged
+    for (auto&& behaviour : m_renderBehaviours.added())
+    {
+        if (!m_renderBehaviours.isRemoving(behaviour))
+        {
+            indexBehaviour(behaviour);
+        }
+    }
+
     // Merging rendering behaviours
     m_renderBehaviours.merge();
 
     auto newBehaviours = m_behaviours.added();
 
-    // Removing behaviours
-    for (auto&& behaviour : m_behaviours.removable())
+    for (auto&& behaviour : newBehaviours)
     {
-        delete behaviour;
+        if (!m_behaviours.isRemoving(behaviour))
+        {
+            indexBehaviour(behaviour);
+        }
     }
 
     // Merging
@@ -78,14 +128,24 @@ void GameObject::update()
     // Executing update on existing behaviours
     for (auto&& iter : m_behaviours)
     {
-        // Will this behaviour removed on
-        // next frame. If yes - behaviour
-        // will be skipped, because it can
-        // be already deleted. So on the next frame
-        // this behaviour will be removed from container.
+        // Behaviour, removed on current frame, is
+        // detached already, but not deleted until
+        // the end of frame.
         // If behaviour is disabled, it shouldn't be updated.
-        if (m_behaviours.isRemoving(iter) || !iter->isEnabled())
+        if (iter->gameObject() != this || !iter->isEnabled())
+        {
+            continue;
+        }
+
+        // Updated by scene system
+        if (iter->updateMode() == Behaviour::UpdateMode::System)
+        {
+            continue;
+        }
+
+        if (iter->updateMode() == Behaviour::UpdateMode::Concurrent)
         {
+            concurrentBehaviours.push_back(iter);
             continue;
         }
 
@@ -104,9 +164,200 @@ void GameObject::removeBehaviour(Behaviour* behaviour)
         }
     }
 
-    // Remove this gameobject as parent
-    behaviour->setParentGameObject(nullptr);
-    m_behaviours.remove(behaviour);
+    detachBehaviour(behaviour, false);
+}
+
+void GameObject::detachBehaviour(Behaviour* behaviour, bool destroyed)
+{
+    // Behaviour may be deleted by user before deferred change
+    // is applied, so only pointer, type and handle are used there.
+    // Parent and handle of alive behaviour are changed there too,
+    // so concurrent behaviours don't see them changing.
+    auto removeFromContainer = [this, behaviour, destroyed, type = behaviour->type(), handle = behaviour->handle()]() {
+        if (!destroyed)
+        {
+            // Removed already by another deferred change
+            if (behaviour->gameObject() != this)
+            {
+                return;
+            }
+
+            // Remove this gameobject as parent
+            behaviour->setParentGameObject(nullptr);
+            behaviour->m_handle = {};
+        }
+
+        if (type == Behaviour::Type::Render)
+        {
+            m_renderBehaviours.remove(static_cast<HG::Rendering::Base::RenderBehaviour*>(behaviour));
+        }
+        else
+        {
+            m_behaviours.remove(behaviour);
+        }
+
+        unindexBehaviour(behaviour);
+
+        if (m_parentScene != nullptr)
+        {
+            m_parentScene->m_behaviourHandles.remove(handle);
+            m_parentScene->m_behaviourRemovals.push_back(this);
+        }
+    };
+
+    if (Scene::isConcurrentUpdate())
+    {
+        Scene::deferStructuralChange(removeFromContainer);
+        return;
+    }
+
+    removeFromContainer();
+}
+
+void GameObject::destroyRemovedBehaviours()
+{
+    if (m_behaviours.removable().empty() && m_renderBehaviours.removable().empty())
+    {
+        return;
+    }
+
+    for (auto&& behaviour : m_renderBehaviours.removable())
+    {
+        delete behaviour;
+    }
+
+    for (auto&& behaviour : m_behaviours.removable())
+    {
+        delete behaviour;
+    }
+
+    m_renderBehaviours.mergeRemovable();
+    m_behaviours.mergeRemovable();
+}
+
+void GameObject::forEachAttachedBehaviour(const std::function<void(Behaviour*)>& function) const
+{
+    // Behaviours, removed on current frame, are still
+    // in containers, but they are detached already
+    auto attached = [this, &function](Behaviour* behaviour) {
+        if (behaviour->gameObject() == this)
+        {
+            function(behaviour);
+        }
+    };
+
+    for (auto&& behaviour : m_behaviours.added())
+    {
+        attached(behaviour);
+    }
+
+    for (auto&& behaviour : m_behaviours)
+    {
+        attached(behaviour);
+    }
+
+    for (auto&& behaviour : m_renderBehaviours.added())
+    {
+        attached(behaviour);
+    }
+
+    for (auto&& behaviour : m_renderBehaviours)
+    {
+        attached(behaviour);
+    }
+}
+
+const GameObject::TypedBehaviours&
+GameObject::indexType(std::size_t typeId, void* (*cast)(Behaviour*), bool render) const
+{
+    std::unique_lock<std::mutex> lock(m_typeIndexMutex);
+
+    auto head = m_typeIndex.load(std::memory_order_acquire);
+
+    // Indexed by another thread
+    for (auto entry = head; entry != nullptr; entry = entry->next)
+    {
+        if (entry->typeId == typeId)
+        {
+            return entry->behaviours;
+        }
+    }
+
+    auto entry = new TypeIndexEntry{typeId, cast, render, {}, head};
+
+    for (auto&& behaviour : m_behaviours)
+    {
+        if (m_behaviours.isRemoving(behaviour))
+        {
+            continue;
+        }
+
+        auto casted = cast(behaviour);
+
+        if (casted != nullptr)
+        {
+            entry->behaviours.emplace_back(behaviour, casted);
+        }
+    }
+
+    if (render)
+    {
+        for (auto&& behaviour : m_renderBehaviours)
+        {
+            if (m_renderBehaviours.isRemoving(behaviour))
+            {
+                continue;
+            }
+
+            auto casted = cast(behaviour);
+
+            if (casted != nullptr)
+            {
+                entry->behaviours.emplace_back(behaviour, casted);
+            }
+        }
+    }
+
+    // Entry is filled before it's published
+    m_typeIndex.store(entry, std::memory_order_release);
+
+    return entry->behaviours;
+}
+
+void GameObject::indexBehaviour(Behaviour* behaviour)
+{
+    auto isRender = behaviour->type() == Behaviour::Type::Render;
+
+    for (auto entry = m_typeIndex.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+    {
+        if (isRender && !entry->render)
+        {
+            continue;
+        }
+
+        auto casted = entry->cast(behaviour);
+
+        if (casted != nullptr)
+        {
+            entry->behaviours.emplace_back(behaviour, casted);
+        }
+    }
+}
+
+void GameObject::unindexBehaviour(Behaviour* behaviour)
+{
+    for (auto entry = m_typeIndex.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+    {
+        auto& behaviours = entry->behaviours;
+
+        auto iterator = std::find_if(
+            behaviours.begin(), behaviours.end(), [behaviour](auto&& indexed) { return indexed.first == behaviour; });
+
+        if (iterator != behaviours.end())
+        {
+            behaviours.erase(iterator);
+        }
+    }
 }
 
 Scene* GameObject::scene() const
@@ -114,6 +365,11 @@ Scene* GameObject::scene() const
     return m_parentScene;
 }
 
+Handle<GameObject> GameObject::handle() const
+{
+    return m_handle;
+}
+
 void GameObject::setParentScene(Scene* parent)
 {
     m_parentScene = parent;
@@ -121,6 +377,12 @@ void GameObject::setParentScene(Scene* parent)
 
 void GameObject::addBehaviour(Behaviour* behaviour)
 {
+    if (Scene::isConcurrentUpdate())
+    {
+        Scene::deferStructuralChange([this, behaviour]() { addBehaviour(behaviour); });
+        return;
+    }
+
     behaviour->setParentGameObject(this);
 
     switch (behaviour->type())
@@ -142,18 +404,86 @@ void GameObject::addBehaviour(Behaviour* behaviour)
         break;
     }
     }
+
+    if (m_parentScene != nullptr)
+    {
+        m_parentScene->registerBehaviour(behaviour);
+    }
 }
 
 void GameObject::setName(std::string name)
 {
+    if (m_parentScene == nullptr)
+    {
+        m_name = std::move(name);
+        return;
+    }
+
+    // Scene indices can't be changed concurrently
+    if (Scene::isConcurrentUpdate())
+    {
+        Scene::deferStructuralChange([this, name = std::move(name)]() mutable { setName(std::move(name)); });
+        return;
+    }
+
+    m_parentScene->unindexGameObject(this);
     m_name = std::move(name);
+    m_parentScene->indexGameObject(this);
 }
 
-std::string GameObject::name() const
+const std::string& GameObject::name() const
 {
     return m_name;
 }
 
+void GameObject::setTag(std::string tag)
+{
+    if (m_parentScene == nullptr)
+    {
+        m_tag = std::move(tag);
+        return;
+    }
+
+    if (Scene::isConcurrentUpdate())
+    {
+        Scene::deferStructuralChange([this, tag = std::move(tag)]() mutable { setTag(std::move(tag)); });
+        return;
+    }
+
+    m_parentScene->unindexGameObject(this);
+    m_tag = std::move(tag);
+    m_parentScene->indexGameObject(this);
+}
+
+const std::string& GameObject::tag() const
+{
+    return m_tag;
+}
+
+void GameObject::setLayer(std::uint32_t layer)
+{
+    if (m_parentScene == nullptr)
+    {
+        m_layer = layer;
+        return;
+    }
+
+    if (Scene::isConcurrentUpdate())
+    {
+        Scene::deferStructuralChange([this, layer]() { setLayer(layer); });
+        return;
+    }
+
+    m_parentScene->unindexGameObject(this);
+    m_layer = layer;
+    m_parentScene->indexGameObject(this);
+}
+
+std::uint32_t GameObject::layer() const
+{
+    return m_layer;
+}
+
 Transform* GameObject::transform()
 {
     return m_transform;
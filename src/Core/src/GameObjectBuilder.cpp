@@ -91,6 +91,20 @@ GameObjectBuilder& GameObjectBuilder::setName(std::string name)
     return (*this);
 }
 
+GameObjectBuilder& GameObjectBuilder::setTag(std::string tag)
+{
+    m_currentGameObject->setTag(std::move(tag));
+
+    return (*this);
+}
+
+GameObjectBuilder& GameObjectBuilder::setLayer(std::uint32_t layer)
+{
+    m_currentGameObject->setLayer(layer);
+
+    return (*this);
+}
+
 GameObjectBuilder& GameObjectBuilder::setParent(GameObject* parent)
 {
     if (parent == nullptr)
@@ -0,0 +1,110 @@
+// C++ STL
+#include <numeric>
+
+// HG::Core
+#include <HG/Core/MainThreadDispatcher.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+
+namespace HG::Core
+{
+MainThreadDispatcher::MainThreadDispatcher() :
+    m_mutex(),
+    m_jobs(),
+    m_budget(std::chrono::milliseconds(4)),
+    m_lastExecutionTime(0)
+{
+}
+
+void MainThreadDispatcher::push(MainThreadDispatcher::Job job, MainThreadDispatcher::Priority priority)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_jobs[static_cast<std::size_t>(priority)].push_back(std::move(job));
+}
+
+void MainThreadDispatcher::setBudget(std::chrono::microseconds budget)
+{
+    m_budget = budget;
+}
+
+std::chrono::microseconds MainThreadDispatcher::budget() const
+{
+    return m_budget;
+}
+
+bool MainThreadDispatcher::takeJob(MainThreadDispatcher::Job& job)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (auto&& jobs : m_jobs)
+    {
+        if (!jobs.empty())
+        {
+            job = std::move(jobs.front());
+            jobs.pop_front();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t MainThreadDispatcher::execute()
+{
+    auto start    = std::chrono::steady_clock::now();
+    auto deadline = start + m_budget;
+
+    std::size_t numberOfExecuted = 0;
+
+    Job job;
+
+    do
+    {
+        if (!takeJob(job))
+        {
+            break;
+        }
+
+        try
+        {
+            job();
+        }
+        catch (std::exception& exception)
+        {
+            HGError("Main thread job received exception: {}", exception.what());
+        }
+
+        ++numberOfExecuted;
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    m_lastExecutionTime =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    return numberOfExecuted;
+}
+
+std::size_t MainThreadDispatcher::numberOfPendingJobs() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    return std::accumulate(
+        m_jobs.begin(), m_jobs.end(), std::size_t(0), [](std::size_t sum, const std::deque<Job>& jobs) {
+            return sum + jobs.size();
+        });
+}
+
+std::size_t MainThreadDispatcher::numberOfPendingJobs(MainThreadDispatcher::Priority priority) const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    return m_jobs[static_cast<std::size_t>(priority)].size();
+}
+
+std::chrono::microseconds MainThreadDispatcher::lastExecutionTime() const
+{
+    return m_lastExecutionTime;
+}
+} // namespace HG::Core
@@ -0,0 +1,134 @@
+// HG::Core
+#include <HG/Core/MappedFileResourceAccessor.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+#include <HG/Utils/Platform.hpp>
+
+#ifdef OS_LINUX
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#ifdef OS_WINDOWS
+#    include <windows.h>
+#endif
+
+namespace HG::Core
+{
+MappedFileResourceAccessor::MappedData::MappedData(void* address, std::size_t size, std::string id) :
+    m_address(address),
+    m_size(size),
+    m_id(std::move(id))
+{
+}
+
+MappedFileResourceAccessor::MappedData::~MappedData()
+{
+#ifdef OS_LINUX
+    munmap(m_address, m_size);
+#endif
+
+#ifdef OS_WINDOWS
+    UnmapViewOfFile(m_address);
+#endif
+}
+
+std::size_t MappedFileResourceAccessor::MappedData::size() const
+{
+    return m_size;
+}
+
+const std::byte* MappedFileResourceAccessor::MappedData::data() const
+{
+    return static_cast<const std::byte*>(m_address);
+}
+
+std::string MappedFileResourceAccessor::MappedData::id() const
+{
+    return m_id;
+}
+
+DataPtr MappedFileResourceAccessor::loadRaw(const std::string& id)
+{
+#ifdef OS_LINUX
+    auto fd = open(id.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        HGWarning("Can't open file \"{}\".", id);
+        return nullptr;
+    }
+
+    struct stat status;
+
+    if (fstat(fd, &status) != 0 || status.st_size <= 0)
+    {
+        // Empty files can't be mapped
+        close(fd);
+        return FilesystemResourceAccessor::loadRaw(id);
+    }
+
+    auto size    = static_cast<std::size_t>(status.st_size);
+    auto address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // Mapping keeps reference to file
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        HGWarning("Can't map file \"{}\", it will be read.", id);
+        return FilesystemResourceAccessor::loadRaw(id);
+    }
+
+    // Starting read ahead, loaders will read whole file
+    madvise(address, size, MADV_WILLNEED);
+
+    return std::make_shared<MappedData>(address, size, id);
+#elif defined(OS_WINDOWS)
+    auto file = CreateFileA(
+        id.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        HGWarning("Can't open file \"{}\".", id);
+        return nullptr;
+    }
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+    {
+        // Empty files can't be mapped
+        CloseHandle(file);
+        return FilesystemResourceAccessor::loadRaw(id);
+    }
+
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    void* address = nullptr;
+
+    if (mapping != nullptr)
+    {
+        address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        // View keeps reference to mapping
+        CloseHandle(mapping);
+    }
+
+    CloseHandle(file);
+
+    if (address == nullptr)
+    {
+        HGWarning("Can't map file \"{}\", it will be read.", id);
+        return FilesystemResourceAccessor::loadRaw(id);
+    }
+
+    return std::make_shared<MappedData>(address, static_cast<std::size_t>(size.QuadPart), id);
+#else
+    return FilesystemResourceAccessor::loadRaw(id);
+#endif
+}
+} // namespace HG::Core
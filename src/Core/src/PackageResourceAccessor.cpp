@@ -0,0 +1,500 @@
+// C++ STL
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/FilesystemResourceAccessor.hpp>
+#include <HG/Core/MappedFileResourceAccessor.hpp>
+#include <HG/Core/PackageResourceAccessor.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+
+// ZLib
+#include <zlib.h>
+
+namespace
+{
+constexpr std::uint32_t PackageMagic              = 0xDEC0DE00;
+constexpr std::uint32_t SupportedVersion          = 2;
+constexpr std::size_t HeaderSize                  = 32;
+constexpr std::size_t HeaderSizeVersion2          = 48;
+constexpr std::size_t MetadataHeaderSize          = 8;
+constexpr std::size_t FileEntryHeaderSize         = 32;
+constexpr std::size_t FileEntryHeaderSizeVersion2 = 48;
+constexpr std::size_t BlockEntrySize              = 8;
+constexpr std::size_t Alignment                   = 16;
+constexpr std::uint8_t DirectoryEntryType         = 0x01;
+constexpr std::uint8_t FileEntryType              = 0x02;
+constexpr std::size_t InflateInitialFactor        = 4;
+constexpr std::size_t InflateMinimalCapacity      = 4096;
+
+/**
+ * @brief Function for getting number of padding bytes
+ * after field. Packer always adds padding, even if
+ * field is already aligned.
+ */
+std::size_t padding(std::size_t size)
+{
+    return Alignment - size % Alignment;
+}
+
+/**
+ * @brief Class for reading big endian values from
+ * package with bounds checking.
+ */
+class Reader
+{
+public:
+    Reader(const std::byte* data, std::size_t size) : m_data(data), m_size(size), m_position(0)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        require(sizeof(T));
+
+        T value = 0;
+
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+        {
+            value = static_cast<T>((value << 8u) | std::to_integer<T>(m_data[m_position + i]));
+        }
+
+        m_position += sizeof(T);
+
+        return value;
+    }
+
+    std::string readString(std::size_t length)
+    {
+        require(length);
+
+        std::string result(reinterpret_cast<const char*>(m_data + m_position), length);
+
+        m_position += length;
+
+        return result;
+    }
+
+    void skip(std::size_t length)
+    {
+        require(length);
+
+        m_position += length;
+    }
+
+private:
+    void require(std::size_t length) const
+    {
+        if (length > m_size || m_position > m_size - length)
+        {
+            throw std::invalid_argument("Package is smaller than expected");
+        }
+    }
+
+    const std::byte* m_data;
+    std::size_t m_size;
+    std::size_t m_position;
+};
+} // namespace
+
+namespace HG::Core
+{
+PackageResourceAccessor::PackageResourceAccessor(const std::string& path) :
+    m_path(path),
+    m_package(MappedFileResourceAccessor().loadRaw(path)),
+    m_entries()
+{
+    if (m_package == nullptr)
+    {
+        throw std::invalid_argument("Can't open package \"" + path + "\"");
+    }
+
+    readIndex();
+}
+
+void PackageResourceAccessor::readIndex()
+{
+    Reader reader(m_package->data(), m_package->size());
+
+    if (reader.read<std::uint32_t>() != PackageMagic)
+    {
+        throw std::invalid_argument("Package has wrong magic bytes");
+    }
+
+    // CRC32 and package size
+    auto crc = reader.read<std::uint32_t>();
+    reader.skip(8);
+
+    auto version = reader.read<std::uint32_t>();
+
+    if (version > SupportedVersion)
+    {
+        throw std::invalid_argument("Package version " + std::to_string(version) + " is not supported");
+    }
+
+    auto numberOfMetadataFields = reader.read<std::uint32_t>();
+    auto numberOfFileFields     = reader.read<std::uint32_t>();
+
+    std::uint32_t blockSize = 0;
+
+    if (version < 2)
+    {
+        reader.skip(HeaderSize - 28);
+    }
+    else
+    {
+        blockSize = reader.read<std::uint32_t>();
+
+        auto directoryOffset = reader.read<std::uint64_t>();
+        auto directorySize   = reader.read<std::uint64_t>();
+
+        if (blockSize == 0 || directoryOffset < HeaderSizeVersion2 || directoryOffset > m_package->size() ||
+            directorySize > m_package->size() - directoryOffset)
+        {
+            throw std::invalid_argument("Package has wrong header");
+        }
+
+        auto* directory = m_package->data() + directoryOffset;
+
+        // Directory is small, unlike whole package
+        if (crc32(crc32(0L, nullptr, 0), reinterpret_cast<const Bytef*>(directory), directorySize) != crc)
+        {
+            throw std::invalid_argument("Package directory is damaged");
+        }
+
+        // Data can't be placed after directory
+        reader = Reader(m_package->data(), directoryOffset + directorySize);
+        reader.skip(directoryOffset);
+    }
+
+    // Metadata is not required for accessing
+    for (std::uint32_t index = 0; index < numberOfMetadataFields; ++index)
+    {
+        reader.skip(4);
+
+        auto length = reader.read<std::uint32_t>();
+
+        reader.skip(length + padding(MetadataHeaderSize + length));
+    }
+
+    // Paths of directories by id
+    std::unordered_map<std::uint32_t, std::filesystem::path> directories;
+
+    for (std::uint32_t index = 0; index < numberOfFileFields; ++index)
+    {
+        auto type = reader.read<std::uint8_t>();
+
+        reader.skip(3);
+
+        Entry entry = {};
+
+        auto id              = reader.read<std::uint32_t>();
+        auto parentId        = reader.read<std::uint32_t>();
+        auto nameLength      = reader.read<std::uint32_t>();
+        entry.offset         = reader.read<std::uint64_t>();
+        entry.compressedSize = reader.read<std::uint64_t>();
+
+        std::uint32_t numberOfBlocks = 0;
+
+        if (version >= 2)
+        {
+            entry.size      = reader.read<std::uint64_t>();
+            entry.crc       = reader.read<std::uint32_t>();
+            entry.blockSize = blockSize;
+            numberOfBlocks  = reader.read<std::uint32_t>();
+        }
+
+        auto name = reader.readString(nameLength);
+
+        reader.skip(padding((version < 2 ? FileEntryHeaderSize : FileEntryHeaderSizeVersion2) + nameLength));
+
+        std::filesystem::path entryPath;
+
+        if (parentId != 0)
+        {
+            auto parent = directories.find(parentId);
+
+            if (parent == directories.end())
+            {
+                throw std::invalid_argument("Wrong file entries sequence");
+            }
+
+            entryPath = parent->second;
+        }
+
+        entryPath /= name;
+
+        switch (type)
+        {
+        case DirectoryEntryType:
+            directories[id] = std::move(entryPath);
+            break;
+        case FileEntryType:
+            if (entry.offset > m_package->size() || entry.compressedSize > m_package->size() - entry.offset)
+            {
+                throw std::invalid_argument("Package entry \"" + entryPath.generic_string() + "\" is out of package");
+            }
+
+            if (version >= 2)
+            {
+                if (numberOfBlocks != (entry.size + blockSize - 1) / blockSize)
+                {
+                    throw std::invalid_argument("Package entry \"" + entryPath.generic_string() +
+                                                "\" has wrong number of blocks");
+                }
+
+                auto blockOffset = entry.offset;
+
+                entry.blocks.resize(numberOfBlocks);
+
+                for (auto& block : entry.blocks)
+                {
+                    block.offset         = blockOffset;
+                    block.compressedSize = reader.read<std::uint32_t>();
+                    block.crc            = reader.read<std::uint32_t>();
+
+                    blockOffset += block.compressedSize;
+                }
+
+                if (blockOffset - entry.offset != entry.compressedSize)
+                {
+                    throw std::invalid_argument("Package entry \"" + entryPath.generic_string() +
+                                                "\" has wrong blocks table");
+                }
+
+                reader.skip(padding(BlockEntrySize * numberOfBlocks));
+            }
+
+            m_entries[entryPath.generic_string()] = std::move(entry);
+            break;
+        default:
+            throw std::invalid_argument("Unknown file entry type found");
+        }
+    }
+}
+
+DataPtr PackageResourceAccessor::loadRaw(const std::string& id)
+{
+    auto* entry = findEntry(id);
+
+    if (entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (entry->blockSize == 0)
+    {
+        return inflateStream(*entry, id);
+    }
+
+    return inflateBlocks(*entry, id, 0, entry->size);
+}
+
+DataPtr PackageResourceAccessor::loadRange(const std::string& id, std::size_t offset, std::size_t size)
+{
+    auto* entry = findEntry(id);
+
+    if (entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (entry->blockSize != 0)
+    {
+        if (offset > entry->size)
+        {
+            HGError("Range offset {} is out of \"{}\" with size {}.", offset, id, entry->size);
+            return nullptr;
+        }
+
+        return inflateBlocks(*entry, id, offset, std::min<std::uint64_t>(size, entry->size - offset));
+    }
+
+    // Single stream can't be inflated partially
+    auto data = inflateStream(*entry, id);
+
+    if (data == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (offset > data->size())
+    {
+        HGError("Range offset {} is out of \"{}\" with size {}.", offset, id, data->size());
+        return nullptr;
+    }
+
+    size = std::min(size, data->size() - offset);
+
+    std::vector<std::byte> range(data->data() + offset, data->data() + offset + size);
+
+    return std::make_shared<FilesystemResourceAccessor::VectorData>(std::move(range), id);
+}
+
+DataPtr PackageResourceAccessor::inflateStream(const Entry& entry, const std::string& id) const
+{
+    z_stream stream = {};
+
+    if (inflateInit(&stream) != Z_OK)
+    {
+        HGError("Can't init inflating of \"{}\".", id);
+        return nullptr;
+    }
+
+    // Every inflate call is limited by uInt
+    std::vector<std::byte> data(
+        std::max<std::size_t>(entry.compressedSize * InflateInitialFactor, InflateMinimalCapacity));
+
+    auto* input          = m_package->data() + entry.offset;
+    std::size_t consumed = 0;
+    std::size_t produced = 0;
+
+    int result = Z_OK;
+
+    while (result != Z_STREAM_END)
+    {
+        if (produced == data.size())
+        {
+            data.resize(data.size() * 2);
+        }
+
+        auto inputChunk  = std::min<std::size_t>(entry.compressedSize - consumed, std::numeric_limits<uInt>::max());
+        auto outputChunk = std::min<std::size_t>(data.size() - produced, std::numeric_limits<uInt>::max());
+
+        stream.next_in   = reinterpret_cast<Bytef*>(const_cast<std::byte*>(input + consumed));
+        stream.avail_in  = static_cast<uInt>(inputChunk);
+        stream.next_out  = reinterpret_cast<Bytef*>(data.data() + produced);
+        stream.avail_out = static_cast<uInt>(outputChunk);
+
+        result = inflate(&stream, Z_NO_FLUSH);
+
+        consumed += inputChunk - stream.avail_in;
+        produced += outputChunk - stream.avail_out;
+
+        // Buffer error is returned if no progress
+        // was possible, that means truncated stream
+        if (result != Z_OK && result != Z_STREAM_END)
+        {
+            inflateEnd(&stream);
+            HGError("Can't inflate \"{}\" from package \"{}\".", id, m_path);
+            return nullptr;
+        }
+    }
+
+    inflateEnd(&stream);
+
+    data.resize(produced);
+
+    return std::make_shared<FilesystemResourceAccessor::VectorData>(std::move(data), id);
+}
+
+DataPtr PackageResourceAccessor::inflateBlocks(const Entry& entry,
+                                               const std::string& id,
+                                               std::uint64_t offset,
+                                               std::uint64_t size) const
+{
+    std::vector<std::byte> data(size);
+
+    if (size == 0)
+    {
+        return std::make_shared<FilesystemResourceAccessor::VectorData>(std::move(data), id);
+    }
+
+    // Used for blocks, that are partially requested
+    std::vector<std::byte> partial;
+
+    auto firstBlock = offset / entry.blockSize;
+    auto lastBlock  = (offset + size - 1) / entry.blockSize;
+
+    for (auto index = firstBlock; index <= lastBlock; ++index)
+    {
+        const auto& block = entry.blocks[index];
+
+        auto blockBegin  = index * entry.blockSize;
+        auto blockLength = std::min<std::uint64_t>(entry.blockSize, entry.size - blockBegin);
+
+        // Inflating right into result if whole block is required
+        auto isWhole = blockBegin >= offset && blockBegin + blockLength <= offset + size;
+
+        if (!isWhole)
+        {
+            partial.resize(blockLength);
+        }
+
+        auto* target = isWhole ? data.data() + (blockBegin - offset) : partial.data();
+        auto* source = m_package->data() + block.offset;
+
+        // Block is stored without compression
+        if (block.compressedSize == blockLength)
+        {
+            std::memcpy(target, source, blockLength);
+        }
+        else
+        {
+            auto inflatedSize = static_cast<uLongf>(blockLength);
+
+            if (uncompress(reinterpret_cast<Bytef*>(target),
+                           &inflatedSize,
+                           reinterpret_cast<const Bytef*>(source),
+                           block.compressedSize) != Z_OK ||
+                inflatedSize != blockLength)
+            {
+                HGError("Can't inflate block {} of \"{}\" from package \"{}\".", index, id, m_path);
+                return nullptr;
+            }
+        }
+
+        if (crc32(crc32(0L, nullptr, 0), reinterpret_cast<const Bytef*>(target), static_cast<uInt>(blockLength)) !=
+            block.crc)
+        {
+            HGError("Block {} of \"{}\" from package \"{}\" is damaged.", index, id, m_path);
+            return nullptr;
+        }
+
+        if (!isWhole)
+        {
+            auto from = std::max(offset, blockBegin);
+            auto to   = std::min(offset + size, blockBegin + blockLength);
+
+            std::memcpy(data.data() + (from - offset), partial.data() + (from - blockBegin), to - from);
+        }
+    }
+
+    return std::make_shared<FilesystemResourceAccessor::VectorData>(std::move(data), id);
+}
+
+const PackageResourceAccessor::Entry* PackageResourceAccessor::findEntry(const std::string& id) const
+{
+    auto iter = m_entries.find(normalize(id));
+
+    if (iter == m_entries.end())
+    {
+        HGWarning("There is no \"{}\" file in package \"{}\".", id, m_path);
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+bool PackageResourceAccessor::hasEntry(const std::string& id) const
+{
+    return m_entries.find(normalize(id)) != m_entries.end();
+}
+
+std::size_t PackageResourceAccessor::numberOfEntries() const
+{
+    return m_entries.size();
+}
+
+std::string PackageResourceAccessor::normalize(const std::string& id)
+{
+    return std::filesystem::path(id).lexically_normal().generic_string();
+}
+} // namespace HG::Core
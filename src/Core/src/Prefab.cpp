@@ -0,0 +1,228 @@
+// C++ STL
+#include <stdexcept>
+#include <utility>
+
+// HG::Core
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/Prefab.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/Transform.hpp>
+
+namespace HG::Core
+{
+Prefab::BehaviourTemplate::BehaviourTemplate(Factory factory) : m_factory(std::move(factory)), m_properties()
+{
+}
+
+Behaviour* Prefab::BehaviourTemplate::instantiate(Scene* scene)
+{
+    auto behaviour = m_factory(scene);
+
+    try
+    {
+        for (auto&& property : m_properties)
+        {
+            if (property.entry == nullptr)
+            {
+                property.entry = behaviour->propertyTable() != nullptr
+                                     ? behaviour->propertyTable()->find(property.name)
+                                     : nullptr;
+
+                if (property.entry == nullptr)
+                {
+                    throw std::invalid_argument("Property \"" + property.name + "\" does not exist.");
+                }
+            }
+
+            property.apply(Behaviour::Property(property.entry, behaviour));
+        }
+    }
+    catch (...)
+    {
+        delete behaviour;
+        throw;
+    }
+
+    return behaviour;
+}
+
+Prefab::Node::Node(std::size_t index, std::size_t parent) :
+    m_index(index),
+    m_parent(parent),
+    m_name(),
+    m_tag(),
+    m_layer(0),
+    m_enabled(true),
+    m_hidden(false),
+    m_localPosition(),
+    m_localRotation(1.0f, 0.0f, 0.0f, 0.0f),
+    m_localScale(1.0f, 1.0f, 1.0f),
+    m_behaviours()
+{
+}
+
+Prefab::Node& Prefab::Node::setName(std::string name)
+{
+    m_name = std::move(name);
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setTag(std::string tag)
+{
+    m_tag = std::move(tag);
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setLayer(std::uint32_t layer)
+{
+    m_layer = layer;
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setHidden(bool hidden)
+{
+    m_hidden = hidden;
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setLocalPosition(const glm::vec3& position)
+{
+    m_localPosition = position;
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setLocalRotation(const glm::quat& rotation)
+{
+    m_localRotation = rotation;
+
+    return (*this);
+}
+
+Prefab::Node& Prefab::Node::setLocalScale(const glm::vec3& scale)
+{
+    m_localScale = scale;
+
+    return (*this);
+}
+
+Prefab::BehaviourTemplate& Prefab::Node::addBehaviour(BehaviourTemplate::Factory factory)
+{
+    return m_behaviours.emplace_back(std::move(factory));
+}
+
+Prefab::Prefab(ResourceCache* cache) : m_cache(cache), m_nodes()
+{
+    m_nodes.emplace_back(0, 0);
+}
+
+Prefab::Node& Prefab::root()
+{
+    return m_nodes.front();
+}
+
+Prefab::Node& Prefab::addChild(const Node& parent)
+{
+    if (parent.m_index >= m_nodes.size() || &m_nodes[parent.m_index] != &parent)
+    {
+        throw std::invalid_argument("Parent node belongs to another prefab.");
+    }
+
+    return m_nodes.emplace_back(m_nodes.size(), parent.m_index);
+}
+
+std::size_t Prefab::size() const
+{
+    return m_nodes.size();
+}
+
+void Prefab::reserve(std::size_t count)
+{
+    m_cache->reserve<GameObject>(count * m_nodes.size());
+    m_cache->reserve<Transform>(count * m_nodes.size());
+}
+
+void Prefab::spawn(Scene* scene, std::size_t count, std::vector<GameObject*>& roots)
+{
+    if (scene == nullptr)
+    {
+        throw std::invalid_argument("Prefab can't be spawned without scene.");
+    }
+
+    reserve(count);
+
+    std::vector<GameObject*> spawned;
+    spawned.reserve(count * m_nodes.size());
+
+    try
+    {
+        for (std::size_t instance = 0; instance < count; ++instance)
+        {
+            auto first = spawned.size();
+
+            for (auto&& node : m_nodes)
+            {
+                auto gameObject = new (m_cache) GameObject;
+
+                spawned.push_back(gameObject);
+
+                // Not in scene yet, so indices are not updated
+                gameObject->setName(node.m_name);
+                gameObject->setTag(node.m_tag);
+                gameObject->setLayer(node.m_layer);
+                gameObject->setEnabled(node.m_enabled);
+                gameObject->setHidden(node.m_hidden);
+
+                auto transform = gameObject->transform();
+
+                // Parent is set before local values,
+                // because it keeps global values
+                if (node.m_index != 0)
+                {
+                    transform->setParent(spawned[first + node.m_parent]->transform());
+                }
+
+                transform->setLocalPosition(node.m_localPosition);
+                transform->setLocalRotation(node.m_localRotation);
+                transform->setLocalScale(node.m_localScale);
+
+                for (auto&& behaviour : node.m_behaviours)
+                {
+                    gameObject->addBehaviour(behaviour.instantiate(scene));
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        // Children are deleted before parents
+        for (auto iterator = spawned.rbegin(); iterator != spawned.rend(); ++iterator)
+        {
+            delete *iterator;
+        }
+
+        throw;
+    }
+
+    roots.reserve(roots.size() + count);
+
+    for (std::size_t instance = 0; instance < count; ++instance)
+    {
+        roots.push_back(spawned[instance * m_nodes.size()]);
+    }
+
+    scene->addGameObjects(spawned);
+}
+} // namespace HG::Core
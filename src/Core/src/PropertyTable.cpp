@@ -0,0 +1,48 @@
+// HG::Core
+#include <HG/Core/PropertyTable.hpp>
+
+namespace HG::Core
+{
+PropertyTable::PropertyTable() : m_parent(nullptr), m_entries(), m_names(), m_mutex()
+{
+}
+
+void PropertyTable::add(Entry entry, const PropertyTable* parent)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_entries.empty())
+    {
+        m_parent = parent;
+    }
+
+    auto& added = m_entries.emplace_back(std::move(entry));
+
+    m_names[added.name] = &added;
+}
+
+const PropertyTable::Entry* PropertyTable::find(std::string_view name) const
+{
+    for (auto table = this; table != nullptr; table = table->m_parent)
+    {
+        auto iterator = table->m_names.find(name);
+
+        if (iterator != table->m_names.end())
+        {
+            return iterator->second;
+        }
+    }
+
+    return nullptr;
+}
+
+const PropertyTable* PropertyTable::parent() const
+{
+    return m_parent;
+}
+
+const std::deque<PropertyTable::Entry>& PropertyTable::entries() const
+{
+    return m_entries;
+}
+} // namespace HG::Core
@@ -1,3 +1,6 @@
+// C++ STL
+#include <stdexcept>
+
 // HG::Core
 #include <HG/Core/Application.hpp>
 #include <HG/Core/ResourceAccessor.hpp>
@@ -6,14 +9,45 @@
 // HG::Utils
 #include <HG/Utils/Logging.hpp>
 
+namespace
+{
+// Default number of reads in flight
+constexpr std::size_t DefaultReadingConcurrency = 16;
+} // namespace
+
 namespace HG::Core
 {
-ResourceManager::ResourceManager(Application* parent) : m_accessor(nullptr), m_application(parent)
+ResourceManager::StageSlot::StageSlot(ResourceManager* manager, StageData* stage) : m_manager(manager), m_stage(stage)
+{
+}
+
+ResourceManager::StageSlot::~StageSlot()
 {
+    m_manager->finish(*m_stage);
+}
+
+ResourceManager::ResourceManager(Application* parent) :
+    m_accessor(nullptr),
+    m_application(parent),
+    m_assetCache(),
+    m_readingStage(ThreadPool::Type::FileLoadingThread, DefaultReadingConcurrency),
+    m_decodingStage(ThreadPool::Type::UserThread, 1)
+{
+    // One user thread is left for frame jobs
+    if (m_application != nullptr && m_application->threadPool() != nullptr)
+    {
+        auto userThreads = m_application->threadPool()->numberOfThreads(ThreadPool::Type::UserThread);
+
+        m_decodingStage.concurrency = userThreads > 1 ? userThreads - 1 : 1;
+    }
 }
 
 ResourceManager::~ResourceManager()
 {
+    // Reading jobs are pushing decoding jobs
+    stop(m_readingStage);
+    stop(m_decodingStage);
+
     delete m_accessor;
 }
 
@@ -27,26 +61,183 @@ ResourceAccessor* ResourceManager::resourceAccessor() const
     return m_accessor;
 }
 
-DataPtr ResourceManager::loadRawFromAccessor(const std::string& id)
+AssetCache* ResourceManager::assetCache()
+{
+    return &m_assetCache;
+}
+
+void ResourceManager::loadInStages(const std::string& id, DecodeFunction decode)
+{
+    enqueue(m_readingStage, [this, id, decode = std::move(decode)]() mutable {
+        HGInfo("Loading resource \"{}\"", id);
+
+        // Released, when read is finished or failed
+        auto slot = std::make_shared<StageSlot>(this, &m_readingStage);
+
+        auto startDecoding = [this, id, slot, decode](DataPtr data) mutable {
+            if (data == nullptr)
+            {
+                HGError("Can't load \"{}\" resource. See errors above.", id);
+            }
+
+            enqueue(m_decodingStage, [this, decode = std::move(decode), data = std::move(data)]() {
+                StageSlot decodingSlot(this, &m_decodingStage);
+
+                decode(data);
+            });
+
+            // Reading is finished after decoding
+            // job was queued
+            slot.reset();
+        };
+
+        if (m_accessor == nullptr)
+        {
+            HGError("Trying to load \"{}\" resource, without ResourceAccessor.", id);
+            startDecoding(nullptr);
+            return;
+        }
+
+        try
+        {
+            // Continuation is executed in this thread, if
+            // accessor is synchronous. Otherwise - in
+            // thread, that has finished reading.
+            m_accessor->loadRawAsync(id).then(std::move(startDecoding));
+        }
+        catch (const std::exception& exception)
+        {
+            HGError("Can't load \"{}\" resource: {}", id, exception.what());
+            startDecoding(nullptr);
+        }
+    });
+}
+
+void ResourceManager::enqueue(StageData& stage, ThreadPool::Job job)
 {
-    HGInfo("Loading resource \"{}\"", id);
+    {
+        std::unique_lock<std::mutex> lock(stage.mutex);
+
+        if (stage.active >= stage.concurrency)
+        {
+            stage.waiting.push_back(std::move(job));
+            return;
+        }
+
+        ++stage.active;
+    }
+
+    application()->threadPool()->push(std::move(job), stage.threadType);
+}
+
+void ResourceManager::finish(StageData& stage)
+{
+    ThreadPool::Job next;
+
+    {
+        std::unique_lock<std::mutex> lock(stage.mutex);
+
+        // Concurrency may be decreased
+        if (stage.waiting.empty() || stage.active > stage.concurrency)
+        {
+            if (--stage.active == 0)
+            {
+                stage.idle.notify_all();
+            }
+
+            return;
+        }
 
-    if (m_accessor == nullptr)
+        next = std::move(stage.waiting.front());
+        stage.waiting.pop_front();
+    }
+
+    application()->threadPool()->push(std::move(next), stage.threadType);
+}
+
+void ResourceManager::setStageConcurrency(Stage stage, std::size_t concurrency)
+{
+    if (concurrency == 0)
     {
-        HGError("Trying to load \"{}\" resource, without ResourceAccessor.", id);
-        return nullptr;
+        throw std::invalid_argument("Stage concurrency can't be 0");
     }
 
-    auto data = m_accessor->loadRaw(id);
+    auto& data = stageData(stage);
+
+    std::deque<ThreadPool::Job> started;
 
-    if (data == nullptr)
     {
-        HGError("Can't load \"{}\" resource. See errors above.", id);
+        std::unique_lock<std::mutex> lock(data.mutex);
+
+        data.concurrency = concurrency;
 
-        return nullptr;
+        // Starting queued jobs, if concurrency was increased
+        while (data.active < data.concurrency && !data.waiting.empty())
+        {
+            ++data.active;
+            started.push_back(std::move(data.waiting.front()));
+            data.waiting.pop_front();
+        }
+    }
+
+    for (auto&& job : started)
+    {
+        application()->threadPool()->push(std::move(job), data.threadType);
     }
+}
+
+void ResourceManager::stop(StageData& stage)
+{
+    std::deque<ThreadPool::Job> dropped;
+
+    std::unique_lock<std::mutex> lock(stage.mutex);
+
+    dropped.swap(stage.waiting);
+
+    stage.idle.wait(lock, [&stage]() { return stage.active == 0; });
+
+    lock.unlock();
+
+    // Jobs are destroyed without lock, because
+    // abandoned promises execute continuations
+    dropped.clear();
+}
 
-    return data;
+std::size_t ResourceManager::stageConcurrency(Stage stage) const
+{
+    auto& data = stageData(stage);
+
+    std::unique_lock<std::mutex> lock(data.mutex);
+
+    return data.concurrency;
+}
+
+std::size_t ResourceManager::numberOfQueuedJobs(Stage stage) const
+{
+    auto& data = stageData(stage);
+
+    std::unique_lock<std::mutex> lock(data.mutex);
+
+    return data.waiting.size();
+}
+
+std::size_t ResourceManager::numberOfActiveJobs(Stage stage) const
+{
+    auto& data = stageData(stage);
+
+    std::unique_lock<std::mutex> lock(data.mutex);
+
+    return data.active;
+}
+
+ResourceManager::StageData& ResourceManager::stageData(Stage stage)
+{
+    return stage == Stage::Reading ? m_readingStage : m_decodingStage;
+}
+
+const ResourceManager::StageData& ResourceManager::stageData(Stage stage) const
+{
+    return stage == Stage::Reading ? m_readingStage : m_decodingStage;
 }
 
 void ResourceManager::setResourceAccessor(ResourceAccessor* accessor)
@@ -1,6 +1,14 @@
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+
 // HG::Core
+#include <HG/Core/Application.hpp>
+#include <HG/Core/Behaviour.hpp>
 #include <HG/Core/GameObject.hpp>
 #include <HG/Core/Scene.hpp>
+#include <HG/Core/ThreadPool.hpp>
+#include <HG/Core/Transform.hpp>
 
 // HG::Rendering::Base
 #include <HG/Rendering/Base/Renderer.hpp>
@@ -8,25 +16,64 @@
 // HG::Utils
 #include <HG/Utils/Logging.hpp>
 
+namespace
+{
+// Structural changes of chunk, that's updated
+// by current thread. nullptr if thread is not
+// executing concurrent update.
+thread_local std::vector<std::function<void()>>* currentDeferredChanges = nullptr;
+} // namespace
+
 namespace HG::Core
 {
-Scene::Scene() : m_mainApplication(nullptr), m_gameObjects()
+Scene::Scene() :
+    m_mainApplication(nullptr),
+    m_gameObjects(),
+    m_deleteExecutors(),
+    m_concurrentBehaviours(),
+    m_concurrentOwners(),
+    m_deferredChanges(),
+    m_concurrentChunkSize(64),
+    m_transformPool(),
+    m_transformPoolEnabled(false),
+    m_nameIndex(),
+    m_tagIndex(),
+    m_layerIndex(),
+    m_nextOrder(0),
+    m_mergedOrder(0),
+    m_gameObjectHandles(),
+    m_behaviourHandles(),
+    m_destroyedGameObjects(),
+    m_behaviourRemovals(),
+    m_subScenes(),
+    m_componentStorages(),
+    m_componentStoragesIndex(),
+    m_componentStoragesMutex()
 {
 }
 
 Scene::~Scene()
 {
-    // Removing gameobject (caching)
-    for (auto&& behaviour : m_gameObjects.added())
+    // Removing gameobjects (caching). Gameobjects, removed
+    // on current frame, are detached already.
+    for (auto&& gameObject : m_gameObjects.added())
     {
-        removeGameObject(behaviour);
+        if (gameObject->scene() == this)
+        {
+            removeGameObject(gameObject);
+        }
     }
 
     for (auto&& gameObject : m_gameObjects)
     {
-        removeGameObject(gameObject);
+        if (gameObject->scene() == this)
+        {
+            removeGameObject(gameObject);
+        }
     }
 
+    destroyRemoved();
+
     // Clearing registered resources
     for (auto&& deleter : m_deleteExecutors)
     {
@@ -47,16 +94,192 @@ Application* Scene::application() const
 void Scene::update()
 {
     m_gameObjects.merge();
+    m_mergedOrder = m_nextOrder;
+
+    m_concurrentBehaviours.clear();
+    m_concurrentOwners.clear();
 
     for (auto&& gameObject : m_gameObjects)
     {
-        if (!gameObject->isEnabled())
+        // Gameobject may be removed by previous one
+        if (gameObject->scene() != this || !gameObject->isEnabled())
+        {
+            continue;
+        }
+
+        gameObject->update(m_concurrentBehaviours);
+
+        if (m_concurrentOwners.empty() || m_concurrentOwners.back().second != m_concurrentBehaviours.size())
+        {
+            m_concurrentOwners.emplace_back(gameObject, m_concurrentBehaviours.size());
+        }
+    }
+
+    if (!m_concurrentBehaviours.empty())
+    {
+        updateConcurrentBehaviours();
+    }
+
+    updateSystems();
+
+    destroyRemoved();
+
+    if (m_transformPoolEnabled)
+    {
+        m_transformPool.update(m_mainApplication != nullptr ? m_mainApplication->threadPool() : nullptr);
+    }
+}
+
+void Scene::updateConcurrentBehaviours()
+{
+    // Serial behaviours may remove gameobjects or behaviours,
+    // that was collected for concurrent update. They are
+    // deleted at the end of frame, so they are just detached.
+    std::size_t begin = 0;
+
+    for (auto&& [gameObject, end] : m_concurrentOwners)
+    {
+        auto removed = gameObject->scene() != this;
+
+        for (auto index = begin; index < end; ++index)
+        {
+            if (removed || m_concurrentBehaviours[index]->gameObject() != gameObject)
+            {
+                m_concurrentBehaviours[index] = nullptr;
+            }
+        }
+
+        begin = end;
+    }
+
+    updateConcurrently(m_concurrentBehaviours.size(), [this](std::size_t first, std::size_t last) {
+        for (auto index = first; index < last; ++index)
+        {
+            if (m_concurrentBehaviours[index] != nullptr)
+            {
+                m_concurrentBehaviours[index]->update();
+            }
+        }
+    });
+}
+
+void Scene::updateSystems()
+{
+    // Systems may create new storages
+    for (std::size_t index = 0; index < m_componentStorages.size(); ++index)
+    {
+        auto storage = m_componentStorages[index].get();
+
+        if (storage->systemUpdateMode() == Behaviour::UpdateMode::Serial)
         {
+            storage->update();
             continue;
         }
 
-        gameObject->update();
+        auto size = storage->prepareConcurrentUpdate();
+
+        if (size != 0)
+        {
+            updateConcurrently(
+                size, [storage](std::size_t first, std::size_t last) { storage->updatePrepared(first, last); });
+        }
+    }
+}
+
+void Scene::refreshTransforms()
+{
+    for (auto&& gameObject : m_gameObjects)
+    {
+        if (gameObject->scene() == this)
+        {
+            gameObject->transform()->updateCache();
+        }
+    }
+}
+
+void Scene::updateConcurrently(std::size_t size, const std::function<void(std::size_t, std::size_t)>& function)
+{
+    refreshTransforms();
+
+    auto numberOfChunks = (size + m_concurrentChunkSize - 1) / m_concurrentChunkSize;
+
+    for (auto&& changes : m_deferredChanges)
+    {
+        changes.clear();
+    }
+
+    if (m_deferredChanges.size() < numberOfChunks)
+    {
+        m_deferredChanges.resize(numberOfChunks);
+    }
+
+    auto updateChunk = [this, size, &function](std::size_t chunk) {
+        currentDeferredChanges = &m_deferredChanges[chunk];
+
+        auto first = chunk * m_concurrentChunkSize;
+        auto last  = std::min(first + m_concurrentChunkSize, size);
+
+        try
+        {
+            function(first, last);
+        }
+        catch (...)
+        {
+            currentDeferredChanges = nullptr;
+            throw;
+        }
+
+        currentDeferredChanges = nullptr;
+    };
+
+    if (m_mainApplication != nullptr && m_mainApplication->threadPool() != nullptr)
+    {
+        m_mainApplication->threadPool()->parallelFor(
+            std::size_t(0), numberOfChunks, updateChunk, ThreadPool::Type::UserThread, 1);
+    }
+    else
+    {
+        for (std::size_t chunk = 0; chunk < numberOfChunks; ++chunk)
+        {
+            updateChunk(chunk);
+        }
+    }
+
+    // Applying changes in deterministic order
+    for (std::size_t chunk = 0; chunk < numberOfChunks; ++chunk)
+    {
+        for (auto&& change : m_deferredChanges[chunk])
+        {
+            change();
+        }
+
+        m_deferredChanges[chunk].clear();
+    }
+}
+
+void Scene::destroyRemoved()
+{
+    for (auto&& gameObject : m_behaviourRemovals)
+    {
+        gameObject->destroyRemovedBehaviours();
+    }
+
+    m_behaviourRemovals.clear();
+
+    if (m_destroyedGameObjects.empty())
+    {
+        return;
+    }
+
+    // Dropping pointers before memory is reused
+    m_gameObjects.mergeRemovable();
+
+    for (auto&& gameObject : m_destroyedGameObjects)
+    {
+        delete gameObject;
     }
+
+    m_destroyedGameObjects.clear();
 }
 
 void Scene::render(HG::Rendering::Base::Renderer* renderer)
@@ -74,61 +297,326 @@ void Scene::start()
 {
 }
 
+void Scene::setConcurrentUpdateChunkSize(std::size_t size)
+{
+    if (size == 0)
+    {
+        throw std::invalid_argument("Concurrent update chunk size can't be 0.");
+    }
+
+    m_concurrentChunkSize = size;
+}
+
+std::size_t Scene::concurrentUpdateChunkSize() const
+{
+    return m_concurrentChunkSize;
+}
+
+void Scene::setTransformPoolEnabled(bool enabled)
+{
+    if (m_transformPoolEnabled == enabled)
+    {
+        return;
+    }
+
+    m_transformPoolEnabled = enabled;
+
+    if (!m_transformPoolEnabled)
+    {
+        m_transformPool.clear();
+        return;
+    }
+
+    // Removed gameobjects are detached already
+    for (auto&& gameObject : m_gameObjects.added())
+    {
+        if (gameObject->scene() == this)
+        {
+            m_transformPool.add(gameObject->transform());
+        }
+    }
+
+    for (auto&& gameObject : m_gameObjects)
+    {
+        if (gameObject->scene() == this)
+        {
+            m_transformPool.add(gameObject->transform());
+        }
+    }
+}
+
+bool Scene::isTransformPoolEnabled() const
+{
+    return m_transformPoolEnabled;
+}
+
+TransformPool& Scene::transformPool()
+{
+    return m_transformPool;
+}
+
+bool Scene::isConcurrentUpdate()
+{
+    return currentDeferredChanges != nullptr;
+}
+
+void Scene::deferStructuralChange(std::function<void()> change)
+{
+    if (currentDeferredChanges == nullptr)
+    {
+        throw std::runtime_error("Structural changes can be deferred only from concurrent update.");
+    }
+
+    currentDeferredChanges->push_back(std::move(change));
+}
+
 void Scene::removeGameObject(GameObject* gameObject)
 {
+    if (isConcurrentUpdate())
+    {
+        deferStructuralChange([this, gameObject]() { removeGameObject(gameObject); });
+        return;
+    }
+
+    // Removed already
+    if (gameObject->scene() != this)
+    {
+        return;
+    }
+
+    unindexGameObject(gameObject);
+
+    gameObject->forEachAttachedBehaviour([this](Behaviour* behaviour) {
+        m_behaviourHandles.remove(behaviour->m_handle);
+        behaviour->m_handle = {};
+    });
+
+    m_gameObjectHandles.remove(gameObject->m_handle);
+    gameObject->m_handle = {};
+
     // Removing current parent scene.
     gameObject->setParentScene(nullptr);
 
-    delete gameObject;
     m_gameObjects.remove(gameObject);
+    m_destroyedGameObjects.push_back(gameObject);
 }
 
 void Scene::addGameObject(GameObject* gameObject)
 {
+    if (isConcurrentUpdate())
+    {
+        deferStructuralChange([this, gameObject]() { addGameObject(gameObject); });
+        return;
+    }
+
+    if (gameObject->scene() == this)
+    {
+        return;
+    }
+
     // Adding current scene as parent.
     gameObject->setParentScene(this);
     m_gameObjects.add(gameObject);
+
+    gameObject->m_sceneOrder = m_nextOrder++;
+    indexGameObject(gameObject);
+
+    gameObject->m_handle = m_gameObjectHandles.add(gameObject);
+    gameObject->forEachAttachedBehaviour([this](Behaviour* behaviour) { registerBehaviour(behaviour); });
+
+    if (m_transformPoolEnabled)
+    {
+        m_transformPool.add(gameObject->transform());
+    }
 }
 
-GameObject* Scene::findGameObject(const std::string& name) const
+void Scene::registerBehaviour(Behaviour* behaviour)
 {
-    for (auto&& gameObject : m_gameObjects)
+    behaviour->m_handle = m_behaviourHandles.add(behaviour);
+}
+
+GameObject* Scene::gameObject(Handle<GameObject> handle) const
+{
+    return m_gameObjectHandles.get(handle);
+}
+
+Behaviour* Scene::behaviour(Handle<Behaviour> handle) const
+{
+    return m_behaviourHandles.get(handle);
+}
+
+void Scene::addGameObjects(const std::vector<GameObject*>& gameObjects)
+{
+    if (isConcurrentUpdate())
     {
-        if (gameObject->isHidden() || m_gameObjects.isRemoving(gameObject))
-        {
-            continue;
-        }
+        deferStructuralChange([this, gameObjects]() { addGameObjects(gameObjects); });
+        return;
+    }
+
+    m_gameObjects.reserve(gameObjects.size());
+    m_gameObjectHandles.reserve(m_gameObjectHandles.size() + gameObjects.size());
+
+    for (auto&& gameObject : gameObjects)
+    {
+        addGameObject(gameObject);
+    }
+}
+
+void Scene::addSubScene(const std::string& name, const std::vector<GameObject*>& gameObjects)
+{
+    if (m_subScenes.find(name) != m_subScenes.end())
+    {
+        throw std::invalid_argument("Sub-scene \"" + name + "\" is loaded already.");
+    }
+
+    if (isConcurrentUpdate())
+    {
+        deferStructuralChange([this, name, gameObjects]() {
+            // Other deferred change may add sub-scene with same name,
+            // throwing during merge will break the rest of changes
+            if (m_subScenes.find(name) != m_subScenes.end())
+            {
+                HGError("Sub-scene \"{}\" is loaded already, added gameobjects are dropped.", name);
+
+                // Gameobjects were not added, so scene has no references to them
+                for (auto&& gameObject : gameObjects)
+                {
+                    delete gameObject;
+                }
 
-        if (gameObject->name() == name)
+                return;
+            }
+
+            addSubScene(name, gameObjects);
+        });
+        return;
+    }
+
+    addGameObjects(gameObjects);
+
+    auto& handles = m_subScenes[name];
+    handles.reserve(gameObjects.size());
+
+    for (auto&& gameObject : gameObjects)
+    {
+        handles.push_back(gameObject->handle());
+    }
+}
+
+void Scene::removeSubScene(const std::string& name)
+{
+    if (isConcurrentUpdate())
+    {
+        deferStructuralChange([this, name]() { removeSubScene(name); });
+        return;
+    }
+
+    auto iterator = m_subScenes.find(name);
+
+    if (iterator == m_subScenes.end())
+    {
+        return;
+    }
+
+    for (auto&& handle : iterator->second)
+    {
+        auto gameObject = m_gameObjectHandles.get(handle);
+
+        if (gameObject != nullptr)
         {
-            return gameObject;
+            removeGameObject(gameObject);
         }
     }
 
-    return nullptr;
+    m_subScenes.erase(iterator);
 }
 
-void Scene::findGameObjects(const std::string& name, std::vector<GameObject*>& container) const
+bool Scene::hasSubScene(const std::string& name) const
 {
-    for (auto&& gameObject : m_gameObjects)
+    return m_subScenes.find(name) != m_subScenes.end();
+}
+
+void Scene::indexGameObject(GameObject* gameObject)
+{
+    m_nameIndex.add(gameObject->name(), gameObject, gameObject->m_sceneOrder);
+    m_tagIndex.add(gameObject->tag(), gameObject, gameObject->m_sceneOrder);
+    m_layerIndex.add(gameObject->layer(), gameObject, gameObject->m_sceneOrder);
+}
+
+void Scene::unindexGameObject(GameObject* gameObject)
+{
+    m_nameIndex.remove(gameObject->name(), gameObject->m_sceneOrder);
+    m_tagIndex.remove(gameObject->tag(), gameObject->m_sceneOrder);
+    m_layerIndex.remove(gameObject->layer(), gameObject->m_sceneOrder);
+}
+
+void Scene::forEachVisible(const IndexBucket* bucket, const std::function<void(GameObject*)>& function) const
+{
+    if (bucket == nullptr)
+    {
+        return;
+    }
+
+    // Gameobjects, added after merge, are ordered last
+    for (auto iterator = bucket->begin(); iterator != bucket->end() && iterator->first < m_mergedOrder; ++iterator)
     {
-        if (gameObject->isHidden() || m_gameObjects.isRemoving(gameObject))
+        if (!iterator->second->isHidden())
         {
-            continue;
+            function(iterator->second);
         }
+    }
+}
 
-        if (gameObject->name() == name)
+GameObject* Scene::findGameObject(const std::string& name) const
+{
+    auto bucket = m_nameIndex.find(name);
+
+    if (bucket == nullptr)
+    {
+        return nullptr;
+    }
+
+    for (auto iterator = bucket->begin(); iterator != bucket->end() && iterator->first < m_mergedOrder; ++iterator)
+    {
+        if (!iterator->second->isHidden())
         {
-            container.push_back(gameObject);
+            return iterator->second;
         }
     }
+
+    return nullptr;
+}
+
+void Scene::findGameObjects(const std::string& name, std::vector<GameObject*>& container) const
+{
+    forEachVisible(m_nameIndex.find(name), [&container](GameObject* gameObject) { container.push_back(gameObject); });
+}
+
+void Scene::findGameObjectsWithTag(const std::string& tag, std::vector<GameObject*>& container) const
+{
+    forEachVisible(m_tagIndex.find(tag), [&container](GameObject* gameObject) { container.push_back(gameObject); });
+}
+
+void Scene::findGameObjectsInLayer(std::uint32_t layer, std::vector<GameObject*>& container) const
+{
+    forEachVisible(m_layerIndex.find(layer), [&container](GameObject* gameObject) { container.push_back(gameObject); });
+}
+
+void Scene::forEachWithTag(const std::string& tag, const std::function<void(GameObject*)>& function) const
+{
+    forEachVisible(m_tagIndex.find(tag), function);
+}
+
+void Scene::forEachInLayer(std::uint32_t layer, const std::function<void(GameObject*)>& function) const
+{
+    forEachVisible(m_layerIndex.find(layer), function);
 }
 
 void Scene::getGameObjects(std::vector<GameObject*>& container) const
 {
     for (auto&& gameObject : m_gameObjects)
     {
-        if (gameObject->isHidden() || m_gameObjects.isRemoving(gameObject))
+        if (gameObject->isHidden() || gameObject->scene() != this)
         {
             continue;
         }
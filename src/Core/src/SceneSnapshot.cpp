@@ -0,0 +1,754 @@
+// C++ STL
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <shared_mutex>
+#include <stdexcept>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/SceneSnapshot.hpp>
+#include <HG/Core/Transform.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+#include <HG/Utils/SystemTools.hpp>
+
+namespace
+{
+// Sections and property values are aligned, so
+// records and values are used in place
+constexpr std::size_t Alignment = alignof(std::max_align_t);
+
+constexpr char Magic[4] = {'H', 'G', 'S', 'S'};
+
+constexpr std::uint32_t NoParent = std::numeric_limits<std::uint32_t>::max();
+
+void align(std::vector<std::byte>& data)
+{
+    data.resize((data.size() + Alignment - 1) / Alignment * Alignment);
+}
+
+std::uint64_t append(std::vector<std::byte>& data, const void* value, std::size_t size)
+{
+    align(data);
+
+    auto offset = data.size();
+
+    data.resize(offset + size);
+
+    if (size != 0)
+    {
+        std::memcpy(data.data() + offset, value, size);
+    }
+
+    return offset;
+}
+} // namespace
+
+namespace HG::Core
+{
+struct SceneSnapshot::Header
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t numberOfStrings;
+    std::uint32_t numberOfGameObjects;
+    std::uint32_t numberOfBehaviours;
+    std::uint32_t numberOfProperties;
+    std::uint32_t numberOfResources;
+    std::uint32_t reserved;
+
+    // Sections offsets
+    std::uint64_t strings;
+    std::uint64_t gameObjects;
+    std::uint64_t behaviours;
+    std::uint64_t properties;
+    std::uint64_t resources;
+    std::uint64_t blob;
+    std::uint64_t blobSize;
+};
+
+// Offset and size of string in blob
+struct SceneSnapshot::StringRecord
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+struct SceneSnapshot::GameObjectRecord
+{
+    std::uint32_t name;
+    std::uint32_t tag;
+    std::uint32_t layer;
+    std::uint32_t parent;
+    std::uint32_t firstBehaviour;
+    std::uint32_t numberOfBehaviours;
+    std::uint8_t enabled;
+    std::uint8_t hidden;
+    std::uint8_t padding[2];
+    float position[3];
+    float rotation[4]; // w, x, y, z
+    float scale[3];
+};
+
+struct SceneSnapshot::BehaviourRecord
+{
+    std::uint32_t type;
+    std::uint32_t firstProperty;
+    std::uint32_t numberOfProperties;
+    std::uint8_t enabled;
+    std::uint8_t padding[3];
+};
+
+struct SceneSnapshot::PropertyRecord
+{
+    enum Encoding : std::uint32_t
+    {
+        Raw,      // Bytes of trivial value
+        Encoded,  // Bytes, returned by codec
+        Reference // Index of resource
+    };
+
+    std::uint32_t name;
+    std::uint32_t encoding;
+    std::uint32_t type; // Declared type name
+    std::uint32_t reserved;
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+struct SceneSnapshot::Registry
+{
+    Registry() : mutex(), factories(), names(), codecs()
+    {
+        codecs[typeid(std::string)] = makeCodec<std::string>(
+            [](const std::string& value) { return value; },
+            [](std::string_view data) { return std::string(data); });
+    }
+
+    std::shared_mutex mutex;
+
+    // Nodes of maps are stable, so pointers to
+    // values are given out
+    std::unordered_map<std::string, BehaviourFactory> factories;
+    std::unordered_map<std::type_index, std::string> names;
+    std::unordered_map<std::type_index, Codec> codecs;
+};
+
+SceneSnapshot::SceneSnapshot(std::vector<std::byte> data) :
+    m_data(std::move(data)),
+    m_header(nullptr),
+    m_gameObjects(nullptr),
+    m_behaviours(nullptr),
+    m_properties(nullptr),
+    m_blob(nullptr),
+    m_strings(),
+    m_resources()
+{
+    fixUp();
+}
+
+SceneSnapshot::Registry& SceneSnapshot::registry()
+{
+    static Registry registry;
+
+    return registry;
+}
+
+void SceneSnapshot::registerBehaviour(const std::type_info& type, std::string name, BehaviourFactory factory)
+{
+    auto& registry = SceneSnapshot::registry();
+
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+
+    registry.names[type]     = name;
+    registry.factories[name] = std::move(factory);
+}
+
+void SceneSnapshot::registerCodec(const std::type_info& type, bool resource, Codec codec)
+{
+    auto& registry = SceneSnapshot::registry();
+
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+
+    codec.resource = resource;
+
+    registry.codecs[type] = std::move(codec);
+}
+
+const SceneSnapshot::Codec* SceneSnapshot::findCodec(const std::type_info& type)
+{
+    auto& registry = SceneSnapshot::registry();
+
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+
+    auto iterator = registry.codecs.find(type);
+
+    return iterator != registry.codecs.end() ? &iterator->second : nullptr;
+}
+
+const SceneSnapshot::BehaviourFactory* SceneSnapshot::findFactory(std::string_view name)
+{
+    auto& registry = SceneSnapshot::registry();
+
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+
+    auto iterator = registry.factories.find(std::string(name));
+
+    return iterator != registry.factories.end() ? &iterator->second : nullptr;
+}
+
+const std::string* SceneSnapshot::findName(const std::type_info& type)
+{
+    auto& registry = SceneSnapshot::registry();
+
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+
+    auto iterator = registry.names.find(type);
+
+    return iterator != registry.names.end() ? &iterator->second : nullptr;
+}
+
+std::vector<std::byte> SceneSnapshot::capture(Scene* scene)
+{
+    if (scene == nullptr)
+    {
+        throw std::invalid_argument("Can't capture snapshot of nullptr scene.");
+    }
+
+    // Gameobjects of scene, parents are placed before children
+    std::vector<GameObject*> gameObjects;
+    std::unordered_set<GameObject*> inScene;
+    std::vector<GameObject*> ordered;
+    std::unordered_map<GameObject*, std::uint32_t> indices;
+
+    auto collect = [scene, &gameObjects, &inScene](GameObject* gameObject) {
+        if (gameObject->scene() == scene)
+        {
+            gameObjects.push_back(gameObject);
+            inScene.insert(gameObject);
+        }
+    };
+
+    for (auto&& gameObject : scene->m_gameObjects.added())
+    {
+        collect(gameObject);
+    }
+
+    for (auto&& gameObject : scene->m_gameObjects)
+    {
+        collect(gameObject);
+    }
+
+    auto parentOf = [&inScene](GameObject* gameObject) -> GameObject* {
+        auto parent = gameObject->transform()->parent();
+
+        if (parent == nullptr || inScene.find(parent->gameObject()) == inScene.end())
+        {
+            return nullptr;
+        }
+
+        return parent->gameObject();
+    };
+
+    for (auto&& gameObject : gameObjects)
+    {
+        if (parentOf(gameObject) == nullptr)
+        {
+            ordered.push_back(gameObject);
+        }
+    }
+
+    for (std::size_t index = 0; index < ordered.size(); ++index)
+    {
+        indices[ordered[index]] = static_cast<std::uint32_t>(index);
+
+        for (auto&& child : ordered[index]->transform()->children())
+        {
+            if (inScene.find(child->gameObject()) != inScene.end())
+            {
+                ordered.push_back(child->gameObject());
+            }
+        }
+    }
+
+    std::vector<std::string_view> strings;
+    std::unordered_map<std::string, std::uint32_t> stringIndices;
+
+    auto intern = [&strings, &stringIndices](const std::string& string) {
+        auto [iterator, inserted] = stringIndices.try_emplace(string, static_cast<std::uint32_t>(strings.size()));
+
+        if (inserted)
+        {
+            strings.emplace_back(iterator->first);
+        }
+
+        return iterator->second;
+    };
+
+    std::vector<std::uint32_t> resources;
+    std::unordered_map<std::uint32_t, std::uint32_t> resourceIndices;
+
+    std::vector<GameObjectRecord> gameObjectRecords;
+    std::vector<BehaviourRecord> behaviourRecords;
+    std::vector<PropertyRecord> propertyRecords;
+    std::vector<std::byte> blob;
+
+    gameObjectRecords.reserve(ordered.size());
+
+    auto captureProperty = [&](const Behaviour* behaviour, const PropertyTable::Entry& entry) {
+        PropertyRecord record{};
+        record.name = intern(entry.name);
+        record.type = intern(entry.type);
+
+        if (entry.trivial)
+        {
+            std::vector<std::max_align_t> value((entry.size + sizeof(std::max_align_t) - 1) /
+                                                sizeof(std::max_align_t));
+
+            entry.getter(behaviour, entry.offset, value.data());
+
+            record.encoding = PropertyRecord::Raw;
+            record.offset   = append(blob, value.data(), entry.size);
+            record.size     = entry.size;
+        }
+        else
+        {
+            auto codec = findCodec(*entry.typeInfo);
+
+            if (codec == nullptr)
+            {
+                HGWarning("Property \"{}\" of type \"{}\" is not registered for snapshot, skipping.",
+                          entry.name,
+                          entry.type);
+                return false;
+            }
+
+            auto value = codec->save(behaviour, entry);
+
+            if (codec->resource)
+            {
+                auto [iterator, inserted] =
+                    resourceIndices.try_emplace(intern(value), static_cast<std::uint32_t>(resources.size()));
+
+                if (inserted)
+                {
+                    resources.push_back(iterator->first);
+                }
+
+                record.encoding = PropertyRecord::Reference;
+                record.offset   = append(blob, &iterator->second, sizeof(std::uint32_t));
+                record.size     = sizeof(std::uint32_t);
+            }
+            else
+            {
+                record.encoding = PropertyRecord::Encoded;
+                record.offset   = append(blob, value.data(), value.size());
+                record.size     = value.size();
+            }
+        }
+
+        propertyRecords.push_back(record);
+
+        return true;
+    };
+
+    auto captureBehaviour = [&](Behaviour* behaviour) {
+        auto name = findName(typeid(*behaviour));
+
+        if (name == nullptr)
+        {
+            HGWarning("Behaviour of type \"{}\" is not registered for snapshot, skipping.",
+                      HG::Utils::SystemTools::getTypeName(*behaviour));
+            return;
+        }
+
+        BehaviourRecord record{};
+        record.type          = intern(*name);
+        record.firstProperty = static_cast<std::uint32_t>(propertyRecords.size());
+        record.enabled       = behaviour->isEnabled();
+
+        for (auto table = behaviour->propertyTable(); table != nullptr; table = table->parent())
+        {
+            for (auto&& entry : table->entries())
+            {
+                if (captureProperty(behaviour, entry))
+                {
+                    ++record.numberOfProperties;
+                }
+            }
+        }
+
+        behaviourRecords.push_back(record);
+    };
+
+    for (auto&& gameObject : ordered)
+    {
+        auto transform = gameObject->transform();
+        auto parent    = parentOf(gameObject);
+        auto position  = transform->localPosition();
+        auto rotation  = transform->localRotation();
+        auto scale     = transform->localScale();
+
+        GameObjectRecord record{};
+        record.name           = intern(gameObject->name());
+        record.tag            = intern(gameObject->tag());
+        record.layer          = gameObject->layer();
+        record.parent         = parent != nullptr ? indices[parent] : NoParent;
+        record.firstBehaviour = static_cast<std::uint32_t>(behaviourRecords.size());
+        record.enabled        = gameObject->isEnabled();
+        record.hidden         = gameObject->isHidden();
+
+        record.position[0] = position.x;
+        record.position[1] = position.y;
+        record.position[2] = position.z;
+        record.rotation[0] = rotation.w;
+        record.rotation[1] = rotation.x;
+        record.rotation[2] = rotation.y;
+        record.rotation[3] = rotation.z;
+        record.scale[0]    = scale.x;
+        record.scale[1]    = scale.y;
+        record.scale[2]    = scale.z;
+
+        gameObject->forEachAttachedBehaviour(captureBehaviour);
+
+        record.numberOfBehaviours = static_cast<std::uint32_t>(behaviourRecords.size()) - record.firstBehaviour;
+
+        gameObjectRecords.push_back(record);
+    }
+
+    // Strings are stored after property values
+    std::vector<StringRecord> stringRecords;
+    stringRecords.reserve(strings.size());
+
+    for (auto&& string : strings)
+    {
+        stringRecords.push_back({append(blob, string.data(), string.size()), string.size()});
+    }
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version             = Version;
+    header.numberOfStrings     = static_cast<std::uint32_t>(stringRecords.size());
+    header.numberOfGameObjects = static_cast<std::uint32_t>(gameObjectRecords.size());
+    header.numberOfBehaviours  = static_cast<std::uint32_t>(behaviourRecords.size());
+    header.numberOfProperties  = static_cast<std::uint32_t>(propertyRecords.size());
+    header.numberOfResources   = static_cast<std::uint32_t>(resources.size());
+
+    std::vector<std::byte> image(sizeof(Header));
+
+    header.strings     = append(image, stringRecords.data(), stringRecords.size() * sizeof(StringRecord));
+    header.gameObjects = append(image, gameObjectRecords.data(), gameObjectRecords.size() * sizeof(GameObjectRecord));
+    header.behaviours  = append(image, behaviourRecords.data(), behaviourRecords.size() * sizeof(BehaviourRecord));
+    header.properties  = append(image, propertyRecords.data(), propertyRecords.size() * sizeof(PropertyRecord));
+    header.resources   = append(image, resources.data(), resources.size() * sizeof(std::uint32_t));
+    header.blob        = append(image, blob.data(), blob.size());
+    header.blobSize    = blob.size();
+
+    std::memcpy(image.data(), &header, sizeof(Header));
+
+    return image;
+}
+
+void SceneSnapshot::fixUp()
+{
+    if (m_data.size() < sizeof(Header))
+    {
+        throw std::runtime_error("Scene snapshot is truncated.");
+    }
+
+    m_header = reinterpret_cast<const Header*>(m_data.data());
+
+    if (std::memcmp(m_header->magic, Magic, sizeof(Magic)) != 0)
+    {
+        throw std::runtime_error("Data is not scene snapshot.");
+    }
+
+    if (m_header->version != Version)
+    {
+        throw std::runtime_error("Scene snapshot version " + std::to_string(m_header->version) +
+                                 " is not supported.");
+    }
+
+    auto section = [this](std::uint64_t offset, std::uint64_t count, std::size_t size) {
+        if (offset % Alignment != 0 || offset > m_data.size() || count > (m_data.size() - offset) / size)
+        {
+            throw std::runtime_error("Scene snapshot section is out of bounds.");
+        }
+
+        return m_data.data() + offset;
+    };
+
+    auto& header = *m_header;
+
+    auto strings = reinterpret_cast<const StringRecord*>(
+        section(header.strings, header.numberOfStrings, sizeof(StringRecord)));
+
+    m_gameObjects = reinterpret_cast<const GameObjectRecord*>(
+        section(header.gameObjects, header.numberOfGameObjects, sizeof(GameObjectRecord)));
+
+    m_behaviours = reinterpret_cast<const BehaviourRecord*>(
+        section(header.behaviours, header.numberOfBehaviours, sizeof(BehaviourRecord)));
+
+    m_properties = reinterpret_cast<const PropertyRecord*>(
+        section(header.properties, header.numberOfProperties, sizeof(PropertyRecord)));
+
+    auto resources = reinterpret_cast<const std::uint32_t*>(
+        section(header.resources, header.numberOfResources, sizeof(std::uint32_t)));
+
+    m_blob = section(header.blob, header.blobSize, 1);
+
+    auto inBlob = [&header](std::uint64_t offset, std::uint64_t size) {
+        return offset <= header.blobSize && size <= header.blobSize - offset;
+    };
+
+    auto inRange = [](std::uint64_t first, std::uint64_t count, std::uint64_t size) {
+        return first <= size && count <= size - first;
+    };
+
+    m_strings.reserve(header.numberOfStrings);
+
+    for (std::uint32_t index = 0; index < header.numberOfStrings; ++index)
+    {
+        if (!inBlob(strings[index].offset, strings[index].size))
+        {
+            throw std::runtime_error("Scene snapshot string is out of bounds.");
+        }
+
+        m_strings.emplace_back(reinterpret_cast<const char*>(m_blob + strings[index].offset), strings[index].size);
+    }
+
+    for (std::uint32_t index = 0; index < header.numberOfGameObjects; ++index)
+    {
+        auto& record = m_gameObjects[index];
+
+        // Parents are placed before children
+        if (record.name >= header.numberOfStrings || record.tag >= header.numberOfStrings ||
+            (record.parent != NoParent && record.parent >= index) ||
+            !inRange(record.firstBehaviour, record.numberOfBehaviours, header.numberOfBehaviours))
+        {
+            throw std::runtime_error("Scene snapshot gameobject is corrupted.");
+        }
+    }
+
+    for (std::uint32_t index = 0; index < header.numberOfBehaviours; ++index)
+    {
+        auto& record = m_behaviours[index];
+
+        if (record.type >= header.numberOfStrings ||
+            !inRange(record.firstProperty, record.numberOfProperties, header.numberOfProperties))
+        {
+            throw std::runtime_error("Scene snapshot behaviour is corrupted.");
+        }
+    }
+
+    for (std::uint32_t index = 0; index < header.numberOfProperties; ++index)
+    {
+        auto& record = m_properties[index];
+
+        if (record.name >= header.numberOfStrings || record.type >= header.numberOfStrings ||
+            record.encoding > PropertyRecord::Reference || !inBlob(record.offset, record.size))
+        {
+            throw std::runtime_error("Scene snapshot property is corrupted.");
+        }
+
+        if (record.encoding == PropertyRecord::Reference &&
+            (record.size != sizeof(std::uint32_t) ||
+             *reinterpret_cast<const std::uint32_t*>(m_blob + record.offset) >= header.numberOfResources))
+        {
+            throw std::runtime_error("Scene snapshot resource reference is corrupted.");
+        }
+    }
+
+    m_resources.reserve(header.numberOfResources);
+
+    for (std::uint32_t index = 0; index < header.numberOfResources; ++index)
+    {
+        if (resources[index] >= header.numberOfStrings)
+        {
+            throw std::runtime_error("Scene snapshot resource is corrupted.");
+        }
+
+        m_resources.push_back(m_strings[resources[index]]);
+    }
+}
+
+void SceneSnapshot::instantiate(Scene* scene, ResourceCache* cache) const
+{
+    std::vector<GameObject*> created;
+
+    create(scene, cache, created);
+
+    scene->addGameObjects(created);
+}
+
+void SceneSnapshot::create(Scene* scene, ResourceCache* cache, std::vector<GameObject*>& gameObjects) const
+{
+    if (scene == nullptr || cache == nullptr)
+    {
+        throw std::invalid_argument("Snapshot can't be instantiated without scene or cache.");
+    }
+
+    auto& header = *m_header;
+
+    cache->reserve<GameObject>(header.numberOfGameObjects);
+    cache->reserve<Transform>(header.numberOfGameObjects);
+
+    // Factories are searched once for every type
+    std::vector<const BehaviourFactory*> factories(header.numberOfStrings, nullptr);
+
+    auto restoreProperty = [this](Behaviour* behaviour, const PropertyRecord& record) {
+        auto name  = m_strings[record.name];
+        auto entry = behaviour->propertyTable() != nullptr ? behaviour->propertyTable()->find(name) : nullptr;
+
+        if (entry == nullptr)
+        {
+            HGWarning("Snapshot property \"{}\" does not exist, skipping.", name);
+            return;
+        }
+
+        auto value = m_blob + record.offset;
+
+        if (record.encoding == PropertyRecord::Raw)
+        {
+            // Value of other type with same size can't be reinterpreted
+            if (!entry->trivial || entry->size != record.size || entry->type != m_strings[record.type])
+            {
+                HGWarning("Type of snapshot property \"{}\" was changed, skipping.", name);
+                return;
+            }
+
+            entry->setter(behaviour, entry->offset, value);
+            return;
+        }
+
+        auto codec = findCodec(*entry->typeInfo);
+
+        if (codec == nullptr || codec->resource != (record.encoding == PropertyRecord::Reference))
+        {
+            HGWarning("Type of snapshot property \"{}\" was changed, skipping.", name);
+            return;
+        }
+
+        if (record.encoding == PropertyRecord::Reference)
+        {
+            codec->load(behaviour, *entry, m_resources[*reinterpret_cast<const std::uint32_t*>(value)]);
+        }
+        else
+        {
+            codec->load(
+                behaviour, *entry, std::string_view(reinterpret_cast<const char*>(value), record.size));
+        }
+    };
+
+    std::vector<GameObject*> created;
+    created.reserve(header.numberOfGameObjects);
+
+    try
+    {
+        for (std::uint32_t index = 0; index < header.numberOfGameObjects; ++index)
+        {
+            auto& record    = m_gameObjects[index];
+            auto gameObject = new (cache) GameObject;
+
+            created.push_back(gameObject);
+
+            gameObject->setName(std::string(m_strings[record.name]));
+            gameObject->setTag(std::string(m_strings[record.tag]));
+            gameObject->setLayer(record.layer);
+            gameObject->setEnabled(record.enabled != 0);
+            gameObject->setHidden(record.hidden != 0);
+
+            auto transform = gameObject->transform();
+
+            // Parent is set before local values,
+            // because it keeps global values
+            if (record.parent != NoParent)
+            {
+                transform->setParent(created[record.parent]->transform());
+            }
+
+            transform->setLocalPosition(glm::vec3(record.position[0], record.position[1], record.position[2]));
+            transform->setLocalRotation(
+                glm::quat(record.rotation[0], record.rotation[1], record.rotation[2], record.rotation[3]));
+            transform->setLocalScale(glm::vec3(record.scale[0], record.scale[1], record.scale[2]));
+
+            for (auto behaviourIndex = record.firstBehaviour;
+                 behaviourIndex < record.firstBehaviour + record.numberOfBehaviours;
+                 ++behaviourIndex)
+            {
+                auto& behaviourRecord = m_behaviours[behaviourIndex];
+                auto& factory         = factories[behaviourRecord.type];
+
+                if (factory == nullptr)
+                {
+                    factory = findFactory(m_strings[behaviourRecord.type]);
+
+                    if (factory == nullptr)
+                    {
+                        throw std::runtime_error("Snapshot behaviour \"" + std::string(m_strings[behaviourRecord.type]) +
+                                                 "\" is not registered.");
+                    }
+                }
+
+                // Behaviour is owned by gameobject right away
+                auto behaviour = (*factory)(scene);
+                gameObject->addBehaviour(behaviour);
+
+                behaviour->setEnabled(behaviourRecord.enabled != 0);
+
+                for (auto propertyIndex = behaviourRecord.firstProperty;
+                     propertyIndex < behaviourRecord.firstProperty + behaviourRecord.numberOfProperties;
+                     ++propertyIndex)
+                {
+                    restoreProperty(behaviour, m_properties[propertyIndex]);
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        // Children are deleted before parents
+        for (auto iterator = created.rbegin(); iterator != created.rend(); ++iterator)
+        {
+            delete *iterator;
+        }
+
+        throw;
+    }
+
+    gameObjects.insert(gameObjects.end(), created.begin(), created.end());
+}
+
+std::size_t SceneSnapshot::numberOfGameObjects() const
+{
+    return m_header->numberOfGameObjects;
+}
+
+const std::vector<std::string_view>& SceneSnapshot::resources() const
+{
+    return m_resources;
+}
+
+SceneSnapshotLoader::SceneSnapshotLoader() = default;
+
+SceneSnapshotLoader::ResultType SceneSnapshotLoader::load(const std::byte* data, std::size_t size)
+{
+    try
+    {
+        return std::make_shared<SceneSnapshot>(std::vector<std::byte>(data, data + size));
+    }
+    catch (const std::runtime_error& error)
+    {
+        HGError("Can't load scene snapshot: {}", error.what());
+        return nullptr;
+    }
+}
+} // namespace HG::Core
@@ -0,0 +1,411 @@
+// C++ STL
+#include <algorithm>
+#include <stdexcept>
+
+// HG::Core
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/SceneStreamer.hpp>
+#include <HG/Core/ThreadPool.hpp>
+
+// HG::Utils
+#include <HG/Utils/Logging.hpp>
+
+namespace
+{
+std::string describe(const std::exception_ptr& exception)
+{
+    try
+    {
+        std::rethrow_exception(exception);
+    }
+    catch (const std::exception& error)
+    {
+        return error.what();
+    }
+    catch (...)
+    {
+        return "Unknown exception.";
+    }
+}
+} // namespace
+
+namespace HG::Core
+{
+SceneLoading::SceneLoading(MainThreadDispatcher* dispatcher) :
+    m_dispatcher(dispatcher),
+    m_progress(0.0f),
+    m_pendingJobs(0),
+    m_prepared(false),
+    m_finished(false),
+    m_failed(false),
+    m_cancelled(false),
+    m_exception(),
+    m_scene(nullptr),
+    m_target(nullptr),
+    m_name(),
+    m_snapshot()
+{
+}
+
+SceneLoading::~SceneLoading()
+{
+    delete m_scene;
+}
+
+SceneLoading::State SceneLoading::state() const
+{
+    if (m_cancelled.load(std::memory_order_acquire))
+    {
+        return State::Cancelled;
+    }
+
+    if (m_failed.load(std::memory_order_acquire))
+    {
+        return State::Failed;
+    }
+
+    if (m_finished.load(std::memory_order_acquire))
+    {
+        return State::Finished;
+    }
+
+    if (!m_prepared.load(std::memory_order_acquire))
+    {
+        return State::Preparing;
+    }
+
+    if (m_pendingJobs.load(std::memory_order_acquire) != 0)
+    {
+        return State::Staging;
+    }
+
+    return State::Ready;
+}
+
+void SceneLoading::setProgress(float progress)
+{
+    m_progress = std::clamp(progress, 0.0f, 1.0f);
+}
+
+float SceneLoading::progress() const
+{
+    auto state = this->state();
+
+    if (state == State::Ready || state == State::Finished)
+    {
+        return 1.0f;
+    }
+
+    return m_progress;
+}
+
+void SceneLoading::dispatch(MainThreadDispatcher::Job job, MainThreadDispatcher::Priority priority)
+{
+    // Dispatcher may be destroyed already, if
+    // loading was cancelled by streamer deletion
+    if (isCancelled())
+    {
+        return;
+    }
+
+    ++m_pendingJobs;
+
+    // Counter is decreased even if job throws
+    struct Completion
+    {
+        ~Completion()
+        {
+            --pendingJobs;
+        }
+
+        std::atomic_size_t& pendingJobs;
+    };
+
+    m_dispatcher->push(
+        [self = shared_from_this(), job = std::move(job)]() {
+            Completion completion{self->m_pendingJobs};
+
+            if (!self->isCancelled())
+            {
+                job();
+            }
+        },
+        priority);
+}
+
+std::size_t SceneLoading::numberOfPendingJobs() const
+{
+    return m_pendingJobs;
+}
+
+void SceneLoading::cancel()
+{
+    m_cancelled = true;
+}
+
+bool SceneLoading::isCancelled() const
+{
+    return m_cancelled;
+}
+
+std::exception_ptr SceneLoading::exception() const
+{
+    return m_exception;
+}
+
+void SceneLoading::fail(std::exception_ptr exception)
+{
+    m_exception = std::move(exception);
+    m_failed.store(true, std::memory_order_release);
+}
+
+SceneStreamer::SceneStreamer(ThreadPool* threadPool, MainThreadDispatcher* dispatcher) :
+    m_threadPool(threadPool),
+    m_dispatcher(dispatcher),
+    m_sceneLoading(),
+    m_subSceneLoadings(),
+    m_preparations(std::make_shared<Preparations>())
+{
+}
+
+SceneStreamer::~SceneStreamer()
+{
+    cancelScene();
+
+    for (auto&& loading : m_subSceneLoadings)
+    {
+        loading->cancel();
+    }
+
+    // Preparations, that are running already, may use
+    // dispatcher and resources, deleted after streamer
+    std::unique_lock<std::mutex> lock(m_preparations->mutex);
+    m_preparations->notifier.wait(lock, [this]() { return m_preparations->running == 0; });
+}
+
+SceneLoadingPtr SceneStreamer::loadScene(ScenePreparation preparation)
+{
+    cancelScene();
+
+    m_sceneLoading = std::make_shared<SceneLoading>(m_dispatcher);
+
+    prepare(m_sceneLoading, [preparation = std::move(preparation)](SceneLoading& loading) {
+        loading.m_scene = preparation(loading);
+
+        if (loading.m_scene == nullptr)
+        {
+            throw std::runtime_error("Scene preparation returned nullptr.");
+        }
+    });
+
+    return m_sceneLoading;
+}
+
+SceneLoadingPtr SceneStreamer::loadSubScene(Scene* scene, std::string name, SubScenePreparation preparation)
+{
+    if (scene == nullptr)
+    {
+        throw std::invalid_argument("Sub-scene can't be loaded without scene.");
+    }
+
+    auto loaded = scene->hasSubScene(name) ||
+                  std::any_of(m_subSceneLoadings.begin(), m_subSceneLoadings.end(), [scene, &name](auto&& loading) {
+                      return loading->m_target == scene && loading->m_name == name;
+                  });
+
+    if (loaded)
+    {
+        throw std::invalid_argument("Sub-scene \"" + name + "\" is loaded already.");
+    }
+
+    auto loading = std::make_shared<SceneLoading>(m_dispatcher);
+
+    loading->m_target = scene;
+    loading->m_name   = std::move(name);
+
+    m_subSceneLoadings.push_back(loading);
+
+    prepare(loading, [preparation = std::move(preparation)](SceneLoading& loading) {
+        loading.m_snapshot = preparation(loading);
+
+        if (loading.m_snapshot == nullptr)
+        {
+            throw std::runtime_error("Sub-scene preparation returned nullptr.");
+        }
+    });
+
+    return loading;
+}
+
+void SceneStreamer::prepare(SceneLoadingPtr loading, std::function<void(SceneLoading&)> preparation)
+{
+    // Loading is shared with job, so it stays
+    // alive, even if it's cancelled
+    auto job = [loading, preparations = m_preparations, preparation = std::move(preparation)]() {
+        {
+            // Cancellation is checked under lock, so
+            // destructor can't miss started preparation
+            std::unique_lock<std::mutex> lock(preparations->mutex);
+
+            if (loading->isCancelled())
+            {
+                return;
+            }
+
+            ++preparations->running;
+        }
+
+        // Counter is decreased even if preparation throws
+        struct Completion
+        {
+            ~Completion()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(preparations.mutex);
+                    --preparations.running;
+                }
+
+                preparations.notifier.notify_all();
+            }
+
+            Preparations& preparations;
+        };
+
+        Completion completion{*preparations};
+
+        try
+        {
+            preparation(*loading);
+        }
+        catch (...)
+        {
+            loading->fail(std::current_exception());
+            return;
+        }
+
+        loading->m_prepared.store(true, std::memory_order_release);
+    };
+
+    if (m_threadPool != nullptr)
+    {
+        m_threadPool->push(std::move(job), ThreadPool::Type::UserThread);
+    }
+    else
+    {
+        job();
+    }
+}
+
+void SceneStreamer::cancelScene()
+{
+    if (m_sceneLoading != nullptr)
+    {
+        m_sceneLoading->cancel();
+        m_sceneLoading = nullptr;
+    }
+}
+
+void SceneStreamer::cancelSubScenes(Scene* scene)
+{
+    auto end = std::remove_if(m_subSceneLoadings.begin(), m_subSceneLoadings.end(), [scene](auto&& loading) {
+        if (loading->m_target != scene)
+        {
+            return false;
+        }
+
+        loading->cancel();
+        return true;
+    });
+
+    m_subSceneLoadings.erase(end, m_subSceneLoadings.end());
+}
+
+Scene* SceneStreamer::takeReadyScene()
+{
+    if (m_sceneLoading == nullptr)
+    {
+        return nullptr;
+    }
+
+    switch (m_sceneLoading->state())
+    {
+    case SceneLoading::State::Failed:
+        HGError("Can't load scene: {}", describe(m_sceneLoading->exception()));
+        m_sceneLoading = nullptr;
+        return nullptr;
+
+    case SceneLoading::State::Ready:
+        break;
+
+    default:
+        return nullptr;
+    }
+
+    auto scene = m_sceneLoading->m_scene;
+
+    m_sceneLoading->m_scene = nullptr;
+    m_sceneLoading->m_finished.store(true, std::memory_order_release);
+    m_sceneLoading = nullptr;
+
+    return scene;
+}
+
+void SceneStreamer::proceedSubScenes(Scene* scene, ResourceCache* cache)
+{
+    auto end = std::remove_if(m_subSceneLoadings.begin(), m_subSceneLoadings.end(), [scene, cache](auto&& loading) {
+        if (loading->m_target != scene)
+        {
+            return false;
+        }
+
+        switch (loading->state())
+        {
+        case SceneLoading::State::Failed:
+            HGError("Can't load sub-scene \"{}\": {}", loading->m_name, describe(loading->exception()));
+            return true;
+
+        case SceneLoading::State::Ready:
+            break;
+
+        default:
+            return false;
+        }
+
+        std::vector<GameObject*> gameObjects;
+
+        try
+        {
+            // Sub-scene may be added directly, while it was loading
+            if (scene->hasSubScene(loading->m_name))
+            {
+                throw std::invalid_argument("Sub-scene is loaded already.");
+            }
+
+            loading->m_snapshot->create(scene, cache, gameObjects);
+        }
+        catch (...)
+        {
+            loading->fail(std::current_exception());
+
+            HGError("Can't create sub-scene \"{}\": {}", loading->m_name, describe(loading->exception()));
+            return true;
+        }
+
+        scene->addSubScene(loading->m_name, gameObjects);
+
+        // Snapshot is not needed anymore
+        loading->m_snapshot = nullptr;
+        loading->m_finished.store(true, std::memory_order_release);
+
+        return true;
+    });
+
+    m_subSceneLoadings.erase(end, m_subSceneLoadings.end());
+}
+
+std::size_t SceneStreamer::numberOfLoadings() const
+{
+    return m_subSceneLoadings.size() + (m_sceneLoading != nullptr ? 1 : 0);
+}
+} // namespace HG::Core
@@ -4,6 +4,15 @@
 // HG::Utils
 #include <HG/Utils/Logging.hpp>
 
+namespace
+{
+// Pool and index of pool thread, that's
+// executing current code. Used to push jobs
+// from pool threads into their own deques.
+thread_local void* currentPool         = nullptr;
+thread_local std::size_t currentWorker = 0;
+} // namespace
+
 namespace HG::Core
 {
 ThreadPool::ThreadPool() : m_data()
@@ -37,35 +46,26 @@ ThreadPool::~ThreadPool()
     }
 }
 
-void ThreadPool::threadFunction(std::size_t id, ThreadPool::Type type)
+void ThreadPool::threadFunction(std::shared_ptr<PoolData> data, std::size_t index, ThreadPool::Type type)
 {
-    auto data = getPoolData(type);
-
-    if (data == nullptr) // WTF??
-    {
-        HGError("Thread function can't get it's pool data, closing thread");
-        return;
-    }
+    currentPool   = data.get();
+    currentWorker = index;
 
     while (data->running)
     {
-        std::function<void()> job;
+        Job job;
 
+        if (!takeJob(data.get(), index, job))
         {
-            std::unique_lock<std::mutex> queueLock(data->jobsMutex);
+            std::unique_lock<std::mutex> idleLock(data->idleMutex);
 
-            while (data->jobs.empty() && data->running)
-            {
-                data->jobsNotifier.wait(queueLock);
-            }
+            ++data->idleThreads;
 
-            if (!data->running)
-            {
-                break;
-            }
+            data->idleNotifier.wait(idleLock, [&data]() { return data->pendingJobs != 0 || !data->running; });
+
+            --data->idleThreads;
 
-            job = data->jobs.front();
-            data->jobs.pop();
+            continue;
         }
 
         try
@@ -74,66 +74,163 @@ void ThreadPool::threadFunction(std::size_t id, ThreadPool::Type type)
         }
         catch (std::exception& exception)
         {
-            HGError("Thread from pool with [id={}, type={}] received exception: {}", id, type, exception.what());
+            HGError("Thread from pool with [id={}, type={}] received exception: {}", index, type, exception.what());
         }
     }
 
-    // Removing thread from data
-    //    std::unique_lock<std::mutex> lock(data->threadsMutex);
-    //    data->threads.erase(id);
+    currentPool = nullptr;
 }
 
-void ThreadPool::pushInternal(std::function<void()> job, ThreadPool::Type type)
+bool ThreadPool::takeJob(PoolData* data, std::size_t index, Job& job)
+{
+    if (data->pendingJobs == 0)
+    {
+        return false;
+    }
+
+    // Own jobs are taken from back, external
+    // ones from front, as they were pushed
+    {
+        auto& worker = *data->workers[index];
+
+        std::unique_lock<std::mutex> lock(worker.jobsMutex);
+
+        if (!worker.jobs.empty())
+        {
+            job = std::move(worker.jobs.back());
+            worker.jobs.pop_back();
+
+            --data->pendingJobs;
+
+            return true;
+        }
+
+        if (!worker.externalJobs.empty())
+        {
+            job = std::move(worker.externalJobs.front());
+            worker.externalJobs.pop_front();
+
+            --data->pendingJobs;
+
+            return true;
+        }
+    }
+
+    // Stealing jobs from front of other threads
+    auto numberOfWorkers = data->workers.size();
+
+    for (std::size_t offset = 1; offset < numberOfWorkers; ++offset)
+    {
+        auto& victim = *data->workers[(index + offset) % numberOfWorkers];
+
+        std::unique_lock<std::mutex> lock(victim.jobsMutex);
+
+        auto& jobs = victim.externalJobs.empty() ? victim.jobs : victim.externalJobs;
+
+        if (!jobs.empty())
+        {
+            job = std::move(jobs.front());
+            jobs.pop_front();
+
+            --data->pendingJobs;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::pushInternal(Job job, ThreadPool::Type type)
 {
     auto data = getPoolData(type);
 
-    if (data == nullptr)
+    if (data == nullptr || data->workers.empty())
     {
         return;
     }
 
+    std::size_t index;
+
+    auto internal = currentPool == data.get();
+
+    if (internal)
+    {
+        index = currentWorker;
+    }
+    else
+    {
+        index = data->nextWorker.fetch_add(1, std::memory_order_relaxed) % data->workers.size();
+    }
+
     {
-        std::unique_lock<std::mutex> lock(data->jobsMutex);
-        data->jobs.push(std::move(job));
+        auto& worker = *data->workers[index];
+
+        // Job is counted before it's published, so
+        // taking it never makes counter negative
+        std::unique_lock<std::mutex> lock(worker.jobsMutex);
+        ++data->pendingJobs;
+        (internal ? worker.jobs : worker.externalJobs).push_back(std::move(job));
     }
 
-    data->jobsNotifier.notify_all();
+    // Waking only one thread, if any sleeping
+    if (data->idleThreads != 0)
+    {
+        std::unique_lock<std::mutex> idleLock(data->idleMutex);
+        data->idleNotifier.notify_one();
+    }
 }
 
 void ThreadPool::startPool(ThreadPool::Type type, std::size_t numberOfThreads)
 {
-    std::shared_ptr<PoolData> data = nullptr;
+    std::shared_ptr<PoolData> previous = nullptr;
 
-    m_dataMutex.lock();
     {
+        std::unique_lock<std::shared_mutex> dataLock(m_dataMutex);
+
         auto iter = m_data.find(type);
 
-        if (iter == m_data.end())
+        if (iter != m_data.end())
         {
-            data         = std::make_shared<PoolData>();
-            m_data[type] = data;
+            // Can't rerun pool
+            if (iter->second->running)
+            {
+                return;
+            }
+
+            previous = iter->second;
         }
-        else
+
+        auto data = std::make_shared<PoolData>();
+
+        data->running = true;
+
+        data->workers.reserve(numberOfThreads);
+        data->threads.reserve(numberOfThreads);
+
+        for (std::size_t i = 0; i < numberOfThreads; ++i)
         {
-            data = iter->second;
+            data->workers.push_back(std::make_unique<WorkerData>());
         }
-    }
-    m_dataMutex.unlock();
 
-    // Can't rerun pool
-    if (data->running)
-    {
-        return;
-    }
+        for (std::size_t i = 0; i < numberOfThreads; ++i)
+        {
+            data->threads.emplace_back(&ThreadPool::threadFunction, data, i, type);
+        }
 
-    data->running = true;
+        m_data[type] = std::move(data);
+    }
 
-    for (std::size_t i = 0; i < numberOfThreads; ++i)
+    // Waiting for threads of previously stopped pool
+    if (previous != nullptr)
     {
-        std::unique_lock<std::mutex> lock(data->threadsMutex);
-        data->threads[data->nextId] = std::thread(&ThreadPool::threadFunction, this, std::size_t(data->nextId), type);
-
-        data->nextId++;
+        for (auto&& thread : previous->threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
     }
 }
 
@@ -146,8 +243,12 @@ void ThreadPool::stopPool(ThreadPool::Type type)
         return;
     }
 
-    data->running = false;
-    data->jobsNotifier.notify_all();
+    {
+        std::unique_lock<std::mutex> idleLock(data->idleMutex);
+        data->running = false;
+    }
+
+    data->idleNotifier.notify_all();
 }
 
 void ThreadPool::joinPool(ThreadPool::Type type)
@@ -159,13 +260,35 @@ void ThreadPool::joinPool(ThreadPool::Type type)
         return;
     }
 
-    for (auto&& [id, thread] : data->threads)
+    for (auto&& thread : data->threads)
     {
         if (thread.joinable())
         {
             thread.join();
         }
     }
+
+    // Jobs, that were not taken, are never executed. They are
+    // dropped here, while objects they are using still exist.
+    for (auto&& worker : data->workers)
+    {
+        std::deque<Job> dropped;
+
+        {
+            std::unique_lock<std::mutex> lock(worker->jobsMutex);
+
+            dropped.swap(worker->jobs);
+
+            std::move(worker->externalJobs.begin(), worker->externalJobs.end(), std::back_inserter(dropped));
+            worker->externalJobs.clear();
+
+            data->pendingJobs -= dropped.size();
+        }
+
+        // Jobs are destroyed without lock, because
+        // abandoned promises execute continuations
+        dropped.clear();
+    }
 }
 
 std::shared_ptr<ThreadPool::PoolData> ThreadPool::getPoolData(ThreadPool::Type type) const
@@ -194,6 +317,18 @@ std::size_t ThreadPool::numberOfJobs(ThreadPool::Type type) const
         return 0;
     }
 
-    return data->jobs.size();
+    return data->pendingJobs;
+}
+
+std::size_t ThreadPool::numberOfThreads(ThreadPool::Type type) const
+{
+    auto data = getPoolData(type);
+
+    if (data == nullptr)
+    {
+        return 0;
+    }
+
+    return data->workers.size();
 }
 } // namespace HG::Core
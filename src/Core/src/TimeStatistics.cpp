@@ -18,6 +18,10 @@ TimeStatistics::TimeStatistics() : m_timers()
     changeEstimateBuffer(Timers::UpdateTime, 60);
     addTimer(Timers::PhysicsTime);
     changeEstimateBuffer(Timers::PhysicsTime, 60);
+    addTimer(Timers::CriticalPathTime);
+    changeEstimateBuffer(Timers::CriticalPathTime, 60);
+    addTimer(Timers::DispatchTime);
+    changeEstimateBuffer(Timers::DispatchTime, 60);
 }
 
 std::chrono::microseconds TimeStatistics::frameDeltaTime() const
@@ -55,6 +59,16 @@ std::chrono::microseconds TimeStatistics::lastFrameUpdateTime() const
     return getTimerLastFrame(UpdateTime);
 }
 
+std::chrono::microseconds TimeStatistics::criticalPathTime() const
+{
+    return getTimerEstimate(CriticalPathTime);
+}
+
+std::chrono::microseconds TimeStatistics::dispatchTime() const
+{
+    return getTimerEstimate(DispatchTime);
+}
+
 std::chrono::microseconds TimeStatistics::getTimerEstimate(int timer) const
 {
     auto iterator = m_timers.find(timer);
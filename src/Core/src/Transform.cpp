@@ -4,6 +4,7 @@
 // HG::Core
 #include <HG/Core/BuildProperties.hpp>
 #include <HG/Core/Transform.hpp>
+#include <HG/Core/TransformPool.hpp>
 
 // GLM
 #include <glm/gtx/matrix_decompose.hpp>
@@ -21,7 +22,14 @@ Transform::Transform(GameObject* owner) :
     m_localPosition(),
     m_owner(owner),
     m_parent(nullptr),
-    m_children()
+    m_children(),
+    m_dirty(true),
+    m_globalRotation(1.0f, 0.0f, 0.0f, 0.0f),
+    m_globalScale(1.0f, 1.0f, 1.0f),
+    m_globalPosition(),
+    m_localToWorldMatrix(1.0f),
+    m_pool(nullptr),
+    m_poolIndex(0)
 {
 }
 
@@ -32,10 +40,17 @@ Transform::~Transform()
         if (child->m_parent == this)
         {
             child->m_parent = nullptr;
+            child->markDirty();
+            child->invalidatePoolOrder();
         }
     }
 
     setParent(nullptr);
+
+    if (m_pool != nullptr)
+    {
+        m_pool->remove(this);
+    }
 }
 
 void Transform::rotateAround(glm::vec3 anchor, glm::quat rotValue)
@@ -67,104 +82,98 @@ void Transform::rotateAround(glm::vec3 anchor, glm::quat rotValue)
 
 glm::vec3 Transform::localScale() const
 {
-    return m_localScale;
+    return localScaleData();
 }
 
 void Transform::setLocalScale(const glm::vec3& scale)
 {
-    m_localScale = scale;
+    localScaleData() = scale;
+    markDirty();
 }
 
 glm::vec3 Transform::globalScale() const
 {
-    // Calculate
-    if (m_parent == nullptr)
-    {
-        return m_localScale;
-    }
-    else
-    {
-        return m_parent->globalScale() * m_localScale;
-    }
+    updateCache();
+
+    return globalScaleData();
 }
 
 void Transform::setGlobalScale(const glm::vec3& scale)
 {
     if (m_parent == nullptr)
     {
-        m_localScale = scale;
+        localScaleData() = scale;
     }
     else
     {
-        m_localScale = (scale / m_parent->globalScale());
+        localScaleData() = (scale / m_parent->globalScale());
     }
+
+    markDirty();
 }
 
 glm::quat Transform::localRotation() const
 {
-    return m_localRotation;
+    return localRotationData();
 }
 
 void Transform::setLocalRotation(const glm::quat& rotation)
 {
-    m_localRotation = rotation;
+    localRotationData() = rotation;
+    markDirty();
 }
 
 glm::vec3 Transform::localPosition() const
 {
-    return m_localPosition;
+    return localPositionData();
 }
 
 void Transform::setLocalPosition(const glm::vec3& localPosition)
 {
-    m_localPosition = localPosition;
+    localPositionData() = localPosition;
+    markDirty();
 }
 
 glm::vec3 Transform::globalPosition() const
 {
-    // Calculate
-    if (m_parent == nullptr)
-    {
-        return m_localPosition;
-    }
-    else
-    {
-        return m_parent->globalPosition() + m_parent->globalRotation() * m_localPosition;
-    }
+    updateCache();
+
+    return globalPositionData();
 }
 
 void Transform::setGlobalPosition(const glm::vec3& globalPosition)
 {
     if (m_parent == nullptr)
     {
-        m_localPosition = globalPosition;
+        localPositionData() = globalPosition;
     }
     else
     {
-        m_localPosition = (globalPosition - m_parent->globalPosition()) * m_parent->globalRotation();
+        localPositionData() = (globalPosition - m_parent->globalPosition()) * m_parent->globalRotation();
     }
+
+    markDirty();
 }
 
 glm::quat Transform::globalRotation() const
 {
-    if (m_parent == nullptr)
-    {
-        return m_localRotation;
-    }
+    updateCache();
 
-    return glm::normalize(m_parent->globalRotation() * m_localRotation);
+    return globalRotationData();
 }
 
 void Transform::setGlobalRotation(const glm::quat& rotation)
 {
     if (m_parent == nullptr)
     {
-        m_localRotation = glm::normalize(rotation);
+        localRotationData() = glm::normalize(rotation);
     }
     else
     {
-        m_localRotation = glm::normalize(rotation) * glm::normalize(glm::inverse(m_parent->globalRotation()));
+        localRotationData() = glm::normalize(rotation) * glm::normalize(glm::inverse(m_parent->globalRotation()));
     }
+
+    markDirty();
 }
 
 void Transform::setParent(Transform* transform)
@@ -190,8 +199,8 @@ void Transform::setParent(Transform* transform)
 
         m_parent = nullptr;
 
-        m_localPosition = currentGlobalPosition;
-        m_localRotation = currentGlobalRotation;
+        localPositionData() = currentGlobalPosition;
+        localRotationData() = currentGlobalRotation;
     }
     else
     {
@@ -207,9 +216,12 @@ void Transform::setParent(Transform* transform)
 
         transform->m_children.push_back(this);
 
-        m_localPosition = currentGlobalPosition;
-        m_localRotation = glm::inverse(transform->globalRotation()) * m_localRotation;
+        localPositionData() = currentGlobalPosition;
+        localRotationData() = glm::inverse(transform->globalRotation()) * localRotationData();
     }
+
+    markDirty();
+    invalidatePoolOrder();
 }
 
 Transform* Transform::parent() const
@@ -219,27 +231,43 @@ Transform* Transform::parent() const
 
 glm::mat4 Transform::localToWorldMatrix() const
 {
-    auto scale = globalScale();
+    updateCache();
 
-    // todo: Fckn monkeycoding. Fixes decomposition if scale is close to (0, 0, 0)
-    if (glm::abs(scale.x) < std::numeric_limits<float>::epsilon())
-    {
-        scale.x = 0.001;
-    }
-    if (glm::abs(scale.y) < std::numeric_limits<float>::epsilon())
+    return matrixData();
+}
+
+void Transform::localToWorldMatrices(const std::vector<Transform*>& transforms, std::vector<glm::mat4>& matrices)
+{
+    matrices.resize(transforms.size());
+
+    for (std::size_t index = 0; index < transforms.size(); ++index)
     {
-        scale.y = 0.001;
+        transforms[index]->updateCache();
+
+        matrices[index] = transforms[index]->matrixData();
     }
-    if (glm::abs(scale.z) < std::numeric_limits<float>::epsilon())
+}
+
+void Transform::globalPositions(const std::vector<Transform*>& transforms, std::vector<glm::vec3>& positions)
+{
+    positions.resize(transforms.size());
+
+    for (std::size_t index = 0; index < transforms.size(); ++index)
     {
-        scale.z = 0.001;
+        transforms[index]->updateCache();
+
+        positions[index] = transforms[index]->globalPositionData();
     }
+}
 
-    auto model = glm::translate(glm::mat4(1.0f), globalPosition());
-    model      = model * glm::mat4_cast(globalRotation());
-    model      = model * glm::scale(scale);
+void Transform::localPositions(const std::vector<Transform*>& transforms, std::vector<glm::vec3>& positions)
+{
+    positions.resize(transforms.size());
 
-    return model;
+    for (std::size_t index = 0; index < transforms.size(); ++index)
+    {
+        positions[index] = transforms[index]->localPositionData();
+    }
 }
 
 void Transform::setFromLocalToWorldMatrix(const glm::mat4& matrix)
@@ -267,6 +295,171 @@ GameObject* Transform::gameObject() const
     return m_owner;
 }
 
+void Transform::markDirty()
+{
+    // Children of dirty transform are dirty already
+    if (isDirty())
+    {
+        return;
+    }
+
+    setDirty(true);
+
+    for (auto& child : m_children)
+    {
+        child->markDirty();
+    }
+}
+
+void Transform::updateCache() const
+{
+    if (!isDirty())
+    {
+        return;
+    }
+
+    if (m_parent == nullptr)
+    {
+        globalScaleData()    = localScaleData();
+        globalRotationData() = localRotationData();
+        globalPositionData() = localPositionData();
+    }
+    else
+    {
+        m_parent->updateCache();
+
+        calculateGlobal(m_parent->globalPositionData(),
+                        m_parent->globalRotationData(),
+                        m_parent->globalScaleData(),
+                        localPositionData(),
+                        localRotationData(),
+                        localScaleData(),
+                        globalPositionData(),
+                        globalRotationData(),
+                        globalScaleData());
+    }
+
+    calculateMatrix(globalPositionData(), globalRotationData(), globalScaleData(), matrixData());
+
+    setDirty(false);
+}
+
+void Transform::calculateGlobal(const glm::vec3& parentPosition,
+                                const glm::quat& parentRotation,
+                                const glm::vec3& parentScale,
+                                const glm::vec3& localPosition,
+                                const glm::quat& localRotation,
+                                const glm::vec3& localScale,
+                                glm::vec3& globalPosition,
+                                glm::quat& globalRotation,
+                                glm::vec3& globalScale)
+{
+    globalScale    = parentScale * localScale;
+    globalRotation = glm::normalize(parentRotation * localRotation);
+    globalPosition = parentPosition + parentRotation * localPosition;
+}
+
+void Transform::calculateMatrix(const glm::vec3& position, const glm::quat& rotation, glm::vec3 scale, glm::mat4& matrix)
+{
+    // todo: Fckn monkeycoding. Fixes decomposition if scale is close to (0, 0, 0)
+    if (glm::abs(scale.x) < std::numeric_limits<float>::epsilon())
+    {
+        scale.x = 0.001;
+    }
+    if (glm::abs(scale.y) < std::numeric_limits<float>::epsilon())
+    {
+        scale.y = 0.001;
+    }
+    if (glm::abs(scale.z) < std::numeric_limits<float>::epsilon())
+    {
+        scale.z = 0.001;
+    }
+
+    matrix = glm::translate(glm::mat4(1.0f), position);
+    matrix = matrix * glm::mat4_cast(rotation);
+    matrix = matrix * glm::scale(scale);
+}
+
+template <typename Type>
+Type& Transform::field(Type Transform::*member, std::vector<Type> TransformPool::*array) const
+{
+    if (m_pool == nullptr)
+    {
+        return const_cast<Transform*>(this)->*member;
+    }
+
+    return (m_pool->*array)[m_poolIndex];
+}
+
+glm::quat& Transform::localRotationData() const
+{
+    return field(&Transform::m_localRotation, &TransformPool::m_localRotations);
+}
+
+glm::vec3& Transform::localScaleData() const
+{
+    return field(&Transform::m_localScale, &TransformPool::m_localScales);
+}
+
+glm::vec3& Transform::localPositionData() const
+{
+    return field(&Transform::m_localPosition, &TransformPool::m_localPositions);
+}
+
+glm::quat& Transform::globalRotationData() const
+{
+    return field(&Transform::m_globalRotation, &TransformPool::m_globalRotations);
+}
+
+glm::vec3& Transform::globalScaleData() const
+{
+    return field(&Transform::m_globalScale, &TransformPool::m_globalScales);
+}
+
+glm::vec3& Transform::globalPositionData() const
+{
+    return field(&Transform::m_globalPosition, &TransformPool::m_globalPositions);
+}
+
+glm::mat4& Transform::matrixData() const
+{
+    return field(&Transform::m_localToWorldMatrix, &TransformPool::m_matrices);
+}
+
+bool Transform::isDirty() const
+{
+    if (m_pool == nullptr)
+    {
+        return m_dirty;
+    }
+
+    return m_pool->m_dirty[m_poolIndex] != 0;
+}
+
+void Transform::setDirty(bool dirty) const
+{
+    if (m_pool == nullptr)
+    {
+        m_dirty = dirty;
+        return;
+    }
+
+    m_pool->m_dirty[m_poolIndex] = dirty ? 1 : 0;
+}
+
+void Transform::invalidatePoolOrder()
+{
+    if (m_pool != nullptr)
+    {
+        m_pool->invalidateOrder();
+    }
+
+    for (auto& child : m_children)
+    {
+        child->invalidatePoolOrder();
+    }
+}
+
 Transform::Transform(const Transform& transform) : Transform()
 {
     (*this) = transform;
@@ -275,7 +468,8 @@ Transform::Transform(const Transform& transform) : Transform()
 Transform& Transform::operator=(const Transform& transform)
 {
     // todo: Recalculate local rotation from current parent's rotation
-    m_localRotation = transform.globalRotation();
+    localRotationData() = transform.globalRotation();
+    markDirty();
 
     // todo: If global scale will appear, maybe global info must be copied here
     setGlobalScale(transform.globalScale());
@@ -0,0 +1,337 @@
+// C++ STL
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+// HG::Core
+#include <HG/Core/ThreadPool.hpp>
+#include <HG/Core/Transform.hpp>
+#include <HG/Core/TransformPool.hpp>
+
+namespace HG::Core
+{
+TransformPool::TransformPool() :
+    m_transforms(),
+    m_parents(),
+    m_levels(),
+    m_localPositions(),
+    m_localRotations(),
+    m_localScales(),
+    m_globalPositions(),
+    m_globalRotations(),
+    m_globalScales(),
+    m_matrices(),
+    m_dirty(),
+    m_orderChanged(false),
+    m_concurrentChunkSize(256)
+{
+}
+
+TransformPool::~TransformPool()
+{
+    clear();
+}
+
+void TransformPool::add(Transform* transform)
+{
+    if (transform == nullptr)
+    {
+        throw std::invalid_argument("Transform can't be nullptr");
+    }
+
+    if (transform->m_pool == this)
+    {
+        return;
+    }
+
+    if (transform->m_pool != nullptr)
+    {
+        transform->m_pool->remove(transform);
+    }
+
+    m_transforms.push_back(transform);
+    m_parents.push_back(NoParent);
+
+    m_localPositions.push_back(transform->m_localPosition);
+    m_localRotations.push_back(transform->m_localRotation);
+    m_localScales.push_back(transform->m_localScale);
+
+    m_globalPositions.push_back(transform->m_globalPosition);
+    m_globalRotations.push_back(transform->m_globalRotation);
+    m_globalScales.push_back(transform->m_globalScale);
+    m_matrices.push_back(transform->m_localToWorldMatrix);
+
+    m_dirty.push_back(transform->m_dirty ? 1 : 0);
+
+    transform->m_pool      = this;
+    transform->m_poolIndex = m_transforms.size() - 1;
+
+    invalidateOrder();
+}
+
+void TransformPool::remove(Transform* transform)
+{
+    if (transform == nullptr || transform->m_pool != this)
+    {
+        throw std::invalid_argument("Transform is not added to this pool");
+    }
+
+    auto index = transform->m_poolIndex;
+
+    // Moving values back to transform
+    transform->m_localPosition      = m_localPositions[index];
+    transform->m_localRotation      = m_localRotations[index];
+    transform->m_localScale         = m_localScales[index];
+    transform->m_globalPosition     = m_globalPositions[index];
+    transform->m_globalRotation     = m_globalRotations[index];
+    transform->m_globalScale        = m_globalScales[index];
+    transform->m_localToWorldMatrix = m_matrices[index];
+    transform->m_dirty              = m_dirty[index] != 0;
+
+    transform->m_pool      = nullptr;
+    transform->m_poolIndex = 0;
+
+    // Last transform takes place of removed one
+    auto last = m_transforms.size() - 1;
+
+    if (index != last)
+    {
+        m_transforms[index]      = m_transforms[last];
+        m_localPositions[index]  = m_localPositions[last];
+        m_localRotations[index]  = m_localRotations[last];
+        m_localScales[index]     = m_localScales[last];
+        m_globalPositions[index] = m_globalPositions[last];
+        m_globalRotations[index] = m_globalRotations[last];
+        m_globalScales[index]    = m_globalScales[last];
+        m_matrices[index]        = m_matrices[last];
+        m_dirty[index]           = m_dirty[last];
+
+        m_transforms[index]->m_poolIndex = index;
+    }
+
+    m_transforms.pop_back();
+    m_parents.pop_back();
+    m_localPositions.pop_back();
+    m_localRotations.pop_back();
+    m_localScales.pop_back();
+    m_globalPositions.pop_back();
+    m_globalRotations.pop_back();
+    m_globalScales.pop_back();
+    m_matrices.pop_back();
+    m_dirty.pop_back();
+
+    invalidateOrder();
+}
+
+void TransformPool::clear()
+{
+    while (!m_transforms.empty())
+    {
+        remove(m_transforms.back());
+    }
+
+    m_levels.clear();
+    m_orderChanged = false;
+}
+
+std::size_t TransformPool::size() const
+{
+    return m_transforms.size();
+}
+
+void TransformPool::update(ThreadPool* threadPool)
+{
+    if (m_orderChanged)
+    {
+        rebuildOrder();
+    }
+
+    if (m_transforms.empty())
+    {
+        return;
+    }
+
+    // Parents, that are not in pool, are calculated
+    // before concurrent update. Such transforms are
+    // placed on first level only.
+    for (std::size_t index = m_levels[0]; index < m_levels[1]; ++index)
+    {
+        if (m_dirty[index] && m_parents[index] == NoParent && m_transforms[index]->m_parent != nullptr)
+        {
+            m_transforms[index]->m_parent->updateCache();
+        }
+    }
+
+    for (std::size_t level = 0; level + 1 < m_levels.size(); ++level)
+    {
+        auto first = m_levels[level];
+        auto last  = m_levels[level + 1];
+
+        auto numberOfChunks = (last - first + m_concurrentChunkSize - 1) / m_concurrentChunkSize;
+
+        if (threadPool == nullptr || numberOfChunks < 2)
+        {
+            updateRange(first, last);
+            continue;
+        }
+
+        threadPool->parallelFor(
+            std::size_t(0),
+            numberOfChunks,
+            [this, first, last](std::size_t chunk) {
+                auto chunkFirst = first + chunk * m_concurrentChunkSize;
+
+                updateRange(chunkFirst, std::min(chunkFirst + m_concurrentChunkSize, last));
+            },
+            ThreadPool::Type::UserThread,
+            1);
+    }
+}
+
+const std::vector<glm::mat4>& TransformPool::localToWorldMatrices() const
+{
+    return m_matrices;
+}
+
+const std::vector<Transform*>& TransformPool::transforms() const
+{
+    return m_transforms;
+}
+
+void TransformPool::setConcurrentChunkSize(std::size_t size)
+{
+    if (size == 0)
+    {
+        throw std::invalid_argument("Concurrent chunk size can't be 0.");
+    }
+
+    m_concurrentChunkSize = size;
+}
+
+std::size_t TransformPool::concurrentChunkSize() const
+{
+    return m_concurrentChunkSize;
+}
+
+void TransformPool::invalidateOrder()
+{
+    m_orderChanged = true;
+}
+
+void TransformPool::rebuildOrder()
+{
+    auto numberOfTransforms = m_transforms.size();
+
+    std::vector<std::size_t> depths(numberOfTransforms, 0);
+
+    for (std::size_t index = 0; index < numberOfTransforms; ++index)
+    {
+        for (auto* parent = m_transforms[index]->m_parent; parent != nullptr && parent->m_pool == this;
+             parent       = parent->m_parent)
+        {
+            ++depths[index];
+        }
+    }
+
+    std::vector<std::size_t> order(numberOfTransforms);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+
+    std::stable_sort(order.begin(), order.end(), [&depths](std::size_t lhs, std::size_t rhs) {
+        return depths[lhs] < depths[rhs];
+    });
+
+    auto permute = [&order](auto& values) {
+        std::remove_reference_t<decltype(values)> result;
+        result.reserve(values.size());
+
+        for (auto index : order)
+        {
+            result.push_back(values[index]);
+        }
+
+        values.swap(result);
+    };
+
+    permute(m_transforms);
+    permute(m_localPositions);
+    permute(m_localRotations);
+    permute(m_localScales);
+    permute(m_globalPositions);
+    permute(m_globalRotations);
+    permute(m_globalScales);
+    permute(m_matrices);
+    permute(m_dirty);
+
+    m_levels.clear();
+
+    for (std::size_t index = 0; index < numberOfTransforms; ++index)
+    {
+        m_transforms[index]->m_poolIndex = index;
+
+        if (index == 0 || depths[order[index]] != depths[order[index - 1]])
+        {
+            m_levels.push_back(index);
+        }
+    }
+
+    m_levels.push_back(numberOfTransforms);
+
+    for (std::size_t index = 0; index < numberOfTransforms; ++index)
+    {
+        auto* parent = m_transforms[index]->m_parent;
+
+        m_parents[index] = (parent != nullptr && parent->m_pool == this) ? parent->m_poolIndex : NoParent;
+    }
+
+    m_orderChanged = false;
+}
+
+void TransformPool::updateRange(std::size_t first, std::size_t last)
+{
+    for (std::size_t index = first; index < last; ++index)
+    {
+        if (!m_dirty[index])
+        {
+            continue;
+        }
+
+        auto parent = m_parents[index];
+
+        if (parent != NoParent)
+        {
+            Transform::calculateGlobal(m_globalPositions[parent],
+                                       m_globalRotations[parent],
+                                       m_globalScales[parent],
+                                       m_localPositions[index],
+                                       m_localRotations[index],
+                                       m_localScales[index],
+                                       m_globalPositions[index],
+                                       m_globalRotations[index],
+                                       m_globalScales[index]);
+        }
+        else if (auto* externalParent = m_transforms[index]->m_parent; externalParent != nullptr)
+        {
+            Transform::calculateGlobal(externalParent->globalPositionData(),
+                                       externalParent->globalRotationData(),
+                                       externalParent->globalScaleData(),
+                                       m_localPositions[index],
+                                       m_localRotations[index],
+                                       m_localScales[index],
+                                       m_globalPositions[index],
+                                       m_globalRotations[index],
+                                       m_globalScales[index]);
+        }
+        else
+        {
+            m_globalPositions[index] = m_localPositions[index];
+            m_globalRotations[index] = m_localRotations[index];
+            m_globalScales[index]    = m_localScales[index];
+        }
+
+        Transform::calculateMatrix(
+            m_globalPositions[index], m_globalRotations[index], m_globalScales[index], m_matrices[index]);
+
+        m_dirty[index] = 0;
+    }
+}
+} // namespace HG::Core
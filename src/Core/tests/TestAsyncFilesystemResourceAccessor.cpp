@@ -0,0 +1,90 @@
+// C++ STL
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/AsyncFilesystemResourceAccessor.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+namespace
+{
+/**
+ * @brief Function for creating test files with
+ * different sizes and content.
+ */
+std::vector<std::string> createFiles(std::size_t numberOfFiles)
+{
+    auto directory = std::filesystem::temp_directory_path() / "HGTestAsyncAccessor";
+
+    std::filesystem::create_directories(directory);
+
+    std::vector<std::string> paths;
+
+    for (std::size_t index = 0; index < numberOfFiles; ++index)
+    {
+        auto path = (directory / ("file" + std::to_string(index))).string();
+
+        std::ofstream file(path, std::ios::binary);
+
+        for (std::size_t byte = 0; byte < index * 331; ++byte)
+        {
+            file.put(static_cast<char>((byte + index) % 251));
+        }
+
+        paths.push_back(path);
+    }
+
+    return paths;
+}
+
+void testAccessor(HG::Core::AsyncFilesystemResourceAccessor& accessor)
+{
+    auto paths = createFiles(100);
+
+    std::vector<HG::Utils::FutureHandler<HG::Core::DataPtr>> handlers;
+
+    for (auto&& path : paths)
+    {
+        handlers.push_back(accessor.loadRawAsync(path));
+    }
+
+    for (std::size_t index = 0; index < handlers.size(); ++index)
+    {
+        auto data = handlers[index].guaranteeGet();
+
+        ASSERT_NE(data, nullptr);
+        ASSERT_EQ(data->id(), paths[index]);
+        ASSERT_EQ(data->size(), index * 331);
+
+        for (std::size_t byte = 0; byte < data->size(); ++byte)
+        {
+            ASSERT_EQ(data->data()[byte], static_cast<std::byte>((byte + index) % 251));
+        }
+    }
+
+    ASSERT_EQ(accessor.loadRaw(paths[10])->size(), 10 * 331);
+    ASSERT_EQ(accessor.loadRawAsync("unexisting_file").guaranteeGet(), nullptr);
+}
+} // namespace
+
+TEST(Core, AsyncFilesystemResourceAccessor)
+{
+    HG::Core::AsyncFilesystemResourceAccessor accessor(16);
+
+    testAccessor(accessor);
+}
+
+TEST(Core, AsyncFilesystemResourceAccessorThreads)
+{
+    using Backend = HG::Core::AsyncFilesystemResourceAccessor::Backend;
+
+    HG::Core::AsyncFilesystemResourceAccessor accessor(16, 4, Backend::Threads);
+
+    ASSERT_EQ(accessor.backend(), Backend::Threads);
+
+    testAccessor(accessor);
+}
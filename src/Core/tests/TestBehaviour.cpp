@@ -58,3 +58,72 @@ TEST(Core, BehaviourProperties)
     properties1[1].getSetter<uint32_t>()(32);
     ASSERT_EQ(properties1[1].getGetter<uint32_t>()(), 32);
 }
+
+class DerivedPropertyBehaviour : public PropertyBehaviour
+{
+public:
+    class Settings
+    {
+    public:
+        void setScale(float scale)
+        {
+            m_scale = scale;
+        }
+
+        [[nodiscard]] float scale() const
+        {
+            return m_scale;
+        }
+
+    private:
+        float m_scale = 1.0f;
+    };
+
+    Settings m_settings;
+
+    HG_PROPERTY_DEFAULT(float, Float_Property, 0.5f);
+    HG_PROPERTY_INITIALIZER_RAW_OBJ(this, &m_settings, Scale, float, Settings::setScale, Settings::scale);
+};
+
+TEST(Core, BehaviourPropertyTable)
+{
+    DerivedPropertyBehaviour first;
+    DerivedPropertyBehaviour second;
+
+    // Table is shared by instances of type
+    ASSERT_NE(first.propertyTable(), nullptr);
+    ASSERT_EQ(first.propertyTable(), second.propertyTable());
+    ASSERT_EQ(first.propertyTable()->entries().size(), 2);
+
+    PropertyBehaviour base;
+    ASSERT_EQ(first.propertyTable()->parent(), base.propertyTable());
+
+    BlankBehaviour blank;
+    ASSERT_EQ(blank.propertyTable(), nullptr);
+    ASSERT_THROW((void)blank.getProperty<float>("Float_Property"), std::invalid_argument);
+
+    // Base properties go first
+    auto properties = first.getProperties();
+
+    ASSERT_EQ(properties.size(), 4);
+    ASSERT_EQ(properties[0].name(), "UInt8_Property");
+    ASSERT_EQ(properties[1].name(), "UInt32_Property");
+    ASSERT_EQ(properties[2].name(), "Float_Property");
+    ASSERT_EQ(properties[3].name(), "Scale");
+
+    // Values are per instance
+    first.setProperty<float>("Scale", 2.0f);
+    second.setProperty<std::uint32_t>("UInt32_Property", 7);
+
+    ASSERT_EQ(first.m_settings.scale(), 2.0f);
+    ASSERT_EQ(second.m_settings.scale(), 1.0f);
+    ASSERT_EQ(second.getProperty<std::uint32_t>("UInt32_Property"), 7);
+    ASSERT_EQ(first.getProperty<float>("Float_Property"), 0.5f);
+
+    properties[2].set<float>(4.0f);
+    ASSERT_EQ(first.getPropertyFloat_Property(), 4.0f);
+    ASSERT_EQ(properties[2].get<float>(), 4.0f);
+
+    ASSERT_THROW(first.setProperty<int>("Scale", 1), std::invalid_argument);
+    ASSERT_THROW(first.setProperty<float>("Unknown", 1.0f), std::invalid_argument);
+}
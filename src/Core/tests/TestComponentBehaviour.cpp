@@ -0,0 +1,150 @@
+// C++ STL
+#include <vector>
+
+// HG::Core
+#include <HG/Core/ComponentBehaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+class CounterComponent : public HG::Core::ComponentBehaviour<CounterComponent>
+{
+public:
+    int starts  = 0;
+    int updates = 0;
+
+protected:
+    void onStart() override
+    {
+        ++starts;
+    }
+
+    void onUpdate() override
+    {
+        ++updates;
+    }
+};
+
+TEST(Core, ComponentBehaviourSystem)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Scene scene;
+    scene.registerSystem<CounterComponent>(HG::Core::Behaviour::UpdateMode::Serial);
+
+    std::vector<HG::Core::GameObject*> gameObjects;
+    std::vector<CounterComponent*> components;
+
+    for (std::size_t index = 0; index < 4; ++index)
+    {
+        auto gameObject = new (&cache) HG::Core::GameObject;
+        auto component  = new (&scene) CounterComponent;
+
+        gameObject->addBehaviour(component);
+        scene.addGameObject(gameObject);
+
+        gameObjects.push_back(gameObject);
+        components.push_back(component);
+    }
+
+    auto storage = scene.componentStorage<CounterComponent>();
+
+    ASSERT_EQ(storage->size(), 4);
+    ASSERT_EQ(components[0]->updateMode(), HG::Core::Behaviour::UpdateMode::System);
+
+    // Components are placed in storage order
+    std::vector<CounterComponent*> stored;
+    storage->forEach([&stored](CounterComponent* component) { stored.push_back(component); });
+
+    ASSERT_EQ(stored, components);
+
+    scene.update();
+
+    // Gameobject API keeps working
+    ASSERT_EQ(gameObjects[2]->findBehaviour<CounterComponent>(), components[2]);
+
+    for (auto& component : components)
+    {
+        ASSERT_EQ(component->starts, 1);
+        ASSERT_EQ(component->updates, 1);
+    }
+
+    // Disabled components and gameobjects are skipped
+    components[1]->setEnabled(false);
+    gameObjects[2]->setEnabled(false);
+
+    scene.update();
+
+    ASSERT_EQ(components[0]->updates, 2);
+    ASSERT_EQ(components[1]->updates, 1);
+    ASSERT_EQ(components[2]->updates, 1);
+    ASSERT_EQ(components[3]->updates, 2);
+
+    // Removed component is deleted on next update
+    // and slot is reused
+    gameObjects[0]->removeBehaviour(components[0]);
+
+    scene.update();
+
+    ASSERT_EQ(storage->size(), 3);
+
+    auto component = new (&scene) CounterComponent;
+
+    ASSERT_EQ(component, components[0]);
+    ASSERT_EQ(storage->size(), 4);
+
+    gameObjects[0]->addBehaviour(component);
+
+    // Component is started before system update
+    scene.update();
+
+    ASSERT_EQ(component->starts, 1);
+    ASSERT_EQ(component->updates, 1);
+
+    // Components are deleted with gameobjects
+    // at the end of frame
+    scene.removeGameObject(gameObjects[3]);
+
+    ASSERT_EQ(storage->size(), 4);
+
+    scene.update();
+
+    ASSERT_EQ(storage->size(), 3);
+}
+
+TEST(Core, ComponentBehaviourConcurrentSystem)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Scene scene;
+    scene.setConcurrentUpdateChunkSize(16);
+    scene.registerSystem<CounterComponent>(HG::Core::Behaviour::UpdateMode::Concurrent);
+
+    ASSERT_THROW(scene.registerSystem<CounterComponent>(HG::Core::Behaviour::UpdateMode::System),
+                 std::invalid_argument);
+
+    std::vector<CounterComponent*> components;
+
+    // Several chunks of storage
+    for (std::size_t index = 0; index < 300; ++index)
+    {
+        auto gameObject = new (&cache) HG::Core::GameObject;
+        auto component  = new (&scene) CounterComponent;
+
+        gameObject->addBehaviour(component);
+        scene.addGameObject(gameObject);
+
+        components.push_back(component);
+    }
+
+    scene.update();
+    scene.update();
+
+    for (auto& component : components)
+    {
+        ASSERT_EQ(component->updates, 2);
+    }
+}
@@ -0,0 +1,105 @@
+// C++ STL
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/FrameGraph.hpp>
+#include <HG/Core/ThreadPool.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+TEST(Core, FrameGraphDependencies)
+{
+    HG::Core::ThreadPool pool;
+    HG::Core::FrameGraph graph;
+
+    std::mutex orderMutex;
+    std::vector<std::string> order;
+
+    auto taskFunction = [&order, &orderMutex](std::string name) {
+        return [&order, &orderMutex, name]() {
+            std::unique_lock<std::mutex> lock(orderMutex);
+            order.push_back(name);
+        };
+    };
+
+    graph.addTask("Write", taskFunction("Write"), {}, {"A"});
+    graph.addTask("Read", taskFunction("Read"), {"A"}, {});
+    graph.addTask("Rewrite", taskFunction("Rewrite"), {}, {"A"}, HG::Core::FrameGraph::Affinity::MainThread);
+
+    ASSERT_EQ(graph.numberOfTasks(), 3);
+    ASSERT_TRUE(graph.hasTask("Read"));
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        order.clear();
+
+        graph.execute(&pool);
+
+        std::vector<std::string> expected = {"Write", "Read", "Rewrite"};
+
+        ASSERT_EQ(order, expected);
+        ASSERT_EQ(graph.criticalPath(), expected);
+    }
+}
+
+TEST(Core, FrameGraphMainThreadAffinity)
+{
+    HG::Core::ThreadPool pool;
+    HG::Core::FrameGraph graph;
+
+    auto mainThread = std::this_thread::get_id();
+    std::thread::id executedOn;
+
+    graph.addTask(
+        "Main",
+        [&executedOn]() { executedOn = std::this_thread::get_id(); },
+        {},
+        {},
+        HG::Core::FrameGraph::Affinity::MainThread);
+
+    graph.execute(&pool);
+
+    ASSERT_EQ(executedOn, mainThread);
+}
+
+TEST(Core, FrameGraphRemoveTask)
+{
+    HG::Core::FrameGraph graph;
+
+    int value = 0;
+
+    graph.addTask("First", [&value]() { value += 1; }, {}, {"Value"});
+    graph.addTask("Second", [&value]() { value *= 10; }, {}, {"Value"});
+
+    graph.execute(nullptr);
+
+    ASSERT_EQ(value, 10);
+
+    graph.removeTask("First");
+
+    ASSERT_FALSE(graph.hasTask("First"));
+    ASSERT_THROW(graph.removeTask("First"), std::invalid_argument);
+    ASSERT_THROW(graph.addTask("Second", []() {}, {}, {}), std::invalid_argument);
+
+    graph.execute(nullptr);
+
+    ASSERT_EQ(value, 100);
+}
+
+TEST(Core, FrameGraphException)
+{
+    HG::Core::ThreadPool pool;
+    HG::Core::FrameGraph graph;
+
+    bool dependentExecuted = false;
+
+    graph.addTask("Throwing", []() { throw std::runtime_error("Failed"); }, {}, {"A"});
+    graph.addTask("Dependent", [&dependentExecuted]() { dependentExecuted = true; }, {"A"}, {});
+
+    ASSERT_THROW(graph.execute(&pool), std::runtime_error);
+    ASSERT_TRUE(dependentExecuted);
+}
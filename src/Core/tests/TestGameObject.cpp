@@ -0,0 +1,77 @@
+// C++ STL
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/ResourceCache.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+class BaseLookupBehaviour : public HG::Core::Behaviour
+{
+};
+
+class FirstLookupBehaviour : public BaseLookupBehaviour
+{
+};
+
+class SecondLookupBehaviour : public BaseLookupBehaviour
+{
+};
+
+class OtherLookupBehaviour : public HG::Core::Behaviour
+{
+};
+
+TEST(Core, GameObjectBehaviourLookup)
+{
+    HG::Core::ResourceCache cache;
+
+    auto gameObject = new (&cache) HG::Core::GameObject;
+
+    auto first  = new FirstLookupBehaviour;
+    auto second = new SecondLookupBehaviour;
+
+    gameObject->addBehaviour(first);
+    gameObject->addBehaviour(second);
+
+    // Added behaviours are available after update
+    ASSERT_EQ(gameObject->findBehaviour<FirstLookupBehaviour>(), nullptr);
+
+    gameObject->update();
+
+    ASSERT_EQ(gameObject->findBehaviour<FirstLookupBehaviour>(), first);
+    ASSERT_EQ(gameObject->findBehaviour<SecondLookupBehaviour>(), second);
+    ASSERT_EQ(gameObject->findBehaviour<BaseLookupBehaviour>(), first);
+    ASSERT_EQ(gameObject->findBehaviour<OtherLookupBehaviour>(), nullptr);
+
+    std::vector<HG::Core::Behaviour*> found;
+    gameObject->findBehaviours<BaseLookupBehaviour>(found);
+
+    ASSERT_EQ(found, (std::vector<HG::Core::Behaviour*>{first, second}));
+
+    // Removed behaviour is not found right away
+    gameObject->removeBehaviour(first);
+
+    ASSERT_EQ(gameObject->findBehaviour<FirstLookupBehaviour>(), nullptr);
+    ASSERT_EQ(gameObject->findBehaviour<BaseLookupBehaviour>(), second);
+
+    // Indexed types are updated on adding
+    auto other = new OtherLookupBehaviour;
+    auto third = new FirstLookupBehaviour;
+    gameObject->addBehaviour(other);
+    gameObject->addBehaviour(third);
+    gameObject->update();
+
+    ASSERT_EQ(gameObject->findBehaviour<OtherLookupBehaviour>(), other);
+    ASSERT_EQ(gameObject->findBehaviour<FirstLookupBehaviour>(), third);
+
+    found.clear();
+    gameObject->findBehaviours<BaseLookupBehaviour>(found);
+
+    ASSERT_EQ(found, (std::vector<HG::Core::Behaviour*>{second, third}));
+
+    delete gameObject;
+}
@@ -0,0 +1,85 @@
+// C++ STL
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/MainThreadDispatcher.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+TEST(Core, MainThreadDispatcherPriorities)
+{
+    HG::Core::MainThreadDispatcher dispatcher;
+
+    std::vector<int> order;
+
+    dispatcher.push([&order]() { order.push_back(3); }, HG::Core::MainThreadDispatcher::Priority::Low);
+    dispatcher.push([&order]() { order.push_back(1); });
+    dispatcher.push([&order]() { order.push_back(0); }, HG::Core::MainThreadDispatcher::Priority::High);
+    dispatcher.push([&order]() { order.push_back(2); });
+
+    ASSERT_EQ(dispatcher.numberOfPendingJobs(), 4);
+    ASSERT_EQ(dispatcher.numberOfPendingJobs(HG::Core::MainThreadDispatcher::Priority::Normal), 2);
+
+    dispatcher.setBudget(std::chrono::seconds(1));
+
+    ASSERT_EQ(dispatcher.execute(), 4);
+    ASSERT_EQ(order, std::vector<int>({0, 1, 2, 3}));
+    ASSERT_EQ(dispatcher.numberOfPendingJobs(), 0);
+}
+
+TEST(Core, MainThreadDispatcherBudget)
+{
+    HG::Core::MainThreadDispatcher dispatcher;
+
+    dispatcher.setBudget(std::chrono::milliseconds(1));
+
+    ASSERT_EQ(dispatcher.budget(), std::chrono::milliseconds(1));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        dispatcher.push([]() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+    }
+
+    // Job, that exceeds budget, is executed anyway
+    ASSERT_EQ(dispatcher.execute(), 1);
+    ASSERT_GE(dispatcher.lastExecutionTime(), std::chrono::milliseconds(5));
+    ASSERT_EQ(dispatcher.numberOfPendingJobs(), 2);
+
+    ASSERT_EQ(dispatcher.execute(), 1);
+    ASSERT_EQ(dispatcher.execute(), 1);
+    ASSERT_EQ(dispatcher.execute(), 0);
+}
+
+TEST(Core, MainThreadDispatcherPushFromThreads)
+{
+    HG::Core::MainThreadDispatcher dispatcher;
+
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&dispatcher, &counter]() {
+            for (int j = 0; j < 100; ++j)
+            {
+                dispatcher.push([&counter]() { ++counter; });
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    dispatcher.push([]() { throw std::runtime_error("Failed"); });
+
+    dispatcher.setBudget(std::chrono::seconds(1));
+
+    ASSERT_EQ(dispatcher.execute(), 401);
+    ASSERT_EQ(counter, 400);
+}
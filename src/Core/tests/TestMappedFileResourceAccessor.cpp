@@ -0,0 +1,50 @@
+// C++ STL
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// HG::Core
+#include <HG/Core/MappedFileResourceAccessor.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+TEST(Core, MappedFileResourceAccessor)
+{
+    auto directory = std::filesystem::temp_directory_path() / "HGTestMappedAccessor";
+
+    std::filesystem::create_directories(directory);
+
+    auto path      = (directory / "file").string();
+    auto emptyPath = (directory / "empty").string();
+
+    std::string content(100000, '\0');
+
+    for (std::size_t i = 0; i < content.size(); ++i)
+    {
+        content[i] = static_cast<char>(i % 251);
+    }
+
+    std::ofstream(path, std::ios::binary) << content;
+    std::ofstream(emptyPath, std::ios::binary).close();
+
+    HG::Core::DataPtr data;
+
+    {
+        HG::Core::MappedFileResourceAccessor accessor;
+
+        data = accessor.loadRaw(path);
+
+        ASSERT_EQ(accessor.loadRaw(emptyPath)->size(), 0);
+        ASSERT_EQ(accessor.loadRaw((directory / "unexisting").string()), nullptr);
+    }
+
+    // Mapping outlives accessor
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(data->id(), path);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(data->data()), data->size()), content);
+
+    data = nullptr;
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,325 @@
+// C++ STL
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/PackageResourceAccessor.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// ZLib
+#include <zlib.h>
+
+namespace
+{
+void pushBigEndian(std::string& buffer, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        buffer.push_back(static_cast<char>((value >> ((size - i - 1) * 8)) & 0xFFu));
+    }
+}
+
+void pushEntry(std::string& buffer,
+               std::uint8_t type,
+               std::uint32_t id,
+               std::uint32_t parentId,
+               const std::string& name,
+               std::uint64_t offset,
+               std::uint64_t size)
+{
+    pushBigEndian(buffer, type, 1);
+    pushBigEndian(buffer, 0, 3);
+    pushBigEndian(buffer, id, 4);
+    pushBigEndian(buffer, parentId, 4);
+    pushBigEndian(buffer, name.size(), 4);
+    pushBigEndian(buffer, offset, 8);
+    pushBigEndian(buffer, size, 8);
+
+    buffer += name;
+    buffer.append(16 - (32 + name.size()) % 16, '\0');
+}
+
+void pushEntry(std::string& buffer,
+               std::uint8_t type,
+               std::uint32_t id,
+               std::uint32_t parentId,
+               const std::string& name,
+               std::uint64_t offset,
+               std::uint64_t compressedSize,
+               std::uint64_t size,
+               std::uint32_t crc,
+               const std::string& blocks)
+{
+    pushBigEndian(buffer, type, 1);
+    pushBigEndian(buffer, 0, 3);
+    pushBigEndian(buffer, id, 4);
+    pushBigEndian(buffer, parentId, 4);
+    pushBigEndian(buffer, name.size(), 4);
+    pushBigEndian(buffer, offset, 8);
+    pushBigEndian(buffer, compressedSize, 8);
+    pushBigEndian(buffer, size, 8);
+    pushBigEndian(buffer, crc, 4);
+    pushBigEndian(buffer, blocks.size() / 8, 4);
+
+    buffer += name;
+    buffer.append(16 - (48 + name.size()) % 16, '\0');
+
+    if (type == 2)
+    {
+        buffer += blocks;
+        buffer.append(16 - blocks.size() % 16, '\0');
+    }
+}
+
+std::string compress(const std::string& data)
+{
+    std::string result(compressBound(data.size()), '\0');
+
+    auto size = static_cast<uLongf>(result.size());
+
+    compress2(reinterpret_cast<Bytef*>(result.data()),
+              &size,
+              reinterpret_cast<const Bytef*>(data.data()),
+              data.size(),
+              Z_BEST_COMPRESSION);
+
+    result.resize(size);
+
+    return result;
+}
+
+/**
+ * @brief Function for writing package, like
+ * HG::Tools::PackageProcessor does, with
+ * `root.txt`, `dir/small.txt` and `dir/big.bin` files.
+ */
+void writePackage(const std::string& path, const std::vector<std::string>& contents)
+{
+    std::vector<std::string> compressed;
+
+    for (auto&& content : contents)
+    {
+        compressed.push_back(compress(content));
+    }
+
+    // Header
+    std::string package;
+    pushBigEndian(package, 0xDEC0DE00, 4);
+    package.append(12, '\0');
+    pushBigEndian(package, 1, 4);
+    pushBigEndian(package, 0, 4);
+    pushBigEndian(package, 4, 4);
+    pushBigEndian(package, 0, 4);
+
+    // File structure: 4 entries with short names
+    std::uint64_t offset = package.size() + 4 * 48;
+
+    pushEntry(package, 2, 1, 0, "root.txt", offset, compressed[0].size());
+    offset += compressed[0].size();
+
+    pushEntry(package, 1, 2, 0, "dir", 0, 0);
+    pushEntry(package, 2, 3, 2, "small.txt", offset, compressed[1].size());
+    offset += compressed[1].size();
+
+    pushEntry(package, 2, 4, 2, "big.bin", offset, compressed[2].size());
+
+    for (auto&& data : compressed)
+    {
+        package += data;
+    }
+
+    std::ofstream(path, std::ios::binary) << package;
+}
+
+/**
+ * @brief Function for writing version 2 package with
+ * `root.txt` and `dir/big.bin` files, that are split
+ * into blocks. Blocks, that can't be compressed, are
+ * stored as is.
+ */
+void writePackageVersion2(const std::string& path, const std::vector<std::string>& contents, std::size_t blockSize)
+{
+    // Header is filled after directory
+    std::string package(48, '\0');
+    std::string directory;
+
+    std::vector<std::string> names = {"root.txt", "big.bin"};
+
+    pushEntry(directory, 1, 1, 0, "dir", 0, 0, 0, 0, "");
+
+    for (std::size_t index = 0; index < contents.size(); ++index)
+    {
+        std::string table;
+
+        auto offset = package.size();
+
+        for (std::size_t begin = 0; begin < contents[index].size(); begin += blockSize)
+        {
+            auto block      = contents[index].substr(begin, blockSize);
+            auto compressed = compress(block);
+
+            if (compressed.size() >= block.size())
+            {
+                compressed = block;
+            }
+
+            pushBigEndian(table, compressed.size(), 4);
+            pushBigEndian(table, crc32(0, reinterpret_cast<const Bytef*>(block.data()), block.size()), 4);
+
+            package += compressed;
+        }
+
+        pushEntry(directory,
+                  2,
+                  index + 2,
+                  index == 0 ? 0 : 1,
+                  names[index],
+                  offset,
+                  package.size() - offset,
+                  contents[index].size(),
+                  crc32(0, reinterpret_cast<const Bytef*>(contents[index].data()), contents[index].size()),
+                  table);
+    }
+
+    auto directoryOffset = package.size();
+
+    package += directory;
+
+    std::string header;
+    pushBigEndian(header, 0xDEC0DE00, 4);
+    pushBigEndian(header, crc32(0, reinterpret_cast<const Bytef*>(directory.data()), directory.size()), 4);
+    pushBigEndian(header, package.size(), 8);
+    pushBigEndian(header, 2, 4);
+    pushBigEndian(header, 0, 4);
+    pushBigEndian(header, 3, 4);
+    pushBigEndian(header, blockSize, 4);
+    pushBigEndian(header, directoryOffset, 8);
+    pushBigEndian(header, directory.size(), 8);
+
+    package.replace(0, header.size(), header);
+
+    std::ofstream(path, std::ios::binary) << package;
+}
+} // namespace
+
+TEST(Core, PackageResourceAccessor)
+{
+    auto path = (std::filesystem::temp_directory_path() / "HGTestPackageAccessor.hgpackage").string();
+
+    std::string big(300000, '\0');
+
+    for (std::size_t i = 0; i < big.size(); ++i)
+    {
+        big[i] = static_cast<char>((i * 7) % 13);
+    }
+
+    std::vector<std::string> contents = {"Root file", "Small file", big};
+
+    writePackage(path, contents);
+
+    HG::Core::PackageResourceAccessor accessor(path);
+
+    ASSERT_EQ(accessor.numberOfEntries(), 3);
+    ASSERT_TRUE(accessor.hasEntry("./dir/small.txt"));
+    ASSERT_FALSE(accessor.hasEntry("dir"));
+    ASSERT_EQ(accessor.loadRaw("unexisting.txt"), nullptr);
+
+    std::vector<std::string> ids = {"root.txt", "dir/small.txt", "dir/big.bin"};
+
+    // Loading from several threads
+    std::vector<std::thread> threads;
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&]() {
+            for (std::size_t index = 0; index < ids.size(); ++index)
+            {
+                auto data = accessor.loadRaw(ids[index]);
+
+                ASSERT_NE(data, nullptr);
+                ASSERT_EQ(std::string(reinterpret_cast<const char*>(data->data()), data->size()), contents[index]);
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::filesystem::remove(path);
+
+    ASSERT_THROW(HG::Core::PackageResourceAccessor{path}, std::invalid_argument);
+}
+
+TEST(Core, PackageResourceAccessorBlocks)
+{
+    auto path = (std::filesystem::temp_directory_path() / "HGTestPackageAccessorBlocks.hgpackage").string();
+
+    constexpr std::size_t blockSize = 1024;
+
+    // Compressible and random halves
+    std::string big(10 * blockSize + 100, '\0');
+
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < big.size(); ++i)
+    {
+        state  = state * 1103515245u + 12345u;
+        big[i] = static_cast<char>(i < big.size() / 2 ? i % 13 : state >> 24u);
+    }
+
+    std::vector<std::string> contents = {"Root file", big};
+
+    writePackageVersion2(path, contents, blockSize);
+
+    {
+        HG::Core::PackageResourceAccessor accessor(path);
+
+        ASSERT_EQ(accessor.numberOfEntries(), 2);
+
+        auto asString = [](const HG::Core::DataPtr& data) {
+            return std::string(reinterpret_cast<const char*>(data->data()), data->size());
+        };
+
+        ASSERT_EQ(asString(accessor.loadRaw("root.txt")), contents[0]);
+        ASSERT_EQ(asString(accessor.loadRaw("dir/big.bin")), big);
+
+        // Ranges inside block, across blocks and clamped by size
+        ASSERT_EQ(asString(accessor.loadRange("dir/big.bin", 10, 20)), big.substr(10, 20));
+        ASSERT_EQ(asString(accessor.loadRange("dir/big.bin", 1000, 5000)), big.substr(1000, 5000));
+        ASSERT_EQ(asString(accessor.loadRange("dir/big.bin", big.size() - 50, 500)), big.substr(big.size() - 50));
+        ASSERT_EQ(accessor.loadRange("dir/big.bin", big.size() + 1, 1), nullptr);
+    }
+
+    // Damaging last block, that's placed before directory
+    {
+        std::fstream package(path, std::ios::binary | std::ios::in | std::ios::out);
+
+        std::string header(48, '\0');
+        package.read(header.data(), header.size());
+
+        std::uint64_t directoryOffset = 0;
+        for (std::size_t i = 32; i < 40; ++i)
+        {
+            directoryOffset = (directoryOffset << 8u) | static_cast<std::uint8_t>(header[i]);
+        }
+
+        package.seekp(directoryOffset - 1);
+        package.put('\xFF');
+    }
+
+    {
+        HG::Core::PackageResourceAccessor accessor(path);
+
+        ASSERT_NE(accessor.loadRange("dir/big.bin", 0, blockSize * 10), nullptr);
+        ASSERT_EQ(accessor.loadRange("dir/big.bin", blockSize * 10, 1), nullptr);
+        ASSERT_EQ(accessor.loadRaw("dir/big.bin"), nullptr);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,105 @@
+// C++ STL
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/Prefab.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/Transform.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+class SpeedBehaviour : public HG::Core::Behaviour
+{
+    HG_PROPERTY_DEFAULT(float, Speed, 1.0f);
+};
+
+class SpeedComponent : public HG::Core::ComponentBehaviour<SpeedComponent>
+{
+    HG_PROPERTY_DEFAULT(int, Damage, 0);
+};
+
+TEST(Core, PrefabSpawn)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Scene scene;
+
+    HG::Core::Prefab prefab(&cache);
+
+    prefab.root()
+        .setName("Bullet")
+        .setTag("Projectile")
+        .setLayer(2)
+        .addBehaviour<SpeedBehaviour>()
+        .setProperty("Speed", 5.0f);
+
+    prefab.addChild(prefab.root())
+        .setName("Trail")
+        .setLocalPosition(glm::vec3(0.0f, 0.0f, 1.0f))
+        .addBehaviour<SpeedComponent>()
+        .setProperty("Damage", 3);
+
+    ASSERT_EQ(prefab.size(), 2);
+
+    // Pools are pre-warmed
+    prefab.reserve(50);
+
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), 100);
+    ASSERT_EQ(cache.availableResources<HG::Core::Transform>(), 100);
+
+    std::vector<HG::Core::GameObject*> roots;
+    prefab.spawn(&scene, 50, roots);
+
+    ASSERT_EQ(roots.size(), 50);
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), 0);
+
+    for (auto&& root : roots)
+    {
+        ASSERT_EQ(root->scene(), &scene);
+        ASSERT_EQ(root->name(), "Bullet");
+        ASSERT_EQ(root->tag(), "Projectile");
+        ASSERT_EQ(root->layer(), 2);
+        ASSERT_EQ(root->transform()->children().size(), 1);
+
+        auto child = root->transform()->children()[0]->gameObject();
+
+        ASSERT_EQ(child->scene(), &scene);
+        ASSERT_EQ(child->name(), "Trail");
+        ASSERT_EQ(child->transform()->localPosition(), glm::vec3(0.0f, 0.0f, 1.0f));
+    }
+
+    scene.update();
+
+    std::vector<HG::Core::GameObject*> found;
+    scene.findGameObjectsWithTag("Projectile", found);
+
+    ASSERT_EQ(found, roots);
+
+    ASSERT_EQ(roots[7]->findBehaviour<SpeedBehaviour>()->getProperty<float>("Speed"), 5.0f);
+    ASSERT_EQ(scene.componentStorage<SpeedComponent>()->size(), 50);
+
+    // Despawned gameobjects return to pools
+    for (auto&& root : roots)
+    {
+        scene.removeGameObject(root->transform()->children()[0]->gameObject());
+        scene.removeGameObject(root);
+    }
+
+    scene.update();
+
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), 100);
+    ASSERT_EQ(scene.componentStorage<SpeedComponent>()->size(), 0);
+
+    // Unknown property is reported on spawn
+    HG::Core::Prefab broken(&cache);
+    broken.root().addBehaviour<SpeedBehaviour>().setProperty("Unknown", 1.0f);
+
+    roots.clear();
+    ASSERT_THROW(broken.spawn(&scene, 1, roots), std::invalid_argument);
+    ASSERT_TRUE(roots.empty());
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), 100);
+}
@@ -0,0 +1,244 @@
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Application.hpp>
+#include <HG/Core/Data.hpp>
+#include <HG/Core/MainThreadDispatcher.hpp>
+#include <HG/Core/ResourceAccessor.hpp>
+#include <HG/Core/ResourceManager.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+namespace
+{
+std::atomic_size_t activeDecoders  = 0;
+std::atomic_size_t maximumDecoders = 0;
+
+class StringData : public HG::Core::Data
+{
+public:
+    explicit StringData(std::string id) : m_id(std::move(id))
+    {
+    }
+
+    [[nodiscard]] std::size_t size() const override
+    {
+        return m_id.size();
+    }
+
+    [[nodiscard]] const std::byte* data() const override
+    {
+        return reinterpret_cast<const std::byte*>(m_id.data());
+    }
+
+    [[nodiscard]] std::string id() const override
+    {
+        return m_id;
+    }
+
+private:
+    std::string m_id;
+};
+
+/**
+ * @brief Accessor, that returns resource id as
+ * resource data. Ids, that starts with `missing`
+ * can't be loaded.
+ */
+class StringAccessor : public HG::Core::ResourceAccessor
+{
+public:
+    HG::Core::DataPtr loadRaw(const std::string& id) override
+    {
+        if (id.rfind("missing", 0) == 0)
+        {
+            return nullptr;
+        }
+
+        return std::make_shared<StringData>(id);
+    }
+};
+
+/**
+ * @brief Slow loader, that counts simultaneous decodings.
+ */
+class StringLoader
+{
+public:
+    using ResultType = std::shared_ptr<std::string>;
+
+    ResultType load(const std::byte* data, std::size_t size)
+    {
+        auto active = ++activeDecoders;
+
+        auto maximum = maximumDecoders.load();
+        while (active > maximum && !maximumDecoders.compare_exchange_weak(maximum, active))
+        {
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        --activeDecoders;
+
+        return std::make_shared<std::string>(reinterpret_cast<const char*>(data), size);
+    }
+};
+
+HG::Core::Application* decodingApplication = nullptr;
+std::atomic_bool decodingStarted           = false;
+std::atomic_bool decodingFinished          = false;
+
+/**
+ * @brief Slow loader, that stages job to
+ * application main thread dispatcher.
+ */
+class DispatchingLoader
+{
+public:
+    using ResultType = std::shared_ptr<std::string>;
+
+    ResultType load(const std::byte* data, std::size_t size)
+    {
+        decodingStarted = true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        decodingApplication->mainThreadDispatcher()->push([]() {});
+
+        decodingFinished = true;
+
+        return std::make_shared<std::string>(reinterpret_cast<const char*>(data), size);
+    }
+};
+} // namespace
+
+TEST(Core, ResourceManagerStages)
+{
+    HG::Core::Application application("ResourceManagerStages");
+
+    auto* manager = application.resourceManager();
+
+    manager->setResourceAccessor(new StringAccessor());
+
+    ASSERT_THROW(manager->setStageConcurrency(HG::Core::ResourceManager::Stage::Decoding, 0), std::invalid_argument);
+
+    manager->setStageConcurrency(HG::Core::ResourceManager::Stage::Decoding, 2);
+    ASSERT_EQ(manager->stageConcurrency(HG::Core::ResourceManager::Stage::Decoding), 2);
+
+    std::vector<HG::Utils::FutureHandler<StringLoader::ResultType>> handlers;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        handlers.push_back(manager->load<StringLoader>("resource" + std::to_string(i)));
+    }
+
+    auto missing = manager->load<StringLoader>("missing");
+
+    for (int i = 0; i < 20; ++i)
+    {
+        auto result = handlers[i].guaranteeGet();
+
+        ASSERT_NE(result, nullptr);
+        ASSERT_EQ(*result, "resource" + std::to_string(i));
+    }
+
+    ASSERT_EQ(missing.guaranteeGet(), nullptr);
+    ASSERT_LE(maximumDecoders, 2);
+
+    // Slots are released after decoding
+    while (manager->numberOfActiveJobs(HG::Core::ResourceManager::Stage::Decoding) != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(manager->numberOfQueuedJobs(HG::Core::ResourceManager::Stage::Reading), 0);
+    ASSERT_EQ(manager->numberOfQueuedJobs(HG::Core::ResourceManager::Stage::Decoding), 0);
+}
+
+TEST(Core, ResourceManagerCache)
+{
+    HG::Core::Application application("ResourceManagerCache");
+
+    auto* manager = application.resourceManager();
+    auto* cache   = manager->assetCache();
+
+    manager->setResourceAccessor(new StringAccessor());
+
+    // Second request is joined to first or hits loaded asset
+    auto first  = manager->load<StringLoader>("cached");
+    auto second = manager->load<StringLoader>("cached");
+
+    auto resource = first.guaranteeGet();
+
+    ASSERT_NE(resource, nullptr);
+    ASSERT_EQ(second.guaranteeGet(), resource);
+    ASSERT_EQ(cache->numberOfMisses(), 1);
+    ASSERT_EQ(cache->numberOfHits() + cache->numberOfCoalesced(), 1);
+
+    // Released asset is retained
+    first    = HG::Utils::FutureHandler<StringLoader::ResultType>(nullptr);
+    second   = HG::Utils::FutureHandler<StringLoader::ResultType>(nullptr);
+    resource = nullptr;
+
+    while (cache->retainedSize() != std::string("cached").size())
+    {
+        std::this_thread::yield();
+    }
+
+    auto hits = cache->numberOfHits();
+
+    auto third = manager->load<StringLoader>("cached");
+
+    ASSERT_TRUE(third.isReady());
+    ASSERT_EQ(*third.get(), "cached");
+    ASSERT_EQ(cache->numberOfHits(), hits + 1);
+    ASSERT_EQ(cache->retainedSize(), 0);
+
+    third = HG::Utils::FutureHandler<StringLoader::ResultType>(nullptr);
+
+    // Released asset doesn't fit budget
+    cache->setBudget(0);
+
+    ASSERT_EQ(cache->retainedSize(), 0);
+    ASSERT_EQ(cache->numberOfEvictions(), 1);
+
+    ASSERT_EQ(manager->load<StringLoader>("missing").guaranteeGet(), nullptr);
+    ASSERT_EQ(cache->numberOfMisses(), 2);
+}
+
+TEST(Core, ResourceManagerApplicationDestruction)
+{
+    auto application = new HG::Core::Application("ResourceManagerApplicationDestruction");
+
+    decodingApplication = application;
+
+    application->resourceManager()->setResourceAccessor(new StringAccessor());
+
+    // Continuation is posted to main thread queue after decoding
+    application->resourceManager()->load<DispatchingLoader>("pending").then([](DispatchingLoader::ResultType) {},
+                                                                             application->mainThreadQueue());
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (!decodingStarted && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_TRUE(decodingStarted);
+
+    // Running decoding is waited for before
+    // dispatcher and main thread queue deletion
+    delete application;
+
+    decodingApplication = nullptr;
+
+    ASSERT_TRUE(decodingFinished);
+}
@@ -0,0 +1,434 @@
+// C++ STL
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Application.hpp>
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/ThreadPool.hpp>
+#include <HG/Core/Transform.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+class TrackedBehaviour : public HG::Core::Behaviour
+{
+public:
+    explicit TrackedBehaviour(int* destroyed) : m_destroyed(destroyed)
+    {
+    }
+
+    ~TrackedBehaviour() override
+    {
+        ++(*m_destroyed);
+    }
+
+    int updates = 0;
+
+    // Gameobject, that's removed on update
+    HG::Core::GameObject* target = nullptr;
+
+protected:
+    void onUpdate() override
+    {
+        ++updates;
+
+        if (target != nullptr)
+        {
+            scene()->removeGameObject(target);
+            target = nullptr;
+        }
+    }
+
+private:
+    int* m_destroyed;
+};
+
+class ConcurrentBehaviour : public HG::Core::Behaviour
+{
+public:
+    explicit ConcurrentBehaviour(std::atomic<int>* unstable) : m_unstable(unstable)
+    {
+        setUpdateMode(UpdateMode::Concurrent);
+    }
+
+    int updates = 0;
+
+    // Behaviour, that's removed on update
+    ConcurrentBehaviour* victim = nullptr;
+
+    // Behaviour, that's added to same gameobject on update
+    ConcurrentBehaviour* added = nullptr;
+
+    // Gameobject, that's added to scene on update
+    HG::Core::GameObject* spawned = nullptr;
+
+    // Global position, read on update
+    glm::vec3 globalPosition = glm::vec3(0.0f);
+
+protected:
+    void onUpdate() override
+    {
+        if (!HG::Core::Scene::isConcurrentUpdate())
+        {
+            ++(*m_unstable);
+        }
+
+        auto parent = gameObject();
+        auto handle = this->handle();
+
+        globalPosition = parent->transform()->globalPosition();
+
+        if (victim != nullptr)
+        {
+            victim->gameObject()->removeBehaviour(victim);
+            victim = nullptr;
+        }
+
+        if (added != nullptr)
+        {
+            parent->addBehaviour(added);
+            added = nullptr;
+        }
+
+        if (spawned != nullptr)
+        {
+            scene()->addGameObject(spawned);
+            spawned = nullptr;
+        }
+
+        // Giving other chunks time to remove this behaviour
+        std::this_thread::yield();
+
+        if (gameObject() != parent || this->handle() != handle)
+        {
+            ++(*m_unstable);
+        }
+
+        ++updates;
+    }
+
+private:
+    std::atomic<int>* m_unstable;
+};
+
+TEST(Core, SceneGameObjectIndices)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Scene scene;
+
+    std::vector<HG::Core::GameObject*> gameObjects;
+
+    for (std::size_t index = 0; index < 4; ++index)
+    {
+        auto gameObject = new (&cache) HG::Core::GameObject;
+
+        gameObject->setName(index < 2 ? "Enemy" : "Player");
+        gameObject->setTag(index % 2 == 0 ? "Red" : "Blue");
+        gameObject->setLayer(static_cast<std::uint32_t>(index));
+
+        scene.addGameObject(gameObject);
+        gameObjects.push_back(gameObject);
+    }
+
+    // Gameobjects, added on current frame, are not found
+    ASSERT_EQ(scene.findGameObject("Enemy"), nullptr);
+
+    scene.update();
+
+    ASSERT_EQ(scene.findGameObject("Enemy"), gameObjects[0]);
+    ASSERT_EQ(scene.findGameObject("None"), nullptr);
+
+    // Gameobjects are found in adding order
+    std::vector<HG::Core::GameObject*> found;
+    scene.findGameObjects("Player", found);
+
+    std::vector<HG::Core::GameObject*> expected = {gameObjects[2], gameObjects[3]};
+
+    ASSERT_EQ(found, expected);
+
+    // Renaming keeps order
+    gameObjects[2]->setName("Boss");
+    gameObjects[2]->setName("Player");
+
+    ASSERT_EQ(scene.findGameObject("Player"), gameObjects[2]);
+
+    gameObjects[0]->setName("Boss");
+
+    ASSERT_EQ(scene.findGameObject("Boss"), gameObjects[0]);
+    ASSERT_EQ(scene.findGameObject("Enemy"), gameObjects[1]);
+
+    // Tags
+    std::size_t numberOfRed = 0;
+    scene.forEachWithTag("Red", [&numberOfRed](HG::Core::GameObject* gameObject) {
+        ASSERT_EQ(gameObject->tag(), "Red");
+        ++numberOfRed;
+    });
+
+    ASSERT_EQ(numberOfRed, 2);
+
+    gameObjects[1]->setTag("Red");
+
+    found.clear();
+    scene.findGameObjectsWithTag("Red", found);
+
+    expected = {gameObjects[0], gameObjects[1], gameObjects[2]};
+
+    ASSERT_EQ(found, expected);
+
+    found.clear();
+    scene.findGameObjectsWithTag("Blue", found);
+    ASSERT_EQ(found.size(), 1);
+    ASSERT_EQ(found[0], gameObjects[3]);
+
+    // Layers
+    gameObjects[2]->setLayer(3);
+
+    found.clear();
+    scene.findGameObjectsInLayer(3, found);
+    ASSERT_EQ(found.size(), 2);
+
+    found.clear();
+    scene.findGameObjectsInLayer(2, found);
+    ASSERT_TRUE(found.empty());
+
+    // Hidden gameobjects are not found
+    gameObjects[1]->setHidden(true);
+
+    ASSERT_EQ(scene.findGameObject("Enemy"), nullptr);
+
+    // Removed gameobjects are not found
+    scene.removeGameObject(gameObjects[3]);
+
+    ASSERT_EQ(scene.findGameObject("Player"), gameObjects[2]);
+
+    found.clear();
+    scene.findGameObjectsWithTag("Blue", found);
+    ASSERT_TRUE(found.empty());
+
+    std::size_t numberInLayer = 0;
+    scene.forEachInLayer(3, [&numberInLayer](HG::Core::GameObject*) { ++numberInLayer; });
+
+    ASSERT_EQ(numberInLayer, 1);
+
+    // Removing keeps order of remaining gameobjects
+    gameObjects[1]->setHidden(false);
+
+    auto last = new (&cache) HG::Core::GameObject;
+    last->setTag("Red");
+    scene.addGameObject(last);
+
+    scene.removeGameObject(gameObjects[0]);
+    scene.update();
+
+    found.clear();
+    scene.findGameObjectsWithTag("Red", found);
+
+    expected = {gameObjects[1], gameObjects[2], last};
+
+    ASSERT_EQ(found, expected);
+}
+
+TEST(Core, SceneHandlesAndDeferredDestruction)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Scene scene;
+
+    int destroyed = 0;
+
+    std::vector<HG::Core::GameObject*> gameObjects;
+    std::vector<TrackedBehaviour*> behaviours;
+
+    for (std::size_t index = 0; index < 3; ++index)
+    {
+        auto gameObject = new (&cache) HG::Core::GameObject;
+        auto behaviour  = new TrackedBehaviour(&destroyed);
+
+        gameObject->addBehaviour(behaviour);
+        scene.addGameObject(gameObject);
+
+        gameObjects.push_back(gameObject);
+        behaviours.push_back(behaviour);
+    }
+
+    auto gameObjectHandle = gameObjects[2]->handle();
+    auto behaviourHandle  = behaviours[2]->handle();
+
+    ASSERT_FALSE(gameObjectHandle.isNull());
+    ASSERT_EQ(scene.gameObject(gameObjectHandle), gameObjects[2]);
+    ASSERT_EQ(scene.behaviour(behaviourHandle), behaviours[2]);
+
+    // Gameobject, removed by previous one, is not updated
+    // and is deleted at the end of frame
+    behaviours[0]->target = gameObjects[2];
+
+    scene.update();
+
+    ASSERT_EQ(behaviours[1]->updates, 1);
+    ASSERT_EQ(destroyed, 1);
+    ASSERT_EQ(scene.gameObject(gameObjectHandle), nullptr);
+    ASSERT_EQ(scene.behaviour(behaviourHandle), nullptr);
+
+    // Slot is reused with new generation
+    auto gameObject = new (&cache) HG::Core::GameObject;
+    scene.addGameObject(gameObject);
+
+    ASSERT_EQ(gameObject->handle().index, gameObjectHandle.index);
+    ASSERT_NE(gameObject->handle(), gameObjectHandle);
+    ASSERT_EQ(scene.gameObject(gameObjectHandle), nullptr);
+    ASSERT_EQ(scene.gameObject(gameObject->handle()), gameObject);
+
+    // Handle of removed behaviour is outdated right away,
+    // but behaviour is deleted at the end of frame
+    behaviourHandle = behaviours[1]->handle();
+    gameObjects[1]->removeBehaviour(behaviours[1]);
+
+    ASSERT_EQ(scene.behaviour(behaviourHandle), nullptr);
+    ASSERT_EQ(destroyed, 1);
+
+    scene.update();
+
+    ASSERT_EQ(destroyed, 2);
+
+    // Mass despawn is deleted in one pass
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        auto spawned = new (&cache) HG::Core::GameObject;
+        spawned->addBehaviour(new TrackedBehaviour(&destroyed));
+
+        scene.addGameObject(spawned);
+        gameObjects.push_back(spawned);
+    }
+
+    scene.update();
+
+    for (auto iterator = gameObjects.begin() + 3; iterator != gameObjects.end(); ++iterator)
+    {
+        scene.removeGameObject(*iterator);
+
+        // Double removing is ignored
+        scene.removeGameObject(*iterator);
+    }
+
+    ASSERT_EQ(destroyed, 2);
+
+    scene.update();
+
+    ASSERT_EQ(destroyed, 102);
+
+    std::vector<HG::Core::GameObject*> left;
+    scene.getGameObjects(left);
+
+    ASSERT_EQ(left.size(), 3);
+}
+
+TEST(Core, SceneConcurrentUpdate)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Application application("TestSceneConcurrentUpdate");
+    application.threadPool()->startPool(HG::Core::ThreadPool::Type::UserThread, 4);
+
+    HG::Core::Scene scene;
+    scene.setApplication(&application);
+    scene.setConcurrentUpdateChunkSize(8);
+
+    std::atomic<int> unstable = 0;
+
+    constexpr std::size_t numberOfGameObjects = 256;
+
+    // Shared parent, that's dirty before update
+    auto root = new (&cache) HG::Core::GameObject;
+    scene.addGameObject(root);
+
+    std::vector<HG::Core::GameObject*> gameObjects;
+    std::vector<ConcurrentBehaviour*> behaviours;
+
+    for (std::size_t index = 0; index < numberOfGameObjects; ++index)
+    {
+        auto gameObject = new (&cache) HG::Core::GameObject;
+        auto behaviour  = new ConcurrentBehaviour(&unstable);
+
+        gameObject->transform()->setParent(root->transform());
+        gameObject->transform()->setLocalPosition(glm::vec3(0.0f, static_cast<float>(index), 0.0f));
+
+        gameObject->addBehaviour(behaviour);
+        scene.addGameObject(gameObject);
+
+        gameObjects.push_back(gameObject);
+        behaviours.push_back(behaviour);
+    }
+
+    root->transform()->setLocalPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+
+    scene.update();
+
+    ASSERT_EQ(unstable.load(), 0);
+
+    // Global values are read from refreshed cache
+    for (std::size_t index = 0; index < numberOfGameObjects; ++index)
+    {
+        ASSERT_EQ(behaviours[index]->updates, 1);
+        ASSERT_EQ(behaviours[index]->globalPosition, glm::vec3(1.0f, 2.0f + static_cast<float>(index), 3.0f));
+    }
+
+    // First half removes behaviours of second half, that
+    // are updated by other chunks at the same time
+    std::vector<HG::Core::Handle<HG::Core::Behaviour>> victims;
+    std::vector<ConcurrentBehaviour*> added;
+    std::vector<HG::Core::GameObject*> spawned;
+
+    for (std::size_t index = 0; index < numberOfGameObjects / 2; ++index)
+    {
+        auto remover = behaviours[index];
+
+        remover->victim = behaviours[numberOfGameObjects - 1 - index];
+        victims.push_back(remover->victim->handle());
+        remover->added  = added.emplace_back(new ConcurrentBehaviour(&unstable));
+
+        remover->spawned = spawned.emplace_back(new (&cache) HG::Core::GameObject);
+        remover->spawned->setName("Spawned");
+    }
+
+    scene.update();
+
+    // Parent and handles were stable during update
+    ASSERT_EQ(unstable.load(), 0);
+
+    // Deferred changes are applied after update,
+    // removed behaviours are deleted already
+    for (std::size_t index = 0; index < numberOfGameObjects / 2; ++index)
+    {
+        ASSERT_EQ(scene.behaviour(victims[index]), nullptr);
+        ASSERT_EQ(gameObjects[numberOfGameObjects - 1 - index]->findBehaviour<ConcurrentBehaviour>(), nullptr);
+
+        ASSERT_EQ(added[index]->gameObject(), gameObjects[index]);
+        ASSERT_FALSE(added[index]->handle().isNull());
+        ASSERT_EQ(scene.behaviour(added[index]->handle()), added[index]);
+
+        ASSERT_EQ(spawned[index]->scene(), &scene);
+    }
+
+    scene.update();
+
+    ASSERT_EQ(unstable.load(), 0);
+
+    // Added behaviours are updated, removed ones are not
+    for (std::size_t index = 0; index < numberOfGameObjects / 2; ++index)
+    {
+        ASSERT_EQ(behaviours[index]->updates, 3);
+        ASSERT_EQ(added[index]->updates, 1);
+    }
+
+    // Spawned gameobjects are added in remover order
+    std::vector<HG::Core::GameObject*> found;
+    scene.findGameObjects("Spawned", found);
+
+    ASSERT_EQ(found, spawned);
+}
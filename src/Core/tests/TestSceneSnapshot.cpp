@@ -0,0 +1,230 @@
+// C++ STL
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/SceneSnapshot.hpp>
+#include <HG/Core/Transform.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+struct SnapshotTexture
+{
+    std::string id;
+};
+
+static SnapshotTexture snapshotBrick{"Textures/brick.png"};
+
+class SnapshotMover : public HG::Core::Behaviour
+{
+    HG_PROPERTY_DEFAULT(float, Speed, 1.0f);
+    HG_PROPERTY_DEFAULT(glm::vec3, Direction, glm::vec3(0.0f, 0.0f, 1.0f));
+    HG_PROPERTY_DEFAULT(std::string, Label, "");
+};
+
+class SnapshotRenderer : public HG::Core::ComponentBehaviour<SnapshotRenderer>
+{
+    HG_PROPERTY_DEFAULT(SnapshotTexture*, Texture, nullptr);
+};
+
+class SnapshotUnregistered : public HG::Core::Behaviour
+{
+};
+
+TEST(Core, SceneSnapshotRoundTrip)
+{
+    HG::Core::SceneSnapshot::registerBehaviour<SnapshotMover>("SnapshotMover");
+    HG::Core::SceneSnapshot::registerBehaviour<SnapshotRenderer>("SnapshotRenderer");
+    HG::Core::SceneSnapshot::registerResourceType<SnapshotTexture*>(
+        [](SnapshotTexture* const& texture) { return texture->id; },
+        [](std::string_view id) { return id == snapshotBrick.id ? &snapshotBrick : nullptr; });
+
+    HG::Core::ResourceCache cache;
+
+    std::vector<std::byte> image;
+
+    {
+        HG::Core::ResourceCache sourceCache;
+        HG::Core::Scene scene;
+
+        auto root = new (&sourceCache) HG::Core::GameObject;
+        root->setName("Wall");
+        root->setTag("Static");
+        root->setLayer(3);
+        root->transform()->setLocalPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+
+        auto mover = new SnapshotMover;
+        mover->setProperty<float>("Speed", 4.0f);
+        mover->setProperty<glm::vec3>("Direction", glm::vec3(1.0f, 0.0f, 0.0f));
+        mover->setProperty<std::string>("Label", "Moving wall");
+        root->addBehaviour(mover);
+
+        auto child = new (&sourceCache) HG::Core::GameObject;
+        child->setName("Brick");
+        child->setHidden(true);
+        child->transform()->setParent(root->transform());
+        child->transform()->setLocalScale(glm::vec3(2.0f, 2.0f, 2.0f));
+
+        auto renderer = new (&scene) SnapshotRenderer;
+        renderer->setProperty<SnapshotTexture*>("Texture", &snapshotBrick);
+        child->addBehaviour(renderer);
+
+        // Not registered behaviours are skipped
+        child->addBehaviour(new SnapshotUnregistered);
+
+        // Child is added before parent, but stored after it
+        scene.addGameObject(child);
+        scene.addGameObject(root);
+
+        image = HG::Core::SceneSnapshot::capture(&scene);
+    }
+
+    auto snapshot = HG::Core::SceneSnapshotLoader().load(image.data(), image.size());
+
+    ASSERT_NE(snapshot, nullptr);
+    ASSERT_EQ(snapshot->numberOfGameObjects(), 2);
+    ASSERT_EQ(snapshot->resources().size(), 1);
+    ASSERT_EQ(snapshot->resources()[0], "Textures/brick.png");
+
+    HG::Core::Scene scene;
+    snapshot->instantiate(&scene, &cache);
+
+    scene.update();
+
+    auto root = scene.findGameObject("Wall");
+
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->transform()->children().size(), 1);
+
+    // Hidden gameobjects are not found by name
+    auto child = root->transform()->children()[0]->gameObject();
+
+    ASSERT_EQ(scene.findGameObject("Brick"), nullptr);
+    ASSERT_EQ(child->name(), "Brick");
+
+    ASSERT_EQ(root->tag(), "Static");
+    ASSERT_EQ(root->layer(), 3);
+    ASSERT_EQ(root->transform()->localPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+    ASSERT_EQ(child->isHidden(), true);
+    ASSERT_EQ(child->transform()->parent(), root->transform());
+    ASSERT_EQ(child->transform()->localScale(), glm::vec3(2.0f, 2.0f, 2.0f));
+
+    auto mover = root->findBehaviour<SnapshotMover>();
+
+    ASSERT_NE(mover, nullptr);
+    ASSERT_EQ(mover->getProperty<float>("Speed"), 4.0f);
+    ASSERT_EQ(mover->getProperty<glm::vec3>("Direction"), glm::vec3(1.0f, 0.0f, 0.0f));
+    ASSERT_EQ(mover->getProperty<std::string>("Label"), "Moving wall");
+
+    auto renderer = child->findBehaviour<SnapshotRenderer>();
+
+    ASSERT_NE(renderer, nullptr);
+    ASSERT_EQ(renderer->getProperty<SnapshotTexture*>("Texture"), &snapshotBrick);
+    ASSERT_EQ(child->findBehaviour<SnapshotUnregistered>(), nullptr);
+    ASSERT_EQ(scene.componentStorage<SnapshotRenderer>()->size(), 1);
+}
+
+TEST(Core, SceneSnapshotInvalid)
+{
+    HG::Core::SceneSnapshot::registerBehaviour<SnapshotMover>("SnapshotMover");
+
+    HG::Core::ResourceCache cache;
+
+    std::vector<std::byte> image;
+
+    {
+        HG::Core::ResourceCache sourceCache;
+        HG::Core::Scene scene;
+
+        auto mover = new SnapshotMover;
+        mover->setProperty<float>("Speed", 4.0f);
+        mover->setProperty<glm::vec3>("Direction", glm::vec3(1.0f, 0.0f, 0.0f));
+
+        auto gameObject = new (&sourceCache) HG::Core::GameObject;
+        gameObject->addBehaviour(mover);
+        scene.addGameObject(gameObject);
+
+        image = HG::Core::SceneSnapshot::capture(&scene);
+    }
+
+    HG::Core::SceneSnapshotLoader loader;
+
+    // Truncated image
+    ASSERT_EQ(loader.load(image.data(), 16), nullptr);
+    ASSERT_EQ(loader.load(image.data(), image.size() - 1), nullptr);
+
+    // Not snapshot
+    auto corrupted = image;
+    corrupted[0]   = std::byte{0};
+
+    ASSERT_EQ(loader.load(corrupted.data(), corrupted.size()), nullptr);
+
+    // Unknown behaviour type name
+    std::string typeName = "SnapshotMover";
+
+    auto renamed  = image;
+    auto position = std::search(renamed.begin(),
+                                renamed.end(),
+                                reinterpret_cast<const std::byte*>(typeName.data()),
+                                reinterpret_cast<const std::byte*>(typeName.data() + typeName.size()));
+
+    ASSERT_NE(position, renamed.end());
+    *position = std::byte{'X'};
+
+    auto snapshot = loader.load(renamed.data(), renamed.size());
+
+    ASSERT_NE(snapshot, nullptr);
+
+    HG::Core::Scene scene;
+
+    ASSERT_THROW(snapshot->instantiate(&scene, &cache), std::runtime_error);
+
+    // Created gameobjects are returned to pool
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), 1);
+
+    scene.update();
+
+    ASSERT_EQ(scene.findGameObject(""), nullptr);
+
+    // Property, which type was changed to type of same size
+    std::string floatName = "float";
+    std::string intName   = "int32";
+
+    auto retyped = image;
+    position     = std::search(retyped.begin(),
+                           retyped.end(),
+                           reinterpret_cast<const std::byte*>(floatName.data()),
+                           reinterpret_cast<const std::byte*>(floatName.data() + floatName.size()));
+
+    ASSERT_NE(position, retyped.end());
+    std::copy(reinterpret_cast<const std::byte*>(intName.data()),
+              reinterpret_cast<const std::byte*>(intName.data() + intName.size()),
+              position);
+
+    snapshot = loader.load(retyped.data(), retyped.size());
+
+    ASSERT_NE(snapshot, nullptr);
+
+    HG::Core::Scene retypedScene;
+    snapshot->instantiate(&retypedScene, &cache);
+
+    retypedScene.update();
+
+    std::vector<HG::Core::GameObject*> gameObjects;
+    retypedScene.getGameObjects(gameObjects);
+
+    ASSERT_EQ(gameObjects.size(), 1);
+
+    auto mover = gameObjects[0]->findBehaviour<SnapshotMover>();
+
+    // Changed property is skipped, others are restored
+    ASSERT_NE(mover, nullptr);
+    ASSERT_EQ(mover->getProperty<float>("Speed"), 1.0f);
+    ASSERT_EQ(mover->getProperty<glm::vec3>("Direction"), glm::vec3(1.0f, 0.0f, 0.0f));
+}
@@ -0,0 +1,236 @@
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/Behaviour.hpp>
+#include <HG/Core/GameObject.hpp>
+#include <HG/Core/MainThreadDispatcher.hpp>
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/Scene.hpp>
+#include <HG/Core/SceneSnapshot.hpp>
+#include <HG/Core/SceneStreamer.hpp>
+#include <HG/Core/ThreadPool.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+static void waitForPreparation(const HG::Core::SceneLoadingPtr& loading)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (loading->state() == HG::Core::SceneLoading::State::Preparing &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+class StreamedBehaviour : public HG::Core::Behaviour
+{
+    HG_PROPERTY_DEFAULT(int, Value, 0);
+};
+
+TEST(Core, SceneStreamerScene)
+{
+    HG::Core::ThreadPool threadPool;
+    HG::Core::MainThreadDispatcher dispatcher;
+    HG::Core::ResourceCache cache;
+
+    HG::Core::SceneStreamer streamer(&threadPool, &dispatcher);
+
+    bool uploaded = false;
+
+    auto loading = streamer.loadScene([&cache, &uploaded](HG::Core::SceneLoading& loading) {
+        auto scene = new HG::Core::Scene;
+
+        auto gameObject = new (&cache) HG::Core::GameObject;
+        gameObject->setName("Terrain");
+        scene->addGameObject(gameObject);
+
+        loading.setProgress(0.5f);
+        loading.dispatch([&uploaded]() { uploaded = true; });
+
+        return scene;
+    });
+
+    waitForPreparation(loading);
+
+    // Swap waits for staged main thread jobs
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Staging);
+    ASSERT_EQ(loading->progress(), 0.5f);
+    ASSERT_EQ(loading->numberOfPendingJobs(), 1);
+    ASSERT_EQ(streamer.takeReadyScene(), nullptr);
+
+    dispatcher.execute();
+
+    ASSERT_TRUE(uploaded);
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Ready);
+    ASSERT_EQ(loading->progress(), 1.0f);
+
+    auto scene = streamer.takeReadyScene();
+
+    ASSERT_NE(scene, nullptr);
+
+    scene->update();
+
+    ASSERT_NE(scene->findGameObject("Terrain"), nullptr);
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Finished);
+    ASSERT_EQ(streamer.numberOfLoadings(), 0);
+
+    delete scene;
+
+    // Failed preparation is dropped
+    loading = streamer.loadScene(
+        [](HG::Core::SceneLoading&) -> HG::Core::Scene* { throw std::runtime_error("Asset is missing."); });
+
+    waitForPreparation(loading);
+
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Failed);
+    ASSERT_EQ(streamer.takeReadyScene(), nullptr);
+    ASSERT_EQ(streamer.numberOfLoadings(), 0);
+
+    // New loading cancels previous one
+    auto first = streamer.loadScene([](HG::Core::SceneLoading&) { return new HG::Core::Scene; });
+    auto last  = streamer.loadScene([](HG::Core::SceneLoading&) { return new HG::Core::Scene; });
+
+    waitForPreparation(last);
+
+    ASSERT_EQ(first->state(), HG::Core::SceneLoading::State::Cancelled);
+    ASSERT_EQ(last->state(), HG::Core::SceneLoading::State::Ready);
+    ASSERT_EQ(streamer.numberOfLoadings(), 1);
+
+    delete streamer.takeReadyScene();
+}
+
+TEST(Core, SceneStreamerDestruction)
+{
+    HG::Core::ThreadPool threadPool;
+    HG::Core::MainThreadDispatcher dispatcher;
+
+    std::atomic_bool started(false);
+    std::atomic_bool finished(false);
+
+    HG::Core::SceneLoadingPtr loading;
+
+    {
+        HG::Core::SceneStreamer streamer(&threadPool, &dispatcher);
+
+        loading = streamer.loadScene([&started, &finished](HG::Core::SceneLoading& loading) {
+            started = true;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            // Streamer is deleted already, job is not staged
+            loading.dispatch([]() {});
+
+            finished = true;
+
+            return new HG::Core::Scene;
+        });
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (!started && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        ASSERT_TRUE(started);
+    }
+
+    // Destructor waits for running preparation
+    ASSERT_TRUE(finished);
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Cancelled);
+    ASSERT_EQ(loading->numberOfPendingJobs(), 0);
+    ASSERT_EQ(dispatcher.numberOfPendingJobs(), 0);
+}
+
+TEST(Core, SceneStreamerSubScenes)
+{
+    HG::Core::SceneSnapshot::registerBehaviour<StreamedBehaviour>("StreamedBehaviour");
+
+    HG::Core::ThreadPool threadPool;
+    HG::Core::MainThreadDispatcher dispatcher;
+    HG::Core::ResourceCache cache;
+
+    std::vector<std::byte> image;
+
+    {
+        HG::Core::Scene chunk;
+
+        for (int index = 0; index < 3; ++index)
+        {
+            auto gameObject = new (&cache) HG::Core::GameObject;
+            gameObject->setTag("Chunk");
+
+            auto behaviour = new StreamedBehaviour;
+            behaviour->setProperty("Value", index);
+            gameObject->addBehaviour(behaviour);
+
+            chunk.addGameObject(gameObject);
+        }
+
+        image = HG::Core::SceneSnapshot::capture(&chunk);
+    }
+
+    HG::Core::Scene scene;
+    HG::Core::SceneStreamer streamer(&threadPool, &dispatcher);
+
+    auto loading = streamer.loadSubScene(&scene, "Chunk_0_0", [&image](HG::Core::SceneLoading&) {
+        return HG::Core::SceneSnapshotLoader().load(image.data(), image.size());
+    });
+
+    ASSERT_THROW(streamer.loadSubScene(&scene, "Chunk_0_0", nullptr), std::invalid_argument);
+
+    waitForPreparation(loading);
+
+    // Sub-scenes are added only to their scene
+    HG::Core::Scene other;
+    streamer.proceedSubScenes(&other, &cache);
+
+    ASSERT_FALSE(other.hasSubScene("Chunk_0_0"));
+
+    streamer.proceedSubScenes(&scene, &cache);
+
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Finished);
+    ASSERT_TRUE(scene.hasSubScene("Chunk_0_0"));
+    ASSERT_EQ(streamer.numberOfLoadings(), 0);
+
+    scene.update();
+
+    std::vector<HG::Core::GameObject*> found;
+    scene.findGameObjectsWithTag("Chunk", found);
+
+    ASSERT_EQ(found.size(), 3);
+
+    auto available = cache.availableResources<HG::Core::GameObject>();
+
+    // Gameobject, removed separately, is skipped on unloading
+    scene.removeGameObject(found[0]);
+    scene.update();
+
+    scene.removeSubScene("Chunk_0_0");
+    scene.update();
+
+    found.clear();
+    scene.findGameObjectsWithTag("Chunk", found);
+
+    ASSERT_TRUE(found.empty());
+    ASSERT_FALSE(scene.hasSubScene("Chunk_0_0"));
+    ASSERT_EQ(cache.availableResources<HG::Core::GameObject>(), available + 3);
+
+    // Cancelled loading is not added
+    loading = streamer.loadSubScene(&scene, "Chunk_0_1", [&image](HG::Core::SceneLoading&) {
+        return HG::Core::SceneSnapshotLoader().load(image.data(), image.size());
+    });
+
+    streamer.cancelSubScenes(&scene);
+    streamer.proceedSubScenes(&scene, &cache);
+
+    ASSERT_EQ(loading->state(), HG::Core::SceneLoading::State::Cancelled);
+    ASSERT_FALSE(scene.hasSubScene("Chunk_0_1"));
+}
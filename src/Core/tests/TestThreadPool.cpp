@@ -0,0 +1,192 @@
+// C++ STL
+#include <atomic>
+#include <numeric>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// HG::Core
+#include <HG/Core/ThreadPool.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+TEST(Core, ThreadPoolPushResult)
+{
+    HG::Core::ThreadPool pool;
+
+    auto future = pool.push([]() { return 42; });
+
+    ASSERT_EQ(future.guaranteeGet(), 42);
+}
+
+TEST(Core, ThreadPoolManyJobs)
+{
+    HG::Core::ThreadPool pool;
+
+    constexpr std::size_t numberOfJobs = 10000;
+
+    std::atomic_size_t counter = 0;
+
+    std::vector<HG::Utils::FutureHandler<bool>> futures;
+    futures.reserve(numberOfJobs);
+
+    for (std::size_t i = 0; i < numberOfJobs; ++i)
+    {
+        futures.emplace_back(pool.push([&counter]() {
+            ++counter;
+            return true;
+        }));
+    }
+
+    for (auto&& future : futures)
+    {
+        ASSERT_TRUE(future.guaranteeGet());
+    }
+
+    ASSERT_EQ(counter, numberOfJobs);
+}
+
+TEST(Core, ThreadPoolNestedPush)
+{
+    HG::Core::ThreadPool pool;
+
+    constexpr std::size_t numberOfJobs = 100;
+
+    std::atomic_size_t counter = 0;
+
+    pool.push([&pool, &counter]() {
+        for (std::size_t i = 0; i < numberOfJobs; ++i)
+        {
+            pool.push([&counter]() { ++counter; });
+        }
+    });
+
+    while (counter != numberOfJobs)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(counter, numberOfJobs);
+}
+
+TEST(Core, ThreadPoolJobsOrder)
+{
+    HG::Core::ThreadPool pool;
+
+    constexpr std::size_t numberOfJobs = 10;
+
+    std::atomic_bool blocked = true;
+    std::atomic_size_t finished = 0;
+
+    std::mutex orderMutex;
+    std::vector<std::size_t> order;
+
+    auto record = [&orderMutex, &order, &finished](std::size_t value) {
+        {
+            std::unique_lock<std::mutex> lock(orderMutex);
+            order.push_back(value);
+        }
+
+        ++finished;
+    };
+
+    // Only file loading thread is blocked,
+    // while external jobs are pushed
+    pool.push(
+        [&blocked]() {
+            while (blocked)
+            {
+                std::this_thread::yield();
+            }
+        },
+        HG::Core::ThreadPool::Type::FileLoadingThread);
+
+    for (std::size_t i = 0; i < numberOfJobs; ++i)
+    {
+        pool.push([&record, i]() { record(i); }, HG::Core::ThreadPool::Type::FileLoadingThread);
+    }
+
+    // Jobs, pushed by pool thread itself,
+    // are executed in reverse order
+    pool.push(
+        [&pool, &record]() {
+            for (std::size_t i = 0; i < numberOfJobs; ++i)
+            {
+                pool.push([&record, i]() { record(numberOfJobs * 2 - i - 1); },
+                          HG::Core::ThreadPool::Type::FileLoadingThread);
+            }
+        },
+        HG::Core::ThreadPool::Type::FileLoadingThread);
+
+    blocked = false;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (finished != numberOfJobs * 2 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(orderMutex);
+
+    ASSERT_EQ(order.size(), numberOfJobs * 2);
+
+    for (std::size_t i = 0; i < numberOfJobs; ++i)
+    {
+        ASSERT_EQ(order[i], i);
+    }
+
+    for (std::size_t i = numberOfJobs; i < numberOfJobs * 2; ++i)
+    {
+        ASSERT_EQ(order[i], i);
+    }
+}
+
+TEST(Core, ThreadPoolParallelFor)
+{
+    HG::Core::ThreadPool pool;
+
+    std::vector<int> values(100000, 0);
+
+    pool.parallelFor(0, static_cast<int>(values.size()), [&values](int index) { values[index] = index; });
+
+    for (int i = 0; i < static_cast<int>(values.size()); ++i)
+    {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+TEST(Core, ThreadPoolParallelForEach)
+{
+    HG::Core::ThreadPool pool;
+
+    std::vector<std::size_t> values(4096);
+    std::iota(values.begin(), values.end(), 0);
+
+    pool.parallelForEach(values, [](std::size_t& value) { value *= 2; }, HG::Core::ThreadPool::Type::UserThread, 16);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(values[i], i * 2);
+    }
+}
+
+TEST(Core, ThreadPoolParallelForException)
+{
+    HG::Core::ThreadPool pool;
+
+    ASSERT_THROW(pool.parallelFor(0,
+                                  1000,
+                                  [](int index) {
+                                      if (index == 500)
+                                      {
+                                          throw std::runtime_error("Failed");
+                                      }
+                                  },
+                                  HG::Core::ThreadPool::Type::UserThread,
+                                  10),
+                 std::runtime_error);
+}
@@ -68,3 +68,102 @@ TEST(Core, TransformParentAfterFree)
         ASSERT_EQ(child->parent(), nullptr);
     }
 }
+
+TEST(Core, TransformCachedHierarchy)
+{
+    HG::Core::Transform root;
+    HG::Core::Transform child;
+    HG::Core::Transform leaf;
+
+    child.setParent(&root);
+    leaf.setParent(&child);
+
+    child.setLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+    leaf.setLocalPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+    leaf.setLocalScale(glm::vec3(2.0f, 2.0f, 2.0f));
+
+    ASSERT_EQ(leaf.globalPosition(), glm::vec3(1.0f, 1.0f, 0.0f));
+
+    // Change of parent is propagated to cached children
+    root.setLocalPosition(glm::vec3(0.0f, 0.0f, 5.0f));
+    root.setLocalScale(glm::vec3(3.0f, 3.0f, 3.0f));
+
+    ASSERT_EQ(child.globalPosition(), glm::vec3(1.0f, 0.0f, 5.0f));
+    ASSERT_EQ(leaf.globalPosition(), glm::vec3(1.0f, 1.0f, 5.0f));
+    ASSERT_EQ(leaf.globalScale(), glm::vec3(6.0f, 6.0f, 6.0f));
+
+    root.setLocalRotation(glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+
+    auto position = leaf.globalPosition();
+
+    ASSERT_NEAR(position.x, -1.0f, 0.0001f);
+    ASSERT_NEAR(position.y, 1.0f, 0.0001f);
+    ASSERT_NEAR(position.z, 5.0f, 0.0001f);
+
+    auto matrix = leaf.localToWorldMatrix();
+
+    ASSERT_NEAR(matrix[3].x, -1.0f, 0.0001f);
+    ASSERT_NEAR(matrix[3].y, 1.0f, 0.0001f);
+    ASSERT_NEAR(matrix[3].z, 5.0f, 0.0001f);
+    ASSERT_NEAR(glm::length(glm::vec3(matrix[0])), 6.0f, 0.0001f);
+
+    // Detached child keeps it's global position
+    leaf.setParent(nullptr);
+    root.setLocalPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+
+    position = leaf.globalPosition();
+
+    ASSERT_NEAR(position.x, -1.0f, 0.0001f);
+    ASSERT_NEAR(position.y, 1.0f, 0.0001f);
+    ASSERT_NEAR(position.z, 5.0f, 0.0001f);
+
+    position = child.globalPosition();
+
+    ASSERT_NEAR(position.x, 0.0f, 0.0001f);
+    ASSERT_NEAR(position.y, 1.0f, 0.0001f);
+    ASSERT_NEAR(position.z, 0.0f, 0.0001f);
+}
+
+TEST(Core, TransformBulkRead)
+{
+    HG::Core::Transform root;
+    HG::Core::Transform first;
+    HG::Core::Transform second;
+
+    first.setParent(&root);
+    second.setParent(&root);
+
+    root.setLocalPosition(glm::vec3(0.0f, 0.0f, 5.0f));
+    first.setLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+    second.setLocalPosition(glm::vec3(0.0f, 2.0f, 0.0f));
+
+    std::vector<HG::Core::Transform*> transforms = {&first, &second, &root};
+
+    std::vector<glm::vec3> positions;
+    HG::Core::Transform::globalPositions(transforms, positions);
+
+    ASSERT_EQ(positions,
+              (std::vector<glm::vec3>{
+                  glm::vec3(1.0f, 0.0f, 5.0f), glm::vec3(0.0f, 2.0f, 5.0f), glm::vec3(0.0f, 0.0f, 5.0f)}));
+
+    HG::Core::Transform::localPositions(transforms, positions);
+
+    ASSERT_EQ(positions,
+              (std::vector<glm::vec3>{
+                  glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.0f, 0.0f, 5.0f)}));
+
+    // Bulk read sees changes of parent
+    root.setLocalPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+
+    std::vector<glm::mat4> matrices;
+    HG::Core::Transform::localToWorldMatrices(transforms, matrices);
+
+    ASSERT_EQ(matrices.size(), transforms.size());
+
+    for (std::size_t index = 0; index < transforms.size(); ++index)
+    {
+        ASSERT_EQ(matrices[index], transforms[index]->localToWorldMatrix());
+    }
+
+    ASSERT_EQ(glm::vec3(matrices[0][3]), glm::vec3(1.0f, 0.0f, 0.0f));
+}
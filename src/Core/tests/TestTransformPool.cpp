@@ -0,0 +1,134 @@
+// C++ STL
+#include <vector>
+
+// HG::Core
+#include <HG/Core/ResourceCache.hpp>
+#include <HG/Core/ThreadPool.hpp>
+#include <HG/Core/Transform.hpp>
+#include <HG/Core/TransformPool.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+TEST(Core, TransformPoolHierarchy)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::Transform external;
+    external.setLocalPosition(glm::vec3(0.0f, 0.0f, 10.0f));
+
+    // Children are created before parents to check sorting
+    std::vector<HG::Core::Transform*> transforms;
+
+    for (std::size_t index = 0; index < 4; ++index)
+    {
+        transforms.push_back(new (&cache) HG::Core::Transform);
+    }
+
+    HG::Core::TransformPool pool;
+
+    for (auto& transform : transforms)
+    {
+        pool.add(transform);
+    }
+
+    transforms[3]->setParent(&external);
+    transforms[2]->setParent(transforms[3]);
+    transforms[1]->setParent(transforms[2]);
+    transforms[0]->setParent(transforms[1]);
+
+    for (auto& transform : transforms)
+    {
+        transform->setLocalPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+        transform->setLocalScale(glm::vec3(2.0f, 2.0f, 2.0f));
+    }
+
+    pool.update();
+
+    ASSERT_EQ(pool.size(), 4);
+    ASSERT_EQ(pool.transforms().front(), transforms[3]);
+    ASSERT_EQ(pool.transforms().back(), transforms[0]);
+
+    // Values are calculated by pool
+    ASSERT_EQ(pool.localToWorldMatrices().back()[3], glm::vec4(4.0f, 0.0f, 10.0f, 1.0f));
+    ASSERT_EQ(transforms[0]->globalPosition(), glm::vec3(4.0f, 0.0f, 10.0f));
+    ASSERT_EQ(transforms[0]->globalScale(), glm::vec3(16.0f, 16.0f, 16.0f));
+
+    // Transform is handle to pool values
+    transforms[2]->setLocalPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+
+    ASSERT_EQ(transforms[0]->globalPosition(), glm::vec3(3.0f, 1.0f, 10.0f));
+    ASSERT_EQ(transforms[2]->localPosition(), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    external.setLocalPosition(glm::vec3());
+    pool.update();
+
+    ASSERT_EQ(pool.localToWorldMatrices().back()[3], glm::vec4(3.0f, 1.0f, 0.0f, 1.0f));
+
+    // Removed transform keeps values
+    pool.remove(transforms[1]);
+
+    ASSERT_EQ(pool.size(), 3);
+    ASSERT_EQ(transforms[1]->globalPosition(), glm::vec3(2.0f, 1.0f, 0.0f));
+
+    // Deleted transform is removed from pool
+    delete transforms[0];
+
+    ASSERT_EQ(pool.size(), 2);
+
+    pool.clear();
+
+    ASSERT_EQ(transforms[2]->localPosition(), glm::vec3(0.0f, 1.0f, 0.0f));
+    ASSERT_THROW(pool.setConcurrentChunkSize(0), std::invalid_argument);
+
+    for (std::size_t index = 1; index < transforms.size(); ++index)
+    {
+        delete transforms[index];
+    }
+}
+
+TEST(Core, TransformPoolConcurrentUpdate)
+{
+    HG::Core::ResourceCache cache;
+
+    HG::Core::ThreadPool threadPool;
+    threadPool.startPool(HG::Core::ThreadPool::Type::UserThread, 4);
+
+    HG::Core::Transform root;
+
+    HG::Core::TransformPool pool;
+    pool.setConcurrentChunkSize(16);
+    pool.add(&root);
+
+    std::vector<HG::Core::Transform*> children;
+
+    for (std::size_t index = 0; index < 1000; ++index)
+    {
+        auto* child = children.emplace_back(new (&cache) HG::Core::Transform);
+
+        pool.add(child);
+
+        child->setParent(&root);
+        child->setLocalPosition(glm::vec3(static_cast<float>(index), 0.0f, 0.0f));
+    }
+
+    for (std::size_t frame = 0; frame < 3; ++frame)
+    {
+        root.setLocalPosition(glm::vec3(static_cast<float>(frame), 0.0f, 0.0f));
+
+        pool.update(&threadPool);
+
+        ASSERT_EQ(pool.transforms().front(), &root);
+
+        for (std::size_t index = 1; index < pool.size(); ++index)
+        {
+            ASSERT_EQ(pool.localToWorldMatrices()[index][3].x,
+                      static_cast<float>(frame) + pool.transforms()[index]->localPosition().x);
+        }
+    }
+
+    for (auto* child : children)
+    {
+        delete child;
+    }
+}
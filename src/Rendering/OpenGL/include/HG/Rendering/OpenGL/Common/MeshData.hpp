@@ -1,5 +1,8 @@
 #pragma once
 
+// C++ STL
+#include <memory>
+
 // HG::Core
 #include <HG/Core/CachableResource.hpp>
 
@@ -24,5 +27,10 @@ public:
     gl::vertex_array VAO;
     gl::buffer VBO;
     gl::buffer EBO;
+
+    // Set while upload waits in main thread dispatcher.
+    // Job keeps weak reference to it, so it's skipped
+    // if data is deleted before.
+    std::shared_ptr<bool> PendingUpload;
 };
 } // namespace HG::Rendering::OpenGL::Common
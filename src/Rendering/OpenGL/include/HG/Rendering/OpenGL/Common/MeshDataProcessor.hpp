@@ -27,5 +27,14 @@ public:
     std::size_t getTarget() override;
 
     bool needSetup(HG::Rendering::Base::RenderData* data) override;
+
+private:
+    /**
+     * @brief Method for uploading mesh to GPU.
+     * Has to be called from main thread.
+     * @param data Mesh data.
+     * @param mesh Mesh.
+     */
+    static void upload(MeshData* data, const HG::Utils::Mesh* mesh);
 };
 } // namespace HG::Rendering::OpenGL::Common
@@ -1,5 +1,8 @@
 #pragma once
 
+// C++ STL
+#include <memory>
+
 // HG::Core
 #include <HG/Core/CachableResource.hpp>
 
@@ -25,5 +28,10 @@ public:
     gl::texture_2d Texture = gl::texture_2d(gl::invalid_id);
     bool Allocated         = false;
     glm::ivec2 Size        = {0, 0};
+
+    // Set while surface upload waits in main thread
+    // dispatcher. Job keeps weak reference to it, so
+    // it's skipped if data is deleted before.
+    std::shared_ptr<bool> PendingUpload;
 };
 } // namespace HG::Rendering::OpenGL::Common
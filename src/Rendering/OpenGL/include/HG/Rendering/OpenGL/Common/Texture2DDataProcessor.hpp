@@ -3,8 +3,13 @@
 // HG::Rendering::Base
 #include <HG/Rendering/Base/AbstractRenderDataProcessor.hpp>
 
+// HG::Utils
+#include <HG/Utils/Surface.hpp>
+
 namespace HG::Rendering::OpenGL::Common
 {
+class Texture2DData;
+
 /**
  * @brief Class, that describes 2d texture data processor
  */
@@ -16,5 +21,14 @@ public:
     size_t getTarget() override;
 
     bool needSetup(HG::Rendering::Base::RenderData* data) override;
+
+private:
+    /**
+     * @brief Method for loading surface into allocated
+     * texture. Has to be called from main thread.
+     * @param data Texture data.
+     * @param surface Surface.
+     */
+    void upload(Texture2DData* data, const HG::Utils::SurfacePtr& surface);
 };
 } // namespace HG::Rendering::OpenGL::Common
@@ -1,5 +1,6 @@
 // HG::Core
 #include <HG/Core/Application.hpp>
+#include <HG/Core/MainThreadDispatcher.hpp>
 
 // HG::Rendering::OpenGL
 #include <HG/Rendering/OpenGL/Common/MeshData.hpp>
@@ -38,6 +39,46 @@ bool MeshDataProcessor::setup(HG::Rendering::Base::RenderData* renderData, bool
         meshBehaviour->setSpecificData(data);
     }
 
+    // Uploading is spread over frames by dispatcher
+    auto dispatcher = application()->mainThreadDispatcher();
+
+    if (guarantee || dispatcher == nullptr)
+    {
+        upload(data, meshBehaviour->mesh().get());
+        return true;
+    }
+
+    if (data->PendingUpload != nullptr)
+    {
+        return false;
+    }
+
+    data->PendingUpload = std::make_shared<bool>(true);
+
+    dispatcher->push([meshBehaviour, pending = std::weak_ptr<bool>(data->PendingUpload)]() {
+        // Mesh was deleted before upload
+        if (pending.expired())
+        {
+            return;
+        }
+
+        auto data = meshBehaviour->castSpecificDataTo<MeshData>();
+
+        data->PendingUpload = nullptr;
+
+        if (meshBehaviour->mesh() == nullptr)
+        {
+            return;
+        }
+
+        upload(data, meshBehaviour->mesh().get());
+    });
+
+    return false;
+}
+
+void MeshDataProcessor::upload(MeshData* data, const HG::Utils::Mesh* mesh)
+{
     if (data->VAO.id() == gl::invalid_id)
     {
         data->VAO = std::move(gl::vertex_array());
@@ -59,8 +100,6 @@ bool MeshDataProcessor::setup(HG::Rendering::Base::RenderData* renderData, bool
     // Binding vertex buffer object
     data->VBO.bind(GL_ARRAY_BUFFER);
 
-    auto mesh = meshBehaviour->mesh();
-
     // Loading data into VBO
     data->VBO.set_data(mesh->Vertices.size() * sizeof(HG::Utils::Vertex), mesh->Vertices.data());
 
@@ -91,8 +130,6 @@ bool MeshDataProcessor::setup(HG::Rendering::Base::RenderData* renderData, bool
 
     data->Valid = true;
     data->Count = static_cast<std::uint32_t>(mesh->Indices.size());
-
-    return true;
 }
 
 std::size_t MeshDataProcessor::getTarget()
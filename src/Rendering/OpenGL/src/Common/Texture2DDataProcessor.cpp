@@ -1,6 +1,7 @@
 // HG::Core
 #include <HG/Core/Application.hpp>
 #include <HG/Core/Benchmark.hpp>
+#include <HG/Core/MainThreadDispatcher.hpp>
 
 // HG::Rendering::Base
 #include <HG/Rendering/Base/Texture.hpp>
@@ -116,43 +117,37 @@ bool Texture2DDataProcessor::setup(HG::Rendering::Base::RenderData* data, bool g
 
     if (externalData->Allocated && surface && !externalData->Valid)
     {
-        BENCH("Loading surface to texture");
-        externalData->Valid = true;
-        GLuint fileFormat   = GL_RGBA;
+        // Uploading is spread over frames by dispatcher
+        auto dispatcher = application()->mainThreadDispatcher();
 
-        // Getting type
-        switch (surface->Bpp)
+        if (guarantee || dispatcher == nullptr)
         {
-        case 1:
-            fileFormat = GL_RED;
-            break;
+            upload(externalData, surface);
+        }
+        else if (externalData->PendingUpload == nullptr)
+        {
+            externalData->PendingUpload = std::make_shared<bool>(true);
 
-        case 2:
-            fileFormat = GL_RG;
-            break;
+            dispatcher->push([this, texture, pending = std::weak_ptr<bool>(externalData->PendingUpload)]() {
+                // Texture was deleted before upload
+                if (pending.expired())
+                {
+                    return;
+                }
 
-        case 3:
-            fileFormat = GL_RGB;
-            break;
+                auto data = texture->castSpecificDataTo<Texture2DData>();
 
-        case 4:
-            fileFormat = GL_RGBA;
-            break;
+                data->PendingUpload = nullptr;
 
-        default:
-            HGError("Can't setup texture because of unknown texture format");
-            break;
-        }
+                auto surface = texture->surface(false);
 
-        // Loading data into texture
-        externalData->Texture.set_sub_image(0,                // Level
-                                            0,                // X offset
-                                            0,                // Y Offset
-                                            surface->Width,   // Width
-                                            surface->Height,  // Height
-                                            fileFormat,       // Format
-                                            GL_UNSIGNED_BYTE, // Type
-                                            surface->Data);
+                // Storage may be reallocated in meantime
+                if (data->Allocated && surface && !data->Valid)
+                {
+                    upload(data, surface);
+                }
+            });
+        }
     }
 
     externalData->Texture.unbind();
@@ -169,6 +164,47 @@ bool Texture2DDataProcessor::needSetup(HG::Rendering::Base::RenderData* data)
            externalData->Size != texture->size() || !externalData->Valid;
 }
 
+void Texture2DDataProcessor::upload(Texture2DData* data, const HG::Utils::SurfacePtr& surface)
+{
+    BENCH("Loading surface to texture");
+    data->Valid       = true;
+    GLuint fileFormat = GL_RGBA;
+
+    // Getting type
+    switch (surface->Bpp)
+    {
+    case 1:
+        fileFormat = GL_RED;
+        break;
+
+    case 2:
+        fileFormat = GL_RG;
+        break;
+
+    case 3:
+        fileFormat = GL_RGB;
+        break;
+
+    case 4:
+        fileFormat = GL_RGBA;
+        break;
+
+    default:
+        HGError("Can't setup texture because of unknown texture format");
+        break;
+    }
+
+    // Loading data into texture
+    data->Texture.set_sub_image(0,                // Level
+                                0,                // X offset
+                                0,                // Y Offset
+                                surface->Width,   // Width
+                                surface->Height,  // Height
+                                fileFormat,       // Format
+                                GL_UNSIGNED_BYTE, // Type
+                                surface->Data);
+}
+
 size_t Texture2DDataProcessor::getTarget()
 {
     return HG::Rendering::Base::Texture::DataId;
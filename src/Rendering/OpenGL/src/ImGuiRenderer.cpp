@@ -255,7 +255,7 @@ void ImGuiRenderer::createFontsTexture()
 
     if (application()->renderer()->needSetup(m_fontTexture))
     {
-        if (application()->renderer()->setup(m_fontTexture))
+        if (application()->renderer()->setup(m_fontTexture, true))
         {
             // Store our identifier
             io.Fonts->TexID = m_fontTexture;
@@ -217,37 +217,37 @@ void DebugControllerOverlay::displayPropertyWidget(const HG::Core::Behaviour::Pr
 {
     if (property.typeInfo() == typeid(float))
     {
-        auto v = property.getGetter<float>()();
+        auto v = property.get<float>();
 
         ImGui::InputFloat(property.name().c_str(), &v);
 
-        property.getSetter<float>()(v);
+        property.set<float>(v);
     }
     else if (property.typeInfo() == typeid(glm::vec2))
     {
-        auto v = property.getGetter<glm::vec2>()();
+        auto v = property.get<glm::vec2>();
 
         ImGui::InputFloat2(property.name().c_str(), reinterpret_cast<float*>(&v));
 
-        property.getSetter<glm::vec2>()(v);
+        property.set<glm::vec2>(v);
     }
     else if (property.typeInfo() == typeid(HG::Utils::Color))
     {
-        auto color = property.getGetter<HG::Utils::Color>()();
+        auto color = property.get<HG::Utils::Color>();
 
         ImGui::ColorEdit3(property.name().c_str(), reinterpret_cast<float*>(&color));
 
-        property.getSetter<HG::Utils::Color>()(color);
+        property.set<HG::Utils::Color>(color);
     }
     else if (property.typeInfo() == typeid(HG::Rendering::Base::Camera::Projection))
     {
-        int proj = static_cast<int>(property.getGetter<HG::Rendering::Base::Camera::Projection>()());
+        int proj = static_cast<int>(property.get<HG::Rendering::Base::Camera::Projection>());
 
         const char* items[] = {"Perspective", "Orthogonal"};
 
         ImGui::Combo(property.name().c_str(), &proj, items, 2);
 
-        property.getSetter<HG::Rendering::Base::Camera::Projection>()(
+        property.set<HG::Rendering::Base::Camera::Projection>(
             static_cast<HG::Rendering::Base::Camera::Projection>(proj));
     }
     else
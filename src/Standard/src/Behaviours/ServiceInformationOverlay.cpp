@@ -70,8 +70,32 @@ void ServiceInformationOverlay::onUpdate()
             totalRam / 1000.0f / 1000.0f,
             HG::Utils::PhysicalResource::getProcessRAMUsed() / 1000.0f / 1000.0f);
 
-        ImGui::Text("Resource queue: %ld",
-                    scene()->application()->threadPool()->numberOfJobs(HG::Core::ThreadPool::Type::FileLoadingThread));
+        auto resourceManager = scene()->application()->resourceManager();
+
+        ImGui::Text("Resource queue: %ld\n"
+                    "    Reading:  %zu active, %zu queued\n"
+                    "    Decoding: %zu active, %zu queued\n",
+                    scene()->application()->threadPool()->numberOfJobs(HG::Core::ThreadPool::Type::FileLoadingThread),
+                    resourceManager->numberOfActiveJobs(HG::Core::ResourceManager::Stage::Reading),
+                    resourceManager->numberOfQueuedJobs(HG::Core::ResourceManager::Stage::Reading),
+                    resourceManager->numberOfActiveJobs(HG::Core::ResourceManager::Stage::Decoding),
+                    resourceManager->numberOfQueuedJobs(HG::Core::ResourceManager::Stage::Decoding));
+
+        auto assetCache = resourceManager->assetCache();
+
+        ImGui::Text("Asset cache: %zu hits, %zu joined, %zu misses, %zu evictions\n"
+                    "Retained assets: %.1fMB / %.1fMB\n",
+                    assetCache->numberOfHits(),
+                    assetCache->numberOfCoalesced(),
+                    assetCache->numberOfMisses(),
+                    assetCache->numberOfEvictions(),
+                    assetCache->retainedSize() / 1000.0f / 1000.0f,
+                    assetCache->budget() / 1000.0f / 1000.0f);
+
+        ImGui::Text("Main thread jobs: %llu (%llu pending), %f ms\n",
+                    countStat->value(HG::Core::CountStatistics::CommonCounter::DispatchedJobs),
+                    countStat->value(HG::Core::CountStatistics::CommonCounter::PendingDispatchJobs),
+                    timeStat->dispatchTime().count() / 1000.0f);
 
         // Counters
         ImGui::Text("Vertices: %llu\n", countStat->value(HG::Core::CountStatistics::CommonCounter::NumberOfVertices));
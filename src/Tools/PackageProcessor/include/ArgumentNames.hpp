@@ -9,4 +9,6 @@ constexpr const char* Name         = "name";
 constexpr const char* MajorVersion = "versionMajor";
 constexpr const char* MinorVersion = "versionMinor";
 constexpr const char* Output       = "output";
+constexpr const char* Jobs         = "jobs";
+constexpr const char* Cache        = "cache";
 } // namespace ArgumentsNames
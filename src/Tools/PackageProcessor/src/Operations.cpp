@@ -1,6 +1,8 @@
 // C++ STL
+#include <algorithm>
 #include <functional>
 #include <iostream>
+#include <thread>
 
 // HG::PackageProcessor
 #include <ArgumentNames.hpp>
@@ -32,6 +34,28 @@ void addFiles(HG::Tools::PackageProcessor& packageProcessor,
     }
 }
 
+void setupJobs(HG::Tools::PackageProcessor& packageProcessor,
+               const HG::ToolsCore::CommandLineArguments::ArgumentsMap& args)
+{
+    std::size_t jobs = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (args.count(ArgumentsNames::Jobs))
+    {
+        auto jobsArg = std::get<int>(args.at(ArgumentsNames::Jobs));
+
+        if (jobsArg <= 0)
+        {
+            throw std::invalid_argument("Number of jobs has to be positive");
+        }
+
+        jobs = static_cast<std::size_t>(jobsArg);
+    }
+
+    std::cout << "Jobs: " << jobs << std::endl;
+
+    packageProcessor.setNumberOfJobs(jobs);
+}
+
 void Operations::pack(const HG::ToolsCore::CommandLineArguments::ArgumentsMap& args)
 {
     HG::Tools::PackageProcessor packageProcessor;
@@ -87,7 +111,22 @@ void Operations::pack(const HG::ToolsCore::CommandLineArguments::ArgumentsMap& a
     packageProcessor.setPackageRoot(rootPath);
     addFiles(packageProcessor, path, path);
 
+    setupJobs(packageProcessor, args);
+
+    // Previous package is used as build cache
+    const auto cacheArg =
+        args.count(ArgumentsNames::Cache) ? std::get<std::string>(args.at(ArgumentsNames::Cache)) : outputArg;
+
+    std::cout << "Build cache: " << cacheArg << std::endl;
+    packageProcessor.setBuildCache(cacheArg);
+
     packageProcessor.write(outputArg);
+
+    const auto& statistics = packageProcessor.statistics();
+
+    std::cout << "Reused: " << statistics.reusedBytes << " bytes" << std::endl;
+    std::cout << "Recompressed: " << statistics.recompressedBytes << " bytes" << std::endl;
+    std::cout << "Deduplicated: " << statistics.deduplicatedBytes << " bytes" << std::endl;
 }
 
 void Operations::unpack(const HG::ToolsCore::CommandLineArguments::ArgumentsMap& args)
@@ -106,6 +145,8 @@ void Operations::unpack(const HG::ToolsCore::CommandLineArguments::ArgumentsMap&
 
     packageProcessor.load(pathArg);
 
+    setupJobs(packageProcessor, args);
+
     packageProcessor.unpack(outputArg);
 }
 
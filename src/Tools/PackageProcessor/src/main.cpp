@@ -77,6 +77,19 @@ int main(int argc, char** argv)
         .type(HG::ToolsCore::CommandLineArguments::Type::Integer)
         .destination(ArgumentsNames::MinorVersion);
 
+    arguments.addArgument({"-j", "--jobs"})
+        .help("number of threads for `pack` and `unpack` operations. number of cores by default")
+        .numberOfArguments(1)
+        .required(false)
+        .type(HG::ToolsCore::CommandLineArguments::Type::Integer)
+        .destination(ArgumentsNames::Jobs);
+
+    arguments.addArgument({"-b", "--build-cache"})
+        .help("path to previous package for `pack` operation, which compressed data is reused. output by default")
+        .numberOfArguments(1)
+        .required(false)
+        .destination(ArgumentsNames::Cache);
+
     auto args = arguments.parse(argc, argv);
 
     try
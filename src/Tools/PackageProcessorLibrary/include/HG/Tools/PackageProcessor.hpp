@@ -2,6 +2,9 @@
 
 // C++ STL
 #include <filesystem>
+#include <istream>
+#include <ostream>
+#include <vector>
 
 // ByteArray
 #include <bytearray.hpp>
@@ -57,6 +60,7 @@ namespace HG::Tools
  * | 0x0000002 | string   |  Required   | Package author.                                       |
  * | 0x0000003 | uint32_t |  Required   | Package major version.                                |
  * | 0x0000004 | uint32_t |  Required   | Package minor version.                                |
+ * | 0x0000005 | hashes   |  Optional   | Content hashes of files. Version 2 only.              |
  * 
  * File structure field format (each field aligned by 16 bytes):
  * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
@@ -89,11 +93,107 @@ namespace HG::Tools
  * | uint32_t | unsigned int, little endian       |
  * | uint64_t | unsigned int 64bit, little endian |
  * | string   | utf-8                             |
+ *
+ * Package format version 2:
+ * Version 1 requires validating CRC32 of whole package
+ * and inflating whole entry to read any part of it.
+ * Version 2 keeps metadata fields and file structure
+ * fields layout, but places them into directory at the
+ * end of package, that's read with single read. Every
+ * file is compressed with independent fixed size blocks,
+ * so any block can be read without reading previous ones.
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * | 0xDE| 0xC0| 0xDE| 0x00|    Directory CRC32    |                   File size                   |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |        Version        | Metadata fields count | File struct fields cnt|      Block size       |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                Directory offset               |                 Directory size                |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                                         Compressed blocks...                                  |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                                         Metadata fields...                                    |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                                          File structure...                                    |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ *
+ * Description:
+ * [ 0 -  3] - magic bytes 0xdec0de00
+ * [ 4 -  7] - directory crc32 (metadata fields and file structure)
+ * [ 8 - 15] - total package size (uint64_t)
+ * [16 - 19] - package packer version (uint32_t, 2)
+ * [20 - 23] - amount of metadata fields (uint32_t)
+ * [24 - 27] - amount of file structure fields (uint32_t)
+ * [28 - 31] - size of uncompressed block (uint32_t)
+ * [32 - 39] - global offset to directory (uint64_t)
+ * [40 - 47] - directory size (uint64_t)
+ *
+ * File structure field format (each field aligned by 16 bytes):
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * | Type|    Reserved     |           ID          |       Parent ID       |      Name length      |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |               Compressed data offset          |             Compressed data length            |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                 Uncompressed size             |         CRC32         |   Number of blocks    |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                                             Name...                                           |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |                                            Blocks...                                          |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ *
+ * Description:
+ * [ 0 - 31] - same as in version 1
+ * [32 - 39] - size of uncompressed data (uint64_t)
+ * [40 - 43] - crc32 of uncompressed data (uint32_t)
+ * [44 - 47] - number of blocks (uint32_t)
+ * [48 - ..] - entry name (string, utf-8)
+ * [.. - ..] - blocks table. aligned by 16 bytes.
+ *
+ * Block format:
+ * Blocks are placed one by one, starting from compressed
+ * data offset. Every block is independent zlib stream.
+ * If compressed block size is equal to uncompressed
+ * block size - block is stored without compression.
+ * #-----#-----#-----#-----#-----#-----#-----#-----#
+ * |    Compressed size    |         CRC32         |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#
+ *
+ * Description:
+ * [ 0 -  3] - size of compressed block (uint32_t)
+ * [ 4 -  7] - crc32 of uncompressed block (uint32_t)
+ *
+ * Version 2 packages may contain optional metadata field
+ * 0x0000005 with content hashes of files. Hashes are used
+ * to find files with same content for deduplication and
+ * for reusing compressed data of previous package.
+ * Value of field is sequence of records:
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ * |           ID          |       Reserved        |                 Content hash                  |
+ * #-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#-----#
+ *
+ * Description:
+ * [ 0 -  3] - file entry id (uint32_t)
+ * [ 4 -  7] - reserved for future use
+ * [ 8 - 15] - 64bit FNV-1a hash of uncompressed data (uint64_t)
+ *
+ * Several file entries may point to same compressed
+ * data, if their content is same.
  */
 class PackageProcessor
 {
 private:
 public:
+    /**
+     * @brief Structure, that describes amount
+     * of uncompressed data, that was processed by
+     * last `PackageProcessor::write` call.
+     */
+    struct Statistics
+    {
+        std::size_t reusedBytes       = 0; ///< Copied from opened package or build cache
+        std::size_t recompressedBytes = 0; ///< Compressed again
+        std::size_t deduplicatedBytes = 0; ///< Same content is already written
+    };
+
     /**
      * @brief Structure, that describes
      * package metadata.
@@ -124,12 +224,36 @@ public:
             Package
         };
 
+        /**
+         * @brief Structure, that describes compressed
+         * block of file in version 2 package.
+         */
+        struct Block
+        {
+            std::size_t offset           = 0; ///< Global offset
+            std::uint32_t compressedSize = 0;
+            std::uint32_t crc            = 0; ///< CRC32 of uncompressed block
+        };
+
         /**
          * @brief Constructor, that's used by PackageProcessor
          * at file loaded from package.
          */
         File(std::filesystem::path path, Type type, std::size_t offset = 0, std::size_t size = 0);
 
+        /**
+         * @brief Constructor, that's used by PackageProcessor
+         * at file loaded from version 2 package.
+         */
+        File(std::filesystem::path path,
+             std::size_t offset,
+             std::size_t compressedSize,
+             std::size_t size,
+             std::uint32_t crc,
+             std::size_t blockSize,
+             std::vector<Block> blocks,
+             std::uint64_t contentHash = 0);
+
         /**
          * @brief Method for getting type of file.
          * Filesystem or package located.
@@ -163,11 +287,53 @@ public:
          */
         [[nodiscard]] std::size_t compressedSize() const;
 
+        /**
+         * @brief Method for getting size of uncompressed
+         * data. Version 1 packages does not contain this
+         * value, so 0 is returned for them.
+         * @return Size in bytes.
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /**
+         * @brief Method for getting CRC32 of uncompressed
+         * data. 0 for version 1 packages.
+         * @return CRC32.
+         */
+        [[nodiscard]] std::uint32_t crc() const;
+
+        /**
+         * @brief Method for getting size of uncompressed
+         * block. 0 is returned if file is stored as single
+         * zlib stream (version 1 packages).
+         * @return Size in bytes.
+         */
+        [[nodiscard]] std::size_t blockSize() const;
+
+        /**
+         * @brief Method for getting compressed blocks.
+         * @return Constant reference to vector with blocks.
+         */
+        [[nodiscard]] const std::vector<Block>& blocks() const;
+
+        /**
+         * @brief Method for getting hash of uncompressed
+         * data. 0 is returned, if package does not
+         * contain hash of this file.
+         * @return 64bit FNV-1a hash.
+         */
+        [[nodiscard]] std::uint64_t contentHash() const;
+
     private:
-        Type m_type;
         std::filesystem::path m_path;
+        Type m_type;
         std::size_t m_compressedOffset;
         std::size_t m_compressedSize;
+        std::size_t m_size;
+        std::uint32_t m_crc;
+        std::size_t m_blockSize;
+        std::vector<Block> m_blocks;
+        std::uint64_t m_contentHash;
     };
 
     /**
@@ -199,7 +365,45 @@ public:
     void load(std::filesystem::path path);
 
     /**
-     * @brief Method for writing new package 
+     * @brief Method for setting number of threads, that
+     * are used for compressing and inflating. Written
+     * package does not depend on number of threads.
+     * `std::invalid_argument` exception will be thrown
+     * if number of jobs is 0.
+     * @param numberOfJobs Number of threads. 1 by default.
+     */
+    void setNumberOfJobs(std::size_t numberOfJobs);
+
+    /**
+     * @brief Method for getting number of threads, that
+     * are used for compressing and inflating.
+     * @return Number of threads.
+     */
+    [[nodiscard]] std::size_t numberOfJobs() const;
+
+    /**
+     * @brief Method for setting previously built package,
+     * which compressed data will be reused by `write` for
+     * files with same content. It can be same as path of
+     * written package. If package does not exist or can't
+     * be loaded - it's ignored.
+     * @param path Path to package or empty path to
+     * disable build cache.
+     */
+    void setBuildCache(std::filesystem::path path);
+
+    /**
+     * @brief Method for getting statistics
+     * of last `write` call.
+     * @return Constant reference to statistics.
+     */
+    [[nodiscard]] const Statistics& statistics() const;
+
+    /**
+     * @brief Method for writing new package.
+     * Package is always written with latest format
+     * version. Blocks are compressed by several threads
+     * (see `setNumberOfJobs`), but written in files order.
      * @param path Path to package.
      */
     void write(std::filesystem::path path);
@@ -208,7 +412,8 @@ public:
      * @brief Method for unpacking loaded
      * package to filesystem. If no package was
      * loaded - `std::runtime_error` exception
-     * will be thrown.
+     * will be thrown. Files are inflated by several
+     * threads (see `setNumberOfJobs`).
      * @param path
      */
     void unpack(std::filesystem::path path);
@@ -248,12 +453,56 @@ public:
     [[nodiscard]] const std::vector<File>& files() const;
 
 private:
+    /**
+     * @brief Structure, that describes written
+     * file data.
+     */
+    struct WrittenData
+    {
+        std::size_t offset         = 0;
+        std::size_t compressedSize = 0;
+        std::size_t size           = 0;
+        std::uint32_t crc          = 0;
+        std::uint64_t hash         = 0;
+        std::vector<File::Block> blocks;
+    };
+
+    /**
+     * @brief Structure, that describes state of
+     * package writing. Defined in source file.
+     */
+    struct BuildContext;
+
+    void loadVersion1(std::ifstream& file, bytearray<>& buffer);
+
+    void loadVersion2(std::ifstream& file, bytearray<>& buffer);
+
+    void readMetadataValue(std::uint32_t type, const bytearray<>& buffer, std::size_t offset, std::uint32_t length);
+
     void internalUnpack(std::ifstream& stream, std::filesystem::path destination, const File& file);
 
-    void
-    writeFilesystemFile(std::ofstream& to, const std::filesystem::path& path, std::size_t& offset, std::size_t& size);
+    void unpackBlocks(std::ifstream& stream, std::ostream& output, const File& file);
 
-    void writePackageFile(std::ofstream& to, std::ifstream& basePackageFile, std::size_t& offset, std::size_t& size);
+    /**
+     * @brief Class, that compresses blocks with several
+     * threads and writes them in order of pushing.
+     */
+    class BlockWriter;
+
+    void loadBuildCache(BuildContext& context);
+
+    void writeStream(BuildContext& context, std::istream& from, WrittenData& data);
+
+    void writePackageFile(BuildContext& context, const File& file, WrittenData& data);
+
+    /**
+     * @brief Method for checking control sums of
+     * file blocks before they are copied.
+     * @return Are all blocks valid.
+     */
+    bool validateBlocks(std::ifstream& from, const File& file);
+
+    void copyBlocks(BuildContext& context, std::ifstream& from, const File& file, WrittenData& data);
 
     std::uint32_t calculateStreamCRC(std::ifstream& fl);
 
@@ -266,5 +515,11 @@ private:
     Metadata m_metadata;
 
     std::vector<File> m_entries;
+
+    std::size_t m_numberOfJobs;
+
+    std::filesystem::path m_pathToBuildCache;
+
+    Statistics m_statistics;
 };
 } // namespace HG::Tools
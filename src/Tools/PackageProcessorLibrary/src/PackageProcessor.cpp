@@ -1,6 +1,16 @@
 // C++ STL
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include <unordered_map>
 
 // HG::Tools
@@ -15,18 +25,25 @@
 
 // HG::Utils
 constexpr const std::uint32_t PACKAGE_MAGIC        = 0xDEC0DE00;
-constexpr const std::size_t HEADER_SIZE            = 32; // bytes
-constexpr const std::size_t METADATA_HEADER_SIZE   = 8;  // bytes
-constexpr const std::size_t FILE_ENTRY_HEADER_SIZE = 32; // bytes
+constexpr const std::size_t HEADER_SIZE               = 32; // bytes
+constexpr const std::size_t HEADER_SIZE_V2            = 48; // bytes
+constexpr const std::size_t METADATA_HEADER_SIZE      = 8;  // bytes
+constexpr const std::size_t FILE_ENTRY_HEADER_SIZE    = 32; // bytes
+constexpr const std::size_t FILE_ENTRY_HEADER_SIZE_V2 = 48; // bytes
+constexpr const std::size_t BLOCK_ENTRY_SIZE          = 8;  // bytes
+constexpr const std::size_t BLOCK_SIZE                = 64 * 1024;
+constexpr const std::size_t BLOCK_WINDOW_PER_JOB      = 4;
 constexpr const std::size_t CRC_BUFFER_SIZE        = 64 * 1024;
 constexpr const std::size_t CRC_BEGIN_COUNT_POS    = 8;
 constexpr const std::size_t ALIGNMENT              = 16;
-constexpr const std::size_t DEFLATE_CHUNK_SIZE     = CRC_BUFFER_SIZE;
 constexpr const std::size_t COPY_CHUNK_SIZE        = CRC_BUFFER_SIZE;
 constexpr const std::size_t INFLATE_CHUNK_SIZE     = CRC_BUFFER_SIZE;
 
-constexpr const std::uint32_t PACKER_VERSION            = 1;
-constexpr const std::uint32_t AMOUNT_OF_METADATA_FIELDS = 4;
+constexpr const std::uint32_t PACKER_VERSION            = 2;
+constexpr const std::uint32_t AMOUNT_OF_METADATA_FIELDS = 5;
+constexpr const std::size_t CONTENT_HASH_RECORD_SIZE    = 16; // bytes
+constexpr const std::uint64_t FNV_OFFSET_BASIS          = 0xCBF29CE484222325;
+constexpr const std::uint64_t FNV_PRIME                 = 0x100000001B3;
 
 template <typename T>
 T align(T val, T alignment)
@@ -40,6 +57,7 @@ constexpr const std::uint32_t Name   = 0x00000001;
 constexpr const std::uint32_t Author = 0x00000002;
 constexpr const std::uint32_t Major  = 0x00000003;
 constexpr const std::uint32_t Minor  = 0x00000004;
+constexpr const std::uint32_t Hashes = 0x00000005;
 } // namespace MetadataCodes
 
 namespace FileEntryTypes
@@ -48,10 +66,375 @@ constexpr const std::uint32_t Directory = 0x00000001;
 constexpr const std::uint32_t File      = 0x00000002;
 } // namespace FileEntryTypes
 
+namespace
+{
+/**
+ * @brief Structure, that identifies file content.
+ */
+struct ContentKey
+{
+    std::uint64_t size;
+    std::uint32_t crc;
+    std::uint64_t hash;
+
+    bool operator==(const ContentKey& rhs) const
+    {
+        return size == rhs.size && crc == rhs.crc && hash == rhs.hash;
+    }
+};
+
+struct ContentKeyHash
+{
+    std::size_t operator()(const ContentKey& key) const
+    {
+        return static_cast<std::size_t>(key.hash);
+    }
+};
+
+/**
+ * @brief Function for calculating content key
+ * of stream. Stream is rewound after reading.
+ */
+ContentKey hashStream(std::istream& stream)
+{
+    ContentKey key = {0, static_cast<std::uint32_t>(crc32(0L, nullptr, 0)), FNV_OFFSET_BASIS};
+
+    std::vector<char> buffer(BLOCK_SIZE);
+
+    while (true)
+    {
+        stream.read(buffer.data(), buffer.size());
+
+        auto read = static_cast<std::size_t>(stream.gcount());
+
+        if (read == 0)
+        {
+            break;
+        }
+
+        key.crc = static_cast<std::uint32_t>(
+            crc32(key.crc, reinterpret_cast<const Bytef*>(buffer.data()), static_cast<uInt>(read)));
+
+        for (std::size_t index = 0; index < read; ++index)
+        {
+            key.hash = (key.hash ^ static_cast<std::uint8_t>(buffer[index])) * FNV_PRIME;
+        }
+
+        key.size += read;
+    }
+
+    if (stream.bad())
+    {
+        throw std::runtime_error("Can't read data for hashing");
+    }
+
+    stream.clear();
+    stream.seekg(0, std::ios::beg);
+
+    return key;
+}
+} // namespace
+
 namespace HG::Tools
 {
-PackageProcessor::PackageProcessor() : m_pathToOpenedPackage(), m_metadata(), m_entries()
+class PackageProcessor::BlockWriter
 {
+public:
+    BlockWriter(std::ofstream& to, std::size_t numberOfJobs) :
+        m_to(to),
+        m_limit(numberOfJobs * BLOCK_WINDOW_PER_JOB),
+        m_window(),
+        m_workers(),
+        m_mutex(),
+        m_notifier(),
+        m_tasks(),
+        m_running(true)
+    {
+        // Blocks are compressed in caller thread,
+        // if there is only one job
+        if (numberOfJobs < 2)
+        {
+            return;
+        }
+
+        for (std::size_t index = 0; index < numberOfJobs; ++index)
+        {
+            m_workers.emplace_back(&BlockWriter::workerFunction, this);
+        }
+    }
+
+    ~BlockWriter()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+
+        m_notifier.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Method for splitting stream into blocks and
+     * queueing them for compression. `data` is filled,
+     * when blocks are written.
+     */
+    void write(std::istream& from, WrittenData& data)
+    {
+        // Marker of file beginning
+        m_window.push_back({&data, false, {}});
+
+        while (true)
+        {
+            std::vector<Bytef> input(BLOCK_SIZE);
+
+            from.read(reinterpret_cast<char*>(input.data()), BLOCK_SIZE);
+
+            auto read = static_cast<std::size_t>(from.gcount());
+
+            if (read == 0)
+            {
+                break;
+            }
+
+            input.resize(read);
+
+            m_window.push_back({&data, true, schedule(std::move(input))});
+
+            while (m_window.size() > m_limit)
+            {
+                writeFront();
+            }
+        }
+
+        if (from.bad())
+        {
+            throw std::runtime_error("Can't read data for deflating");
+        }
+    }
+
+    /**
+     * @brief Method for writing all queued blocks.
+     */
+    void flush()
+    {
+        while (!m_window.empty())
+        {
+            writeFront();
+        }
+    }
+
+private:
+    struct CompressedBlock
+    {
+        std::vector<Bytef> data;
+        std::uint32_t size;
+        std::uint32_t crc;
+    };
+
+    struct Item
+    {
+        WrittenData* data;
+        bool isBlock;
+        std::future<CompressedBlock> block;
+    };
+
+    static CompressedBlock compress(std::vector<Bytef> input)
+    {
+        CompressedBlock result;
+        result.size = static_cast<std::uint32_t>(input.size());
+        result.crc  = static_cast<std::uint32_t>(
+            crc32(crc32(0L, nullptr, 0), input.data(), static_cast<uInt>(input.size())));
+
+        result.data.resize(compressBound(input.size()));
+
+        auto compressedSize = static_cast<uLongf>(result.data.size());
+
+        if (compress2(result.data.data(), &compressedSize, input.data(), input.size(), Z_BEST_COMPRESSION) != Z_OK)
+        {
+            throw std::runtime_error("Can't deflate block");
+        }
+
+        // Storing block without compression, if
+        // compression does not help
+        if (compressedSize >= input.size())
+        {
+            result.data = std::move(input);
+        }
+        else
+        {
+            result.data.resize(compressedSize);
+        }
+
+        return result;
+    }
+
+    std::future<CompressedBlock> schedule(std::vector<Bytef> input)
+    {
+        std::packaged_task<CompressedBlock()> task(
+            [input = std::move(input)]() mutable { return compress(std::move(input)); });
+
+        auto result = task.get_future();
+
+        if (m_workers.empty())
+        {
+            task();
+            return result;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+
+        m_notifier.notify_one();
+
+        return result;
+    }
+
+    void writeFront()
+    {
+        auto item = std::move(m_window.front());
+        m_window.pop_front();
+
+        auto& data = *item.data;
+
+        if (!item.isBlock)
+        {
+            data.offset         = static_cast<std::size_t>(m_to.tellp());
+            data.compressedSize = 0;
+            data.size           = 0;
+            data.crc            = crc32(0L, nullptr, 0);
+            data.blocks.clear();
+            return;
+        }
+
+        // Rethrows compression error
+        auto compressed = item.block.get();
+
+        File::Block block;
+        block.offset         = data.offset + data.compressedSize;
+        block.compressedSize = static_cast<std::uint32_t>(compressed.data.size());
+        block.crc            = compressed.crc;
+
+        m_to.write(reinterpret_cast<const char*>(compressed.data.data()), compressed.data.size());
+
+        data.crc = crc32_combine(data.crc, block.crc, static_cast<z_off_t>(compressed.size));
+        data.size += compressed.size;
+        data.compressedSize += block.compressedSize;
+        data.blocks.push_back(block);
+    }
+
+    void workerFunction()
+    {
+        while (true)
+        {
+            std::packaged_task<CompressedBlock()> task;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                m_notifier.wait(lock, [this]() { return !m_running || !m_tasks.empty(); });
+
+                if (!m_running)
+                {
+                    return;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    std::ofstream& m_to;
+
+    // Maximum number of blocks in memory
+    std::size_t m_limit;
+
+    // Files and blocks in order of writing
+    std::deque<Item> m_window;
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_notifier;
+    std::deque<std::packaged_task<CompressedBlock()>> m_tasks;
+    bool m_running;
+};
+
+struct PackageProcessor::BuildContext
+{
+    BuildContext(std::ofstream& stream, std::size_t numberOfJobs) :
+        to(stream),
+        writer(stream, numberOfJobs),
+        basePackageFile(),
+        cacheFile(),
+        cachedFiles(),
+        writtenFiles(),
+        duplicates()
+    {
+    }
+
+    std::ofstream& to;
+
+    BlockWriter writer;
+
+    // Opened package
+    std::ifstream basePackageFile;
+
+    // Previously built package
+    std::ifstream cacheFile;
+    std::unordered_map<ContentKey, File, ContentKeyHash> cachedFiles;
+
+    // First written file with every content
+    std::unordered_map<ContentKey, WrittenData*, ContentKeyHash> writtenFiles;
+
+    // Files, that share data with already written
+    // files. Data is known only after flushing.
+    std::vector<std::pair<WrittenData*, const WrittenData*>> duplicates;
+};
+
+PackageProcessor::PackageProcessor() :
+    m_pathToOpenedPackage(),
+    m_pathToPackageRoot(),
+    m_metadata(),
+    m_entries(),
+    m_numberOfJobs(1),
+    m_pathToBuildCache(),
+    m_statistics()
+{
+}
+
+void PackageProcessor::setNumberOfJobs(std::size_t numberOfJobs)
+{
+    if (numberOfJobs == 0)
+    {
+        throw std::invalid_argument("Number of jobs can't be 0");
+    }
+
+    m_numberOfJobs = numberOfJobs;
+}
+
+std::size_t PackageProcessor::numberOfJobs() const
+{
+    return m_numberOfJobs;
+}
+
+void PackageProcessor::setBuildCache(std::filesystem::path path)
+{
+    m_pathToBuildCache = std::move(path);
+}
+
+const PackageProcessor::Statistics& PackageProcessor::statistics() const
+{
+    return m_statistics;
 }
 
 PackageProcessor::Metadata& PackageProcessor::metadata()
@@ -96,30 +479,15 @@ void PackageProcessor::load(std::filesystem::path path)
         throw std::invalid_argument(std::string("File is smaller than package header"));
     }
 
-    std::size_t pointer = 0;
-
     // Validating
-    if (buffer.read<std::uint32_t>(pointer, endianness::big) != PACKAGE_MAGIC)
+    if (buffer.read<std::uint32_t>(0, endianness::big) != PACKAGE_MAGIC)
     {
         clear();
         throw std::invalid_argument(std::string("Package has wrong magic bytes"));
     }
-    pointer += 4;
-
-    // Saving crc32 for future use
-    auto crc32 = buffer.read<std::uint32_t>(pointer, endianness::big);
-    pointer += 4;
-
-    // Perform validating here
-    validateCRC(file, crc32);
-
-    // Getting total file size
-    auto fileSize = buffer.read<std::uint64_t>(pointer, endianness::big);
-    pointer += 8;
 
     // Getting version of packer
-    auto version = buffer.read<std::uint32_t>(pointer, endianness::big);
-    pointer += 4;
+    auto version = buffer.read<std::uint32_t>(16, endianness::big);
 
     if (version > PACKER_VERSION)
     {
@@ -128,6 +496,41 @@ void PackageProcessor::load(std::filesystem::path path)
                                     std::to_string(PACKER_VERSION) + ", package: " + std::to_string(version));
     }
 
+    try
+    {
+        if (version < 2)
+        {
+            loadVersion1(file, buffer);
+        }
+        else
+        {
+            loadVersion2(file, buffer);
+        }
+    }
+    catch (...)
+    {
+        clear();
+        throw;
+    }
+}
+
+void PackageProcessor::loadVersion1(std::ifstream& file, bytearray<>& buffer)
+{
+    std::streamsize actuallyRead = 0;
+
+    // Skipping magic
+    std::size_t pointer = 4;
+
+    // Saving crc32 for future use
+    auto crc32 = buffer.read<std::uint32_t>(pointer, endianness::big);
+    pointer += 4;
+
+    // Perform validating here
+    validateCRC(file, crc32);
+
+    // Skipping total file size and version
+    pointer += 12;
+
     // Getting number of metadata fields
     auto numberOfMetadataFields = buffer.read<std::uint32_t>(pointer, endianness::big);
     pointer += 4;
@@ -177,26 +580,7 @@ void PackageProcessor::load(std::filesystem::path path)
         }
 
         // Parsing into values
-        switch (type)
-        {
-        case MetadataCodes::Name:
-            m_metadata.name.resize(valueLength);
-            std::memcpy(m_metadata.name.data(), buffer.container().data(), valueLength);
-            break;
-        case MetadataCodes::Author:
-            m_metadata.author.resize(valueLength);
-            std::memcpy(m_metadata.author.data(), buffer.container().data(), valueLength);
-            break;
-        case MetadataCodes::Major:
-            m_metadata.version.major = buffer.read<std::uint32_t>(0, endianness::big);
-            break;
-        case MetadataCodes::Minor:
-            m_metadata.version.minor = buffer.read<std::uint32_t>(0, endianness::big);
-            break;
-        default:
-            // Just skip unknown metadata headers
-            break;
-        }
+        readMetadataValue(type, buffer, 0, valueLength);
 
         pointer += valueLength;
         auto alignment = align(pointer, ALIGNMENT); // Alignment
@@ -307,9 +691,259 @@ void PackageProcessor::load(std::filesystem::path path)
     }
 }
 
+void PackageProcessor::loadVersion2(std::ifstream& file, bytearray<>& buffer)
+{
+    // Reading rest of header
+    buffer.container().resize(HEADER_SIZE_V2);
+
+    file.read(reinterpret_cast<char*>(buffer.container().data() + HEADER_SIZE), HEADER_SIZE_V2 - HEADER_SIZE);
+
+    if (file.gcount() != HEADER_SIZE_V2 - HEADER_SIZE)
+    {
+        throw std::invalid_argument("File is smaller than package header");
+    }
+
+    auto directoryCRC           = buffer.read<std::uint32_t>(4, endianness::big);
+    auto numberOfMetadataFields = buffer.read<std::uint32_t>(20, endianness::big);
+    auto numberOfFileFields     = buffer.read<std::uint32_t>(24, endianness::big);
+    auto blockSize              = buffer.read<std::uint32_t>(28, endianness::big);
+    auto directoryOffset        = buffer.read<std::uint64_t>(32, endianness::big);
+    auto directorySize          = buffer.read<std::uint64_t>(40, endianness::big);
+
+    if (blockSize == 0)
+    {
+        throw std::invalid_argument("Package has zero block size");
+    }
+
+    // Reading whole directory at once
+    buffer.container().resize(directorySize);
+
+    file.seekg(directoryOffset);
+    file.read(reinterpret_cast<char*>(buffer.container().data()), directorySize);
+
+    if (static_cast<std::uint64_t>(file.gcount()) != directorySize)
+    {
+        throw std::invalid_argument("Directory read smaller than expected");
+    }
+
+    if (crc32(crc32(0L, nullptr, 0), buffer.container().data(), static_cast<uInt>(directorySize)) != directoryCRC)
+    {
+        throw std::invalid_argument("Invalid directory control sum.");
+    }
+
+    std::size_t pointer = 0;
+
+    // Content hashes by file entry ID
+    std::unordered_map<std::uint32_t, std::uint64_t> hashes;
+
+    auto require = [&pointer, directorySize](std::uint64_t length, const char* message) {
+        if (pointer > directorySize || length > directorySize - pointer)
+        {
+            throw std::invalid_argument(message);
+        }
+    };
+
+    for (std::uint32_t index = 0; index < numberOfMetadataFields; ++index)
+    {
+        auto fieldBegin = pointer;
+
+        require(METADATA_HEADER_SIZE, "Metadata header read smaller than expected");
+
+        auto type = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto valueLength = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        require(valueLength, "Metadata value read smaller than expected");
+
+        if (type == MetadataCodes::Hashes)
+        {
+            for (std::size_t record = 0; record + CONTENT_HASH_RECORD_SIZE <= valueLength;
+                 record += CONTENT_HASH_RECORD_SIZE)
+            {
+                hashes[buffer.read<std::uint32_t>(pointer + record, endianness::big)] =
+                    buffer.read<std::uint64_t>(pointer + record + 8, endianness::big);
+            }
+        }
+        else
+        {
+            readMetadataValue(type, buffer, pointer, valueLength);
+        }
+
+        pointer += valueLength;
+        pointer += align(pointer - fieldBegin, ALIGNMENT);
+    }
+
+    std::unordered_map<std::uint32_t, // ID
+                       std::filesystem::path>
+        directories;
+
+    for (std::uint32_t index = 0; index < numberOfFileFields; ++index)
+    {
+        auto fieldBegin = pointer;
+
+        require(FILE_ENTRY_HEADER_SIZE_V2, "File entry header read smaller than expected");
+
+        // Type and 3 reserved bytes
+        auto type = buffer.read<std::uint8_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto id = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto parentId = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto nameLength = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto dataOffset = buffer.read<std::uint64_t>(pointer, endianness::big);
+        pointer += 8;
+
+        auto compressedSize = buffer.read<std::uint64_t>(pointer, endianness::big);
+        pointer += 8;
+
+        auto size = buffer.read<std::uint64_t>(pointer, endianness::big);
+        pointer += 8;
+
+        auto crc = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        auto numberOfBlocks = buffer.read<std::uint32_t>(pointer, endianness::big);
+        pointer += 4;
+
+        require(nameLength, "File entry name read smaller than expected");
+
+        std::string stringName(reinterpret_cast<const char*>(buffer.container().data() + pointer), nameLength);
+
+        pointer += nameLength;
+        pointer += align(pointer - fieldBegin, ALIGNMENT);
+
+        std::filesystem::path entryPath;
+
+        if (parentId != 0)
+        {
+            auto parentEntryIterator = directories.find(parentId);
+
+            if (parentEntryIterator == directories.end())
+            {
+                throw std::invalid_argument("Wrong file entries sequence");
+            }
+
+            entryPath /= parentEntryIterator->second;
+        }
+
+        entryPath /= stringName;
+
+        switch (type)
+        {
+        case FileEntryTypes::File:
+        {
+            if (numberOfBlocks != (size + blockSize - 1) / blockSize)
+            {
+                throw std::invalid_argument("Wrong number of blocks in \"" + entryPath.string() + "\"");
+            }
+
+            require(BLOCK_ENTRY_SIZE * numberOfBlocks, "Blocks table read smaller than expected");
+
+            std::vector<File::Block> blocks(numberOfBlocks);
+
+            auto blockOffset = dataOffset;
+
+            for (auto& block : blocks)
+            {
+                block.offset = blockOffset;
+
+                block.compressedSize = buffer.read<std::uint32_t>(pointer, endianness::big);
+                pointer += 4;
+
+                block.crc = buffer.read<std::uint32_t>(pointer, endianness::big);
+                pointer += 4;
+
+                blockOffset += block.compressedSize;
+            }
+
+            if (blockOffset - dataOffset != compressedSize || blockOffset > directoryOffset)
+            {
+                throw std::invalid_argument("Wrong blocks table of \"" + entryPath.string() + "\"");
+            }
+
+            pointer += align(BLOCK_ENTRY_SIZE * numberOfBlocks, ALIGNMENT);
+
+            auto hash = hashes.find(id);
+
+            m_entries.emplace_back(entryPath,
+                                   dataOffset,
+                                   compressedSize,
+                                   size,
+                                   crc,
+                                   blockSize,
+                                   std::move(blocks),
+                                   hash == hashes.end() ? 0 : hash->second);
+            break;
+        }
+        case FileEntryTypes::Directory:
+            directories.insert({id, std::move(entryPath)});
+            break;
+        default:
+            throw std::invalid_argument("Unknown file entry type found");
+        }
+    }
+}
+
+void PackageProcessor::readMetadataValue(std::uint32_t type,
+                                         const bytearray<>& buffer,
+                                         std::size_t offset,
+                                         std::uint32_t length)
+{
+    switch (type)
+    {
+    case MetadataCodes::Name:
+        m_metadata.name.resize(length);
+        std::memcpy(m_metadata.name.data(), buffer.container().data() + offset, length);
+        break;
+    case MetadataCodes::Author:
+        m_metadata.author.resize(length);
+        std::memcpy(m_metadata.author.data(), buffer.container().data() + offset, length);
+        break;
+    case MetadataCodes::Major:
+        m_metadata.version.major = buffer.read<std::uint32_t>(offset, endianness::big);
+        break;
+    case MetadataCodes::Minor:
+        m_metadata.version.minor = buffer.read<std::uint32_t>(offset, endianness::big);
+        break;
+    default:
+        // Just skip unknown metadata headers
+        break;
+    }
+}
+
 void PackageProcessor::write(std::filesystem::path path)
 {
-    std::ofstream file(path.string(), std::ios::binary);
+    m_statistics = Statistics();
+
+    // Package is written into temporary file, because
+    // opened package or build cache can be overwritten.
+    auto temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    // Temporary file is removed if writing has failed
+    struct TemporaryFileGuard
+    {
+        ~TemporaryFileGuard()
+        {
+            if (!path.empty())
+            {
+                std::error_code error;
+                std::filesystem::remove(path, error);
+            }
+        }
+
+        std::filesystem::path path;
+    } temporaryFileGuard{temporaryPath};
+
+    std::ofstream file(temporaryPath.string(), std::ios::binary);
 
     if (!file.is_open())
     {
@@ -317,144 +951,219 @@ void PackageProcessor::write(std::filesystem::path path)
         throw std::invalid_argument(std::string("Can't open file: ") + strerror(errno));
     }
 
-    bytearray<> buffer;
+    struct WriteEntryInfo
+    {
+        std::uint32_t id = 0;
+        bool wasWritten  = false;
+        WrittenData data;
+    };
 
-    std::size_t fileSize = 0;
+    std::unordered_map<std::filesystem::path, WriteEntryInfo> entries;
 
-    // Build header
-    buffer.reserve(HEADER_SIZE);
+    std::uint32_t idCounter = 1;
 
-    // Pushing magic
-    buffer.push_back<std::uint32_t>(PACKAGE_MAGIC, endianness::big);
+    // Counting amount of file entries
+    for (const auto& entry : m_entries)
+    {
+        std::filesystem::path bufferPath;
 
-    // Pushing dummy crc32
-    buffer.push_back<std::uint32_t>(0, endianness::big);
+        for (const auto& pathPart : entry.path())
+        {
+            bufferPath /= pathPart;
 
-    // Pushing dummy result file size
-    buffer.push_back<std::uint64_t>(0, endianness::big);
+            auto entryIterator = entries.find(bufferPath);
 
-    // Pushing packer version
-    buffer.push_back<std::uint32_t>(PACKER_VERSION, endianness::big);
+            if (entryIterator == entries.end())
+            {
+                entries.insert({bufferPath, {idCounter++, false, {}}});
+                continue;
+            }
+        }
+    }
 
-    // Pushing amount of metadata fields
-    buffer.push_back<std::uint32_t>(AMOUNT_OF_METADATA_FIELDS, endianness::big);
+    bytearray<> buffer;
 
-    struct WriteEntryInfo
+    // Header is rewritten, when directory is written
+    buffer.push_back_multiple<std::uint8_t>(0, HEADER_SIZE_V2, endianness::big);
+
+    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+
+    // Writing compressed data
     {
-        std::uint32_t id                = 0;
-        bool wasWritten                 = false;
-        std::size_t offsetToOffsetField = 0;
-    };
+        BuildContext context(file, m_numberOfJobs);
 
-    std::unordered_map<std::filesystem::path, WriteEntryInfo> entries;
+        loadBuildCache(context);
+
+        for (const auto& entry : m_entries)
+        {
+            auto& data = entries.find(entry.path())->second.data;
+
+            switch (entry.type())
+            {
+            case File::Type::Filesystem:
+            {
+                auto filePath = m_pathToPackageRoot / entry.path();
+
+                std::ifstream input(filePath.string(), std::ios::binary);
+
+                if (!input.is_open())
+                {
+                    throw std::runtime_error("Can't open \"" + filePath.string() + "\": " + strerror(errno));
+                }
+
+                writeStream(context, input, data);
+                break;
+            }
+            case File::Type::Package:
+                writePackageFile(context, entry, data);
+                break;
+            }
+        }
+
+        context.writer.flush();
+
+        // All data is written, so duplicates can
+        // take location of original files
+        for (auto& [duplicate, original] : context.duplicates)
+        {
+            *duplicate = *original;
+        }
+    }
+
+    auto directoryOffset = static_cast<std::uint64_t>(file.tellp());
+
+    // Building directory
+    buffer.clear();
+
+    auto pushStringMetadata = [&buffer](std::uint32_t type, const std::string& value) {
+        auto fieldBegin = buffer.size();
+
+        // Pushing type
+        buffer.push_back<std::uint32_t>(type, endianness::big);
 
-    std::uint32_t idCounter = 1;
+        // Pushing value length
+        buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(value.size()), endianness::big);
 
-    // Counting amount of file entries
-    for (const auto& entry : m_entries)
-    {
-        std::filesystem::path bufferPath;
+        // Pushing actual value
+        buffer.push_back_multiple(value.begin(), value.end());
 
-        for (const auto& pathPart : entry.path())
-        {
-            bufferPath /= pathPart;
+        // Pushing 16 bytes alignment
+        buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size() - fieldBegin, ALIGNMENT), endianness::big);
+    };
 
-            auto entryIterator = entries.find(bufferPath);
+    auto pushIntegerMetadata = [&buffer](std::uint32_t type, std::uint32_t value) {
+        auto fieldBegin = buffer.size();
 
-            if (entryIterator == entries.end())
-            {
-                entries.insert({bufferPath, {idCounter++, false}});
-                continue;
-            }
-        }
-    }
+        // Pushing type
+        buffer.push_back<std::uint32_t>(type, endianness::big);
 
-    // Pushing amount of file entries fields
-    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(entries.size()), endianness::big);
+        // Pushing value length
+        buffer.push_back<std::uint32_t>(4, endianness::big);
 
-    // Pushing empty reserved field
-    buffer.push_back<std::uint32_t>(0, endianness::big);
+        // Pushing actual value
+        buffer.push_back<std::uint32_t>(value, endianness::big);
 
-    assert(buffer.size() == HEADER_SIZE);
+        // Pushing 16 bytes alignment
+        buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size() - fieldBegin, ALIGNMENT), endianness::big);
+    };
 
-    // Writing header to file
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+    pushStringMetadata(MetadataCodes::Name, m_metadata.name);
+    pushStringMetadata(MetadataCodes::Author, m_metadata.author);
+    pushIntegerMetadata(MetadataCodes::Major, m_metadata.version.major);
+    pushIntegerMetadata(MetadataCodes::Minor, m_metadata.version.minor);
 
-    // todo: make some more convenient algorithm
-    // Writing name metadata
-    buffer.clear();
+    // Pushing content hashes
+    {
+        bytearray<> records;
 
-    // Pushing type
-    buffer.push_back<std::uint32_t>(MetadataCodes::Name, endianness::big);
+        for (const auto& entry : m_entries)
+        {
+            const auto& info = entries.find(entry.path())->second;
 
-    // Pushing value length
-    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(m_metadata.name.size()), endianness::big);
+            if (info.data.hash == 0)
+            {
+                continue;
+            }
 
-    // Pushing actual name
-    buffer.push_back_multiple(m_metadata.name.begin(), m_metadata.name.end());
+            records.push_back<std::uint32_t>(info.id, endianness::big);
+            records.push_back<std::uint32_t>(0, endianness::big);
+            records.push_back<std::uint64_t>(info.data.hash, endianness::big);
+        }
 
-    // Pushing 16 bytes alignment
-    buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+        auto fieldBegin = buffer.size();
 
-    // Write metadata to file
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+        // Pushing type
+        buffer.push_back<std::uint32_t>(MetadataCodes::Hashes, endianness::big);
 
-    // Writing name metadata
-    buffer.clear();
+        // Pushing value length
+        buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(records.size()), endianness::big);
 
-    // Pushing type
-    buffer.push_back<std::uint32_t>(MetadataCodes::Author, endianness::big);
+        // Pushing actual value
+        buffer.push_back_multiple(records.container().begin(), records.container().end());
 
-    // Pushing value length
-    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(m_metadata.author.size()), endianness::big);
+        // Pushing 16 bytes alignment
+        buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size() - fieldBegin, ALIGNMENT), endianness::big);
+    }
 
-    // Pushing actual name
-    buffer.push_back_multiple(m_metadata.author.begin(), m_metadata.author.end());
+    auto pushFileEntry = [&buffer](std::uint8_t type,
+                                   std::uint32_t id,
+                                   std::uint32_t parentId,
+                                   const std::string& name,
+                                   const WrittenData& data) {
+        auto fieldBegin = buffer.size();
 
-    // Pushing 16 bytes alignment
-    buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+        // Pushing type
+        buffer.push_back<std::uint8_t>(type, endianness::big);
 
-    // Write metadata to file
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+        // Pushing 3 reserved bytes
+        buffer.push_back_multiple<std::uint8_t>(0, 3, endianness::big);
 
-    // Writing name metadata
-    buffer.clear();
+        // Pushing ID
+        buffer.push_back<std::uint32_t>(id, endianness::big);
 
-    // Pushing type
-    buffer.push_back<std::uint32_t>(MetadataCodes::Major, endianness::big);
+        // Pushing parent ID
+        buffer.push_back<std::uint32_t>(parentId, endianness::big);
 
-    // Pushing value length
-    buffer.push_back<std::uint32_t>(4, endianness::big);
+        // Pushing name length
+        buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(name.size()), endianness::big);
 
-    // Pushing actual name
-    buffer.push_back<std::uint32_t>(m_metadata.version.major, endianness::big);
+        // Pushing data offset
+        buffer.push_back<std::uint64_t>(data.offset, endianness::big);
 
-    // Pushing 16 bytes alignment
-    buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+        // Pushing compressed data size
+        buffer.push_back<std::uint64_t>(data.compressedSize, endianness::big);
 
-    // Write metadata to file
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+        // Pushing uncompressed data size
+        buffer.push_back<std::uint64_t>(data.size, endianness::big);
 
-    // Pushing 16 bytes alignment
-    buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+        // Pushing data crc32
+        buffer.push_back<std::uint32_t>(data.crc, endianness::big);
 
-    // Writing name metadata
-    buffer.clear();
+        // Pushing number of blocks
+        buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(data.blocks.size()), endianness::big);
 
-    // Pushing type
-    buffer.push_back<std::uint32_t>(MetadataCodes::Minor, endianness::big);
+        // Pushing name
+        buffer.push_back_multiple(name.begin(), name.end());
 
-    // Pushing value length
-    buffer.push_back<std::uint32_t>(4, endianness::big);
+        // Pushing alignment
+        buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size() - fieldBegin, ALIGNMENT), endianness::big);
 
-    // Pushing actual name
-    buffer.push_back<std::uint32_t>(m_metadata.version.minor, endianness::big);
+        if (type != FileEntryTypes::File)
+        {
+            return;
+        }
 
-    // Pushing 16 bytes alignment
-    buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+        // Pushing blocks table
+        for (const auto& block : data.blocks)
+        {
+            buffer.push_back<std::uint32_t>(block.compressedSize, endianness::big);
+            buffer.push_back<std::uint32_t>(block.crc, endianness::big);
+        }
 
-    // Write metadata to file
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+        // Pushing blocks table alignment
+        buffer.push_back_multiple<std::uint8_t>(
+            0, align(BLOCK_ENTRY_SIZE * data.blocks.size(), ALIGNMENT), endianness::big);
+    };
 
     // Writing file structures
     for (const auto& entry : m_entries)
@@ -477,48 +1186,16 @@ void PackageProcessor::write(std::filesystem::path path)
             auto writeInfoIter = entries.find(bufferPath);
 
             // Not checking for existing, cause of previous filler
-            if (writeInfoIter->second.wasWritten)
+            if (!writeInfoIter->second.wasWritten)
             {
-                // Saving current path part as parent id
-                parentId = writeInfoIter->second.id;
-                continue;
-            }
-
-            // Clearing buffer
-            buffer.clear();
-
-            // Pushing type
-            buffer.push_back<std::uint8_t>(FileEntryTypes::Directory, endianness::big);
-
-            // Pushing 3 reserved bytes
-            buffer.push_back_multiple<std::uint8_t>(0, 3, endianness::big);
-
-            // Pushing ID
-            buffer.push_back<std::uint32_t>(writeInfoIter->second.id, endianness::big);
-
-            // Pushing parent ID
-            buffer.push_back<std::uint32_t>(parentId, endianness::big);
-
-            // Pushing name size
-            buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(pathPart.string().size()), endianness::big);
-
-            // Pushing dummy data offset
-            buffer.push_back<std::uint64_t>(0, endianness::big);
-
-            // Pushing dummy compressed data size
-            buffer.push_back<std::uint64_t>(0, endianness::big);
-
-            // Pushing name
-            auto pathString = pathPart.string();
-            buffer.push_back_multiple(pathString.begin(), pathString.end());
-
-            // Pushing alignment
-            buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
-
-            // Writing file entry to file
-            file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+                pushFileEntry(FileEntryTypes::Directory,
+                              writeInfoIter->second.id,
+                              parentId,
+                              pathPart.string(),
+                              writeInfoIter->second.data);
 
-            writeInfoIter->second.wasWritten = true;
+                writeInfoIter->second.wasWritten = true;
+            }
 
             // Saving current path part as parent id
             parentId = writeInfoIter->second.id;
@@ -537,132 +1214,128 @@ void PackageProcessor::write(std::filesystem::path path)
             continue;
         }
 
-        // Writing file
-        buffer.clear();
-
-        // Pushing type
-        buffer.push_back<std::uint8_t>(FileEntryTypes::File, endianness::big);
-
-        // Pushing 3 reserved bytes
-        buffer.push_back_multiple<std::uint8_t>(0, 3, endianness::big);
-
-        // Pushing ID
-        buffer.push_back<std::uint32_t>(writeInfoIter->second.id, endianness::big);
-
-        // Pushing parent ID
-        buffer.push_back<std::uint32_t>(parentId);
+        pushFileEntry(FileEntryTypes::File,
+                      writeInfoIter->second.id,
+                      parentId,
+                      entryFilename.string(),
+                      writeInfoIter->second.data);
 
-        // Pushing name length
-        buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(entryFilename.string().size()), endianness::big);
+        writeInfoIter->second.wasWritten = true;
+    }
 
-        writeInfoIter->second.offsetToOffsetField = std::size_t(file.tellp()) + FILE_ENTRY_HEADER_SIZE / 2;
+    auto directorySize = static_cast<std::uint64_t>(buffer.size());
+    auto directoryCRC  = crc32(crc32(0L, nullptr, 0), buffer.container().data(), static_cast<uInt>(directorySize));
 
-        // Pushing dummy data offset
-        buffer.push_back<std::uint64_t>(0, endianness::big);
+    // Writing directory to file
+    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
 
-        // Pushing dummy data size
-        buffer.push_back<std::uint64_t>(0, endianness::big);
+    auto packageSize = static_cast<std::uint64_t>(file.tellp());
 
-        // Pushing name
-        auto filenameString = entryFilename.string();
-        buffer.push_back_multiple(filenameString.begin(), filenameString.end());
+    // Build header
+    buffer.clear();
+    buffer.reserve(HEADER_SIZE_V2);
 
-        // Pushing alignment
-        buffer.push_back_multiple<std::uint8_t>(0, align(buffer.size(), ALIGNMENT));
+    // Pushing magic
+    buffer.push_back<std::uint32_t>(PACKAGE_MAGIC, endianness::big);
 
-        // Writing file entry to file
-        file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+    // Pushing directory crc32
+    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(directoryCRC), endianness::big);
 
-        writeInfoIter->second.wasWritten = true;
-    }
+    // Pushing result file size
+    buffer.push_back<std::uint64_t>(packageSize, endianness::big);
 
-    std::ifstream basePackageFile;
+    // Pushing packer version
+    buffer.push_back<std::uint32_t>(PACKER_VERSION, endianness::big);
 
-    for (auto& entry : m_entries)
-    {
-        std::size_t offset;
-        std::size_t size;
+    // Pushing amount of metadata fields
+    buffer.push_back<std::uint32_t>(AMOUNT_OF_METADATA_FIELDS, endianness::big);
 
-        switch (entry.type())
-        {
-        case File::Type::Filesystem:
-            writeFilesystemFile(file, m_pathToPackageRoot / entry.path(), offset, size);
-            break;
-        case File::Type::Package:
-            offset = entry.compressedOffset();
-            size   = entry.compressedSize();
-            writePackageFile(file, basePackageFile, offset, size);
-            break;
-        }
+    // Pushing amount of file entries fields
+    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(entries.size()), endianness::big);
 
-        auto currPosition = file.tellp();
+    // Pushing block size
+    buffer.push_back<std::uint32_t>(static_cast<std::uint32_t>(BLOCK_SIZE), endianness::big);
 
-        auto iter = entries.find(entry.path());
+    // Pushing directory location
+    buffer.push_back<std::uint64_t>(directoryOffset, endianness::big);
+    buffer.push_back<std::uint64_t>(directorySize, endianness::big);
 
-        file.seekp(iter->second.offsetToOffsetField);
+    assert(buffer.size() == HEADER_SIZE_V2);
 
-        // Rewriting offset/size data
-        buffer.clear();
-        buffer.push_back<std::uint64_t>(offset, endianness::big);
-        buffer.push_back<std::uint64_t>(size, endianness::big);
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
 
-        file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
+    file.close();
 
-        file.seekp(currPosition);
+    if (!file.good())
+    {
+        throw std::runtime_error("Can't write package \"" + path.string() + "\"");
     }
 
-    basePackageFile.close();
-
-    file.close();
+    std::filesystem::rename(temporaryPath, path);
 
-    basePackageFile.open(path.string(), std::ios::binary);
+    temporaryFileGuard.path.clear();
+}
 
-    if (!basePackageFile.is_open())
+void PackageProcessor::unpack(std::filesystem::path path)
+{
+    if (m_pathToOpenedPackage.empty())
     {
-        throw std::runtime_error("Can't open create package to calculate crc32: " + std::string(strerror(errno)));
+        throw std::runtime_error("Package is not opened");
     }
 
-    basePackageFile.seekg(8, std::ios::beg);
+    std::atomic<std::size_t> nextEntry = 0;
 
-    auto crc = calculateStreamCRC(basePackageFile);
+    std::mutex errorMutex;
+    std::exception_ptr error;
 
-    basePackageFile.close();
+    // Every thread unpacks next not unpacked file
+    auto unpackFunction = [this, &path, &nextEntry, &errorMutex, &error]() {
+        try
+        {
+            std::ifstream file(m_pathToOpenedPackage.string(), std::ios::binary);
 
-    file.open(path.string(), std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+            if (!file.is_open())
+            {
+                throw std::runtime_error("Can't open package file for inflating");
+            }
 
-    auto fileEnd = file.tellp();
+            for (auto index = nextEntry++; index < m_entries.size(); index = nextEntry++)
+            {
+                internalUnpack(file, path / m_entries[index].path(), m_entries[index]);
+            }
+        }
+        catch (...)
+        {
+            std::unique_lock<std::mutex> lock(errorMutex);
 
-    if (!file.is_open())
-    {
-        // todo: add special cross platform error getter
-        throw std::invalid_argument(std::string("Can't open file for writing CRC32: ") + strerror(errno));
-    }
+            if (error == nullptr)
+            {
+                error = std::current_exception();
+            }
 
-    buffer.clear();
-    buffer.push_back<std::uint32_t>(crc, endianness::big);
+            // Stopping other threads
+            nextEntry = m_entries.size();
+        }
+    };
 
-    file.seekp(4);
-    file.write(reinterpret_cast<const char*>(buffer.container().data()), buffer.size());
-    file.seekp(fileEnd);
-}
+    std::vector<std::thread> threads;
 
-void PackageProcessor::unpack(std::filesystem::path path)
-{
-    if (m_pathToOpenedPackage.empty())
+    for (std::size_t index = 1; index < std::min(m_numberOfJobs, m_entries.size()); ++index)
     {
-        throw std::runtime_error("Package is not opened");
+        threads.emplace_back(unpackFunction);
     }
 
-    std::ifstream file(m_pathToOpenedPackage.string(), std::ios::binary);
+    unpackFunction();
 
-    if (!file.is_open())
+    for (auto& thread : threads)
     {
-        throw std::runtime_error("Can't open package file for inflating");
+        thread.join();
     }
 
-    for (const auto& fileEntry : m_entries)
+    if (error != nullptr)
     {
-        internalUnpack(file, path / fileEntry.path(), fileEntry);
+        std::rethrow_exception(error);
     }
 }
 
@@ -703,7 +1376,72 @@ void PackageProcessor::internalUnpack(std::ifstream& stream,
 
     stream.seekg(file.compressedOffset());
 
-    HG::Utils::ZLib::InflateStreamToStream(stream, output, INFLATE_CHUNK_SIZE);
+    // Version 1 files are single zlib stream
+    if (file.blockSize() == 0)
+    {
+        HG::Utils::ZLib::InflateStreamToStream(stream, output, INFLATE_CHUNK_SIZE);
+        return;
+    }
+
+    unpackBlocks(stream, output, file);
+}
+
+void PackageProcessor::unpackBlocks(std::ifstream& stream, std::ostream& output, const PackageProcessor::File& file)
+{
+    std::vector<Bytef> compressed;
+    std::vector<Bytef> inflated(file.blockSize());
+
+    auto crc  = crc32(0L, nullptr, 0);
+    auto left = file.size();
+
+    // Blocks are placed one by one
+    stream.seekg(file.compressedOffset());
+
+    for (const auto& block : file.blocks())
+    {
+        auto blockSize = std::min(left, file.blockSize());
+
+        compressed.resize(block.compressedSize);
+
+        stream.read(reinterpret_cast<char*>(compressed.data()), block.compressedSize);
+
+        if (static_cast<std::size_t>(stream.gcount()) != block.compressedSize)
+        {
+            throw std::runtime_error("Can't read block of \"" + file.path().string() + "\"");
+        }
+
+        const Bytef* data = compressed.data();
+
+        // Block is stored without compression
+        if (block.compressedSize != blockSize)
+        {
+            auto inflatedSize = static_cast<uLongf>(blockSize);
+
+            if (uncompress(inflated.data(), &inflatedSize, compressed.data(), block.compressedSize) != Z_OK ||
+                inflatedSize != blockSize)
+            {
+                throw std::runtime_error("Inflating error, wrong block of \"" + file.path().string() + "\"");
+            }
+
+            data = inflated.data();
+        }
+
+        if (crc32(crc32(0L, nullptr, 0), data, static_cast<uInt>(blockSize)) != block.crc)
+        {
+            throw std::runtime_error("Invalid control sum of \"" + file.path().string() + "\" block.");
+        }
+
+        crc = crc32_combine(crc, block.crc, static_cast<z_off_t>(blockSize));
+
+        output.write(reinterpret_cast<const char*>(data), blockSize);
+
+        left -= blockSize;
+    }
+
+    if (left != 0 || crc != file.crc())
+    {
+        throw std::runtime_error("Invalid control sum of \"" + file.path().string() + "\".");
+    }
 }
 
 void PackageProcessor::validateCRC(std::ifstream& file, std::uint32_t crc)
@@ -736,58 +1474,197 @@ std::uint32_t PackageProcessor::calculateStreamCRC(std::ifstream& file)
     return static_cast<std::uint32_t>(calculatedCRC);
 }
 
-void PackageProcessor::writeFilesystemFile(std::ofstream& to,
-                                           const std::filesystem::path& path,
-                                           std::size_t& offset,
-                                           std::size_t& size)
+void PackageProcessor::loadBuildCache(BuildContext& context)
 {
-    offset = static_cast<std::size_t>(to.tellp());
+    if (m_pathToBuildCache.empty())
+    {
+        return;
+    }
 
-    std::ifstream file(path.string());
+    PackageProcessor cache;
 
-    if (!file.is_open())
+    try
+    {
+        cache.load(m_pathToBuildCache);
+    }
+    catch (const std::exception&)
+    {
+        // Package without cache is built
+        return;
+    }
+
+    for (const auto& file : cache.files())
+    {
+        // Only data with known content and
+        // same blocks can be reused
+        if (file.contentHash() == 0 || file.blockSize() != BLOCK_SIZE)
+        {
+            continue;
+        }
+
+        context.cachedFiles.emplace(ContentKey{file.size(), file.crc(), file.contentHash()}, file);
+    }
+
+    if (context.cachedFiles.empty())
+    {
+        return;
+    }
+
+    context.cacheFile.open(m_pathToBuildCache.string(), std::ios::binary);
+
+    if (!context.cacheFile.is_open())
+    {
+        context.cachedFiles.clear();
+    }
+}
+
+void PackageProcessor::writeStream(BuildContext& context, std::istream& from, WrittenData& data)
+{
+    auto key = hashStream(from);
+
+    auto writtenIterator = context.writtenFiles.find(key);
+
+    if (writtenIterator != context.writtenFiles.end())
+    {
+        context.duplicates.emplace_back(&data, writtenIterator->second);
+        m_statistics.deduplicatedBytes += key.size;
+        return;
+    }
+
+    context.writtenFiles.emplace(key, &data);
+
+    auto cachedIterator = context.cachedFiles.find(key);
+
+    // Corrupted cache blocks are compressed again
+    if (cachedIterator != context.cachedFiles.end() && validateBlocks(context.cacheFile, cachedIterator->second))
     {
-        throw std::runtime_error("Can't open \"" + path.string() + "\": " + strerror(errno));
+        copyBlocks(context, context.cacheFile, cachedIterator->second, data);
+        m_statistics.reusedBytes += key.size;
+        return;
     }
 
-    size = HG::Utils::ZLib::DeflateStreamToStream(file, to, DEFLATE_CHUNK_SIZE);
+    context.writer.write(from, data);
+    data.hash = key.hash;
+
+    m_statistics.recompressedBytes += key.size;
 }
 
-void PackageProcessor::writePackageFile(std::ofstream& to,
-                                        std::ifstream& basePackageFile,
-                                        std::size_t& offset,
-                                        std::size_t& size)
+void PackageProcessor::writePackageFile(BuildContext& context, const PackageProcessor::File& file, WrittenData& data)
 {
-    if (!basePackageFile.is_open())
+    if (!context.basePackageFile.is_open())
     {
-        basePackageFile.open(m_pathToOpenedPackage.string(), std::ios::binary);
+        context.basePackageFile.open(m_pathToOpenedPackage.string(), std::ios::binary);
 
-        if (!basePackageFile.is_open())
+        if (!context.basePackageFile.is_open())
         {
             throw std::runtime_error("Can't open package to copy data");
         }
     }
 
-    basePackageFile.seekg(offset, std::ios::beg);
-    offset = static_cast<std::size_t>(to.tellp());
+    // Blocks of same size are copied without recompression
+    if (file.blockSize() == BLOCK_SIZE)
+    {
+        // There is no other source of data
+        if (!validateBlocks(context.basePackageFile, file))
+        {
+            throw std::runtime_error("Invalid control sum of \"" + file.path().string() + "\" block.");
+        }
+
+        if (file.contentHash() != 0)
+        {
+            ContentKey key = {file.size(), file.crc(), file.contentHash()};
+
+            auto writtenIterator = context.writtenFiles.find(key);
+
+            if (writtenIterator != context.writtenFiles.end())
+            {
+                context.duplicates.emplace_back(&data, writtenIterator->second);
+                m_statistics.deduplicatedBytes += file.size();
+                return;
+            }
+
+            context.writtenFiles.emplace(key, &data);
+        }
+
+        copyBlocks(context, context.basePackageFile, file, data);
+        m_statistics.reusedBytes += file.size();
+        return;
+    }
+
+    // Version 1 streams are recompressed
+    std::stringstream inflated;
+
+    if (file.blockSize() == 0)
+    {
+        context.basePackageFile.seekg(file.compressedOffset(), std::ios::beg);
+
+        HG::Utils::ZLib::InflateStreamToStream(context.basePackageFile, inflated, INFLATE_CHUNK_SIZE);
+    }
+    else
+    {
+        unpackBlocks(context.basePackageFile, inflated, file);
+    }
+
+    writeStream(context, inflated, data);
+}
+
+bool PackageProcessor::validateBlocks(std::ifstream& from, const PackageProcessor::File& file)
+{
+    // Inflated data is only checked
+    std::ostream discard(nullptr);
+
+    try
+    {
+        unpackBlocks(from, discard, file);
+    }
+    catch (const std::runtime_error&)
+    {
+        from.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void PackageProcessor::copyBlocks(BuildContext& context,
+                                  std::ifstream& from,
+                                  const PackageProcessor::File& file,
+                                  WrittenData& data)
+{
+    // Queued blocks are placed before copied ones
+    context.writer.flush();
+
+    from.seekg(file.compressedOffset(), std::ios::beg);
+
+    data.offset         = static_cast<std::size_t>(context.to.tellp());
+    data.compressedSize = file.compressedSize();
+    data.size           = file.size();
+    data.crc            = file.crc();
+    data.hash           = file.contentHash();
+    data.blocks         = file.blocks();
+
+    for (auto& block : data.blocks)
+    {
+        block.offset = block.offset - file.compressedOffset() + data.offset;
+    }
 
     char buffer[COPY_CHUNK_SIZE];
 
     std::size_t written = 0;
 
-    while (written >= size)
+    while (written < data.compressedSize)
     {
-        auto requiredRead = std::min(COPY_CHUNK_SIZE, size - written);
+        auto requiredRead = std::min(COPY_CHUNK_SIZE, data.compressedSize - written);
 
-        auto read = basePackageFile.readsome(buffer, requiredRead);
+        from.read(buffer, requiredRead);
 
-        if (read != requiredRead)
+        if (static_cast<std::size_t>(from.gcount()) != requiredRead)
         {
             throw std::runtime_error("Can't read expected amount of data");
         }
 
-        to.write(buffer, read);
-        written += read;
+        context.to.write(buffer, requiredRead);
+        written += requiredRead;
     }
 }
 
@@ -820,7 +1697,32 @@ PackageProcessor::File::File(std::filesystem::path path,
     m_path(std::move(path)),
     m_type(type),
     m_compressedOffset(offset),
-    m_compressedSize(size)
+    m_compressedSize(size),
+    m_size(0),
+    m_crc(0),
+    m_blockSize(0),
+    m_blocks(),
+    m_contentHash(0)
+{
+}
+
+PackageProcessor::File::File(std::filesystem::path path,
+                             std::size_t offset,
+                             std::size_t compressedSize,
+                             std::size_t size,
+                             std::uint32_t crc,
+                             std::size_t blockSize,
+                             std::vector<Block> blocks,
+                             std::uint64_t contentHash) :
+    m_path(std::move(path)),
+    m_type(Type::Package),
+    m_compressedOffset(offset),
+    m_compressedSize(compressedSize),
+    m_size(size),
+    m_crc(crc),
+    m_blockSize(blockSize),
+    m_blocks(std::move(blocks)),
+    m_contentHash(contentHash)
 {
 }
 
@@ -844,6 +1746,31 @@ std::size_t PackageProcessor::File::compressedSize() const
     return m_compressedSize;
 }
 
+std::size_t PackageProcessor::File::size() const
+{
+    return m_size;
+}
+
+std::uint32_t PackageProcessor::File::crc() const
+{
+    return m_crc;
+}
+
+std::size_t PackageProcessor::File::blockSize() const
+{
+    return m_blockSize;
+}
+
+const std::vector<PackageProcessor::File::Block>& PackageProcessor::File::blocks() const
+{
+    return m_blocks;
+}
+
+std::uint64_t PackageProcessor::File::contentHash() const
+{
+    return m_contentHash;
+}
+
 const std::vector<PackageProcessor::File>& PackageProcessor::files() const
 {
     return m_entries;
@@ -4,6 +4,7 @@
 
 // C++ STD
 #include <algorithm>
+#include <iterator>
 
 // HG::PackageProcessor
 #include <HG/Tools/PackageProcessor.hpp>
@@ -111,3 +112,215 @@ TEST(PackageProcessorLibrary, SampleWritingReading)
         ASSERT_NO_THROW(packageProcessor.unpack(targetPath / "UnpackDir"));
     }
 }
+
+TEST(PackageProcessorLibrary, BlocksRepackingAndValidation)
+{
+    auto targetPath      = std::filesystem::current_path() / "PackageResults" / "Blocks";
+    auto pathToResources = targetPath / "Resources";
+    auto pathToPackage   = targetPath / "package.hgpackage";
+    auto pathToRepacked  = targetPath / "repacked.hgpackage";
+
+    std::filesystem::create_directories(pathToResources / "dir");
+
+    // Several blocks of compressible and random data
+    std::string bigData(300 * 1024, '\0');
+
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < bigData.size(); ++i)
+    {
+        state      = state * 1103515245u + 12345u;
+        bigData[i] = static_cast<char>(i < bigData.size() / 2 ? i % 7 : state >> 24u);
+    }
+
+    std::ofstream(pathToResources / "dir" / "big.bin", std::ios::binary) << bigData;
+    std::ofstream(pathToResources / "small.txt", std::ios::binary) << "Small file";
+
+    // Writing
+    {
+        HG::Tools::PackageProcessor packageProcessor;
+
+        packageProcessor.setNumberOfJobs(3);
+        packageProcessor.setPackageRoot(pathToResources);
+        packageProcessor.addFile(pathToResources / "dir" / "big.bin");
+        packageProcessor.addFile(pathToResources / "small.txt");
+
+        ASSERT_NO_THROW(packageProcessor.write(pathToPackage));
+    }
+
+    // Repacking loaded package copies blocks
+    {
+        HG::Tools::PackageProcessor packageProcessor;
+
+        ASSERT_NO_THROW(packageProcessor.load(pathToPackage));
+        ASSERT_NO_THROW(packageProcessor.write(pathToRepacked));
+    }
+
+    HG::Tools::PackageProcessor packageProcessor;
+
+    ASSERT_NO_THROW(packageProcessor.load(pathToRepacked));
+    ASSERT_EQ(packageProcessor.files().size(), 2);
+
+    const auto& big = packageProcessor.files()[0];
+
+    ASSERT_EQ(big.size(), bigData.size());
+    ASSERT_EQ(big.blocks().size(), 5);
+    ASSERT_LT(big.blocks().front().compressedSize, big.blockSize());
+
+    // Random data is stored without compression
+    ASSERT_EQ(big.blocks().back().compressedSize, bigData.size() % big.blockSize());
+
+    ASSERT_NO_THROW(packageProcessor.unpack(targetPath / "Unpacked"));
+
+    std::ifstream unpacked(targetPath / "Unpacked" / "dir" / "big.bin", std::ios::binary);
+    ASSERT_EQ(std::string(std::istreambuf_iterator<char>(unpacked), {}), bigData);
+    unpacked.close();
+
+    // Corrupting last block of big file
+    {
+        std::fstream package(pathToRepacked, std::ios::binary | std::ios::in | std::ios::out);
+        package.seekp(big.blocks().back().offset);
+        package.put('\xFF');
+    }
+
+    // Package is loaded, because directory is not changed
+    HG::Tools::PackageProcessor corruptedProcessor;
+
+    ASSERT_NO_THROW(corruptedProcessor.load(pathToRepacked));
+    ASSERT_EQ(corruptedProcessor.files()[1].size(), 10);
+    ASSERT_NO_THROW(corruptedProcessor.unpack(targetPath / "small.txt", corruptedProcessor.files()[1]));
+    ASSERT_THROW(corruptedProcessor.unpack(targetPath / "big.bin", corruptedProcessor.files()[0]), std::runtime_error);
+
+    // Corrupted blocks are not copied to new package
+    ASSERT_THROW(corruptedProcessor.write(targetPath / "recorrupted.hgpackage"), std::runtime_error);
+}
+
+TEST(PackageProcessorLibrary, MultithreadedWriting)
+{
+    auto targetPath      = std::filesystem::current_path() / "PackageResults" / "Jobs";
+    auto pathToResources = std::filesystem::absolute("PackageResources");
+
+    std::vector<std::string> packages;
+
+    for (std::size_t jobs : {1, 4})
+    {
+        HG::Tools::PackageProcessor packageProcessor;
+
+        packageProcessor.setNumberOfJobs(jobs);
+        packageProcessor.setPackageRoot(pathToResources);
+
+        recursiveAddFile(packageProcessor, pathToResources);
+
+        auto pathToPackage = targetPath / ("package" + std::to_string(jobs) + ".hgpackage");
+
+        std::filesystem::create_directories(targetPath);
+
+        ASSERT_NO_THROW(packageProcessor.write(pathToPackage));
+
+        std::ifstream package(pathToPackage, std::ios::binary);
+        packages.emplace_back(std::istreambuf_iterator<char>(package), std::istreambuf_iterator<char>());
+
+        packageProcessor.clear();
+
+        ASSERT_NO_THROW(packageProcessor.load(pathToPackage));
+        ASSERT_NO_THROW(packageProcessor.unpack(targetPath / ("Unpacked" + std::to_string(jobs))));
+    }
+
+    // Output does not depend on number of threads
+    ASSERT_EQ(packages[0], packages[1]);
+
+    ASSERT_THROW(HG::Tools::PackageProcessor().setNumberOfJobs(0), std::invalid_argument);
+}
+
+TEST(PackageProcessorLibrary, BuildCacheAndDeduplication)
+{
+    auto targetPath      = std::filesystem::current_path() / "PackageResults" / "Cache";
+    auto pathToResources = targetPath / "Resources";
+    auto pathToPackage   = targetPath / "package.hgpackage";
+
+    std::filesystem::create_directories(pathToResources / "copy");
+
+    std::string data(100 * 1024, '\0');
+
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i % 13);
+    }
+
+    std::ofstream(pathToResources / "data.bin", std::ios::binary) << data;
+    std::ofstream(pathToResources / "copy" / "data.bin", std::ios::binary) << data;
+    std::ofstream(pathToResources / "changed.txt", std::ios::binary) << "First version";
+
+    auto build = [&]() {
+        HG::Tools::PackageProcessor packageProcessor;
+
+        packageProcessor.setNumberOfJobs(2);
+        packageProcessor.setBuildCache(pathToPackage);
+        packageProcessor.setPackageRoot(pathToResources);
+        packageProcessor.addFile(pathToResources / "data.bin");
+        packageProcessor.addFile(pathToResources / "copy" / "data.bin");
+        packageProcessor.addFile(pathToResources / "changed.txt");
+
+        packageProcessor.write(pathToPackage);
+
+        return packageProcessor.statistics();
+    };
+
+    // First build compresses unique content only
+    auto statistics = build();
+
+    ASSERT_EQ(statistics.reusedBytes, 0);
+    ASSERT_EQ(statistics.recompressedBytes, data.size() + 13);
+    ASSERT_EQ(statistics.deduplicatedBytes, data.size());
+
+    HG::Tools::PackageProcessor packageProcessor;
+
+    ASSERT_NO_THROW(packageProcessor.load(pathToPackage));
+    ASSERT_EQ(packageProcessor.files().size(), 3);
+    ASSERT_EQ(packageProcessor.files()[0].compressedOffset(), packageProcessor.files()[1].compressedOffset());
+    ASSERT_EQ(packageProcessor.files()[0].contentHash(), packageProcessor.files()[1].contentHash());
+    ASSERT_NE(packageProcessor.files()[0].contentHash(), 0);
+
+    // Second build reuses data of unchanged files
+    std::ofstream(pathToResources / "changed.txt", std::ios::binary) << "Second version";
+
+    statistics = build();
+
+    ASSERT_EQ(statistics.reusedBytes, data.size());
+    ASSERT_EQ(statistics.recompressedBytes, 14);
+    ASSERT_EQ(statistics.deduplicatedBytes, data.size());
+
+    packageProcessor.clear();
+
+    ASSERT_NO_THROW(packageProcessor.load(pathToPackage));
+    ASSERT_NO_THROW(packageProcessor.unpack(targetPath / "Unpacked"));
+
+    std::ifstream copy(targetPath / "Unpacked" / "copy" / "data.bin", std::ios::binary);
+    ASSERT_EQ(std::string(std::istreambuf_iterator<char>(copy), {}), data);
+
+    std::ifstream changed(targetPath / "Unpacked" / "changed.txt", std::ios::binary);
+    ASSERT_EQ(std::string(std::istreambuf_iterator<char>(changed), {}), "Second version");
+    changed.close();
+
+    ASSERT_FALSE(std::filesystem::exists(targetPath / "package.hgpackage.tmp"));
+
+    // Corrupted cache blocks are compressed again
+    {
+        std::fstream package(pathToPackage, std::ios::binary | std::ios::in | std::ios::out);
+        package.seekp(packageProcessor.files()[0].blocks().front().offset);
+        package.put('\xFF');
+    }
+
+    statistics = build();
+
+    ASSERT_EQ(statistics.reusedBytes, 14);
+    ASSERT_EQ(statistics.recompressedBytes, data.size());
+    ASSERT_EQ(statistics.deduplicatedBytes, data.size());
+
+    packageProcessor.clear();
+
+    ASSERT_NO_THROW(packageProcessor.load(pathToPackage));
+    ASSERT_NO_THROW(packageProcessor.unpack(targetPath / "Recompressed"));
+
+    std::ifstream recompressed(targetPath / "Recompressed" / "data.bin", std::ios::binary);
+    ASSERT_EQ(std::string(std::istreambuf_iterator<char>(recompressed), {}), data);
+}
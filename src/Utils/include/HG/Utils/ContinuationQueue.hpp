@@ -0,0 +1,57 @@
+#pragma once
+
+// C++ STL
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace HG::Utils
+{
+/**
+ * @brief Class, that describes thread safe queue of
+ * continuations, that has to be executed in specific thread.
+ * For example HG::Core::Application executes
+ * it's main thread queue once per frame.
+ */
+class ContinuationQueue
+{
+public:
+    using Continuation = std::function<void()>;
+
+    /**
+     * @brief Constructor.
+     */
+    ContinuationQueue();
+
+    // Disable copying
+    ContinuationQueue(const ContinuationQueue&) = delete;
+    ContinuationQueue& operator=(const ContinuationQueue&) = delete;
+
+    /**
+     * @brief Method for pushing continuation into queue.
+     * Can be called from any thread.
+     * @param continuation Continuation.
+     */
+    void push(Continuation continuation);
+
+    /**
+     * @brief Method for executing all continuations, that
+     * was pushed before this call. Continuations, pushed
+     * while executing, will be executed on next call.
+     * Exceptions, thrown by continuations are logged.
+     * @return Number of executed continuations.
+     */
+    std::size_t execute();
+
+    /**
+     * @brief Method for getting number of continuations,
+     * waiting for execution.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<Continuation> m_continuations;
+    std::vector<Continuation> m_executing;
+};
+} // namespace HG::Utils
@@ -1,10 +1,12 @@
 #pragma once
 
 // C++ STL
-#include <algorithm> // std::find, std::remove
-#include <queue>
+#include <algorithm> // std::remove_if
+#include <cstdint>
+#include <functional> // std::hash
 #include <stdexcept>
 #include <string> // std::to_string
+#include <unordered_map>
 #include <vector>
 
 namespace HG::Utils
@@ -12,9 +14,16 @@ namespace HG::Utils
 /**
  * @brief Class, controlling unique elements merging.
  * Shall be used in GameObject, Scene and GameObjectController.
- * @todo: Make ContainerType = std::set
+ *
+ * State of every element (current, added or removing)
+ * is kept in hash table, so `add`, `remove` and
+ * `isRemoving` are O(1) and `merge` removes all
+ * elements in one pass. Order of current elements
+ * is kept. Elements are copied into hash table, so
+ * they have to be cheap to copy (pointers, ids) and
+ * must not be changed while they are in container.
  */
-template <typename T, typename ContainerType = std::vector<T>>
+template <typename T, typename ContainerType = std::vector<T>, typename HashType = std::hash<T>>
 class DoubleBufferContainer
 {
 public:
@@ -27,7 +36,7 @@ public:
      * @brief Default constructor creates no elements.
      * @return
      */
-    DoubleBufferContainer() : m_removable(), m_added(), m_current()
+    DoubleBufferContainer() : m_removable(), m_added(), m_current(), m_states()
     {
     }
 
@@ -35,10 +44,11 @@ public:
      * @brief Copy constructor. It's copying states.
      * @param container Copying object.
      */
-    DoubleBufferContainer(const DoubleBufferContainer<T, ContainerType>& container) :
+    DoubleBufferContainer(const DoubleBufferContainer<T, ContainerType, HashType>& container) :
         m_removable(container.m_removable),
         m_added(container.m_added),
-        m_current(container.m_current)
+        m_current(container.m_current),
+        m_states(container.m_states)
     {
     }
 
@@ -46,10 +56,11 @@ public:
      * @brief Move constructor. It's just moving container data.
      * @param container Movable container.
      */
-    DoubleBufferContainer(DoubleBufferContainer<T, ContainerType>&& container) :
+    DoubleBufferContainer(DoubleBufferContainer<T, ContainerType, HashType>&& container) :
         m_removable(std::move(container.m_removable)),
         m_added(std::move(container.m_added)),
-        m_current(std::move(container.m_current))
+        m_current(std::move(container.m_current)),
+        m_states(std::move(container.m_states))
     {
     }
 
@@ -66,15 +77,27 @@ public:
      */
     void add(T e)
     {
-        if (std::find(m_added.begin(), m_added.end(), e) != m_added.end())
-            return;
+        auto& state = m_states[e];
 
-        if (std::find(m_current.begin(), m_current.end(), e) != m_current.end())
+        if (state & (State::Current | State::Added))
             return;
 
+        state |= State::Added;
+
         m_added.emplace_back(std::move(e));
     }
 
+    /**
+     * @brief Method for reserving space for
+     * elements, that will be added.
+     * @param count Number of added elements.
+     */
+    void reserve(size_type count)
+    {
+        m_added.reserve(m_added.size() + count);
+        m_states.reserve(m_states.size() + count);
+    }
+
     /**
      * @brief Adding element to removable queue. It will remove
      * new elements from add queue and from current queue after merge.
@@ -82,13 +105,13 @@ public:
      */
     void remove(T e)
     {
+        auto& state = m_states[e];
+
         // Dont add to removable if already added
-        if ((std::find(m_added.begin(), m_added.end(), e) == m_added.end() ||
-             std::find(m_current.begin(), m_current.end(), e) == m_current.end()) &&
-            std::find(m_removable.begin(), m_removable.end(), e) != m_removable.end())
-        {
+        if (state & State::Removing)
             return;
-        }
+
+        state |= State::Removing;
 
         m_removable.emplace_back(std::move(e));
     }
@@ -99,46 +122,93 @@ public:
      * @param e Element.
      * @return Is it's removing now?
      */
-    [[nodiscard]] bool isRemoving(T e) const
+    [[nodiscard]] bool isRemoving(const T& e) const
     {
-        return std::find(m_removable.begin(), m_removable.end(), e) != m_removable.end();
+        auto iterator = m_states.find(e);
+
+        return iterator != m_states.end() && (iterator->second & State::Removing);
     }
 
     /**
      * @brief Method to merge all elements. At the beginning it will
-     * remove elements from add queue and from current elements container.
+     * remove elements from current elements container in one pass.
      * After that left new elements will be added to current elements container.
      */
     void merge()
     {
-        // Removing elements from new one and from current
-        typename container::iterator addedNewEndIterator   = m_added.end();
-        typename container::iterator currentNewEndIterator = m_current.end();
-
-        for (auto&& el : m_removable)
+        if (!m_removable.empty())
         {
-            addedNewEndIterator   = std::remove(m_added.begin(), addedNewEndIterator, el);
-            currentNewEndIterator = std::remove(m_current.begin(), currentNewEndIterator, el);
+            m_current.erase(std::remove_if(m_current.begin(),
+                                           m_current.end(),
+                                           [this](const T& element) { return isRemoving(element); }),
+                            m_current.end());
         }
 
-        m_added.erase(addedNewEndIterator, m_added.end());
-        m_current.erase(currentNewEndIterator, m_current.end());
-
         // Adding new elements to current
         for (auto&& el : m_added)
         {
+            auto& state = m_states.find(el)->second;
+
+            if (state & State::Removing)
+            {
+                continue;
+            }
+
+            state = State::Current;
+
             m_current.emplace_back(std::move(el));
         }
 
+        // Removed elements are not stored anywhere now
+        for (auto&& el : m_removable)
+        {
+            m_states.erase(el);
+        }
+
         m_added.clear();
         m_removable.clear();
     }
 
+    /**
+     * @brief Method to apply only removals. Removing elements
+     * are removed from current elements container and add
+     * queue, other new elements are kept in add queue until merge.
+     */
+    void mergeRemovable()
+    {
+        if (m_removable.empty())
+        {
+            return;
+        }
+
+        auto removing = [this](const T& element) { return isRemoving(element); };
+
+        m_current.erase(std::remove_if(m_current.begin(), m_current.end(), removing), m_current.end());
+        m_added.erase(std::remove_if(m_added.begin(), m_added.end(), removing), m_added.end());
+
+        for (auto&& el : m_removable)
+        {
+            m_states.erase(el);
+        }
+
+        m_removable.clear();
+    }
+
     /**
      * @brief Method to clear added and removed queues.
      */
     void clearState()
     {
+        for (auto&& el : m_added)
+        {
+            resetState(el, State::Added);
+        }
+
+        for (auto&& el : m_removable)
+        {
+            resetState(el, State::Removing);
+        }
+
         m_removable.clear();
         m_added.clear();
     }
@@ -151,6 +221,7 @@ public:
         m_added.clear();
         m_current.clear();
         m_removable.clear();
+        m_states.clear();
     }
 
     /**
@@ -158,11 +229,12 @@ public:
      * @param rhs Right hand container.
      * @return Reference to this container.
      */
-    DoubleBufferContainer<T, ContainerType>& operator=(const DoubleBufferContainer<T, ContainerType>& rhs)
+    DoubleBufferContainer<T, ContainerType, HashType>& operator=(const DoubleBufferContainer<T, ContainerType, HashType>& rhs)
     {
         m_current   = rhs.m_current;
         m_removable = rhs.m_removable;
         m_added     = rhs.m_added;
+        m_states    = rhs.m_states;
 
         return *this;
     };
@@ -172,11 +244,12 @@ public:
      * @param rhs Right hand container.
      * @return Reference to this container.
      */
-    DoubleBufferContainer<T, ContainerType>& operator=(DoubleBufferContainer<T, ContainerType>&& rhs)
+    DoubleBufferContainer<T, ContainerType, HashType>& operator=(DoubleBufferContainer<T, ContainerType, HashType>&& rhs)
     {
         m_current   = std::move(rhs.m_current);
         m_removable = std::move(rhs.m_removable);
         m_added     = std::move(rhs.m_added);
+        m_states    = std::move(rhs.m_states);
 
         return *this;
     };
@@ -225,31 +298,16 @@ public:
         return m_removable;
     }
 
-    [[nodiscard]] container& removable()
-    {
-        return m_removable;
-    }
-
     [[nodiscard]] const container& added() const
     {
         return m_added;
     }
 
-    [[nodiscard]] container& added()
-    {
-        return m_added;
-    }
-
     [[nodiscard]] const container& current() const
     {
         return m_current;
     }
 
-    [[nodiscard]] container& current()
-    {
-        return m_current;
-    }
-
     iterator begin()
     {
         return m_current.begin();
@@ -281,8 +339,36 @@ public:
     }
 
 private:
+    /**
+     * @brief Element state flags.
+     */
+    enum State : std::uint8_t
+    {
+        Current  = 1u << 0u,
+        Added    = 1u << 1u,
+        Removing = 1u << 2u
+    };
+
+    /**
+     * @brief Method for resetting element state flag.
+     * Element is forgotten, if it has no state.
+     */
+    void resetState(const T& e, std::uint8_t flag)
+    {
+        auto iterator = m_states.find(e);
+
+        iterator->second &= static_cast<std::uint8_t>(~flag);
+
+        if (iterator->second == 0)
+        {
+            m_states.erase(iterator);
+        }
+    }
+
     container m_removable;
     container m_added;
     container m_current;
+
+    std::unordered_map<T, std::uint8_t, HashType> m_states;
 };
 } // namespace HG::Utils
@@ -1,25 +1,39 @@
 #pragma once
 
 // C++ STL
-#include <future>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// HG::Utils
+#include <HG/Utils/ContinuationQueue.hpp>
+#include <HG/Utils/FutureState.hpp>
 
 namespace HG::Utils
 {
 /**
- * @brief Class, that overlaps stl's future
- * object for more easily access to future data.
+ * @brief Class, that provides easy access to
+ * result of asynchronous operation, set by
+ * HG::Utils::Promise. Checking result readiness
+ * is lock free, so `get` can be called every frame.
+ * Results can be chained with `then` method.
  * @tparam ResultType Result type.
  */
 template <typename ResultType>
 class FutureHandler
 {
 public:
+    using State = FutureState<ResultType>;
+
     /**
      * @brief Initializer constructor.
-     * @param future Future.
+     * @param state Shared state.
      */
-    FutureHandler(std::shared_future<ResultType> future) : m_predefinedValue(), m_future(std::move(future))
+    template <typename StateType, typename = std::enable_if_t<std::is_same_v<StateType, State>>>
+    explicit FutureHandler(std::shared_ptr<StateType> state) : m_predefinedValue(), m_state(std::move(state))
     {
     }
 
@@ -28,7 +42,7 @@ public:
      */
     FutureHandler(FutureHandler<ResultType>&& rhs) noexcept :
         m_predefinedValue(std::move(rhs.m_predefinedValue)),
-        m_future(std::move(rhs.m_future))
+        m_state(std::move(rhs.m_state))
     {
     }
 
@@ -37,7 +51,7 @@ public:
      */
     FutureHandler<ResultType>& operator=(FutureHandler<ResultType>&& rhs) noexcept
     {
-        m_future          = std::move(rhs.m_future);
+        m_state           = std::move(rhs.m_state);
         m_predefinedValue = std::move(rhs.m_predefinedValue);
 
         return (*this);
@@ -48,7 +62,7 @@ public:
      */
     FutureHandler(const FutureHandler<ResultType>& rhs) :
         m_predefinedValue(rhs.m_predefinedValue),
-        m_future(rhs.m_future)
+        m_state(rhs.m_state)
     {
     }
 
@@ -57,7 +71,7 @@ public:
      */
     FutureHandler<ResultType>& operator=(const FutureHandler<ResultType>& rhs)
     {
-        m_future          = rhs.m_future;
+        m_state           = rhs.m_state;
         m_predefinedValue = rhs.m_predefinedValue;
 
         return (*this);
@@ -69,24 +83,30 @@ public:
      * pass value back.
      * @param result Result.
      */
-    FutureHandler(ResultType result) : m_predefinedValue(std::move(result)), m_future()
+    FutureHandler(ResultType result) : m_predefinedValue(std::move(result)), m_state()
     {
     }
 
     /**
-     * @brief Method for getting result type.
+     * @brief Method for checking is result available.
+     */
+    [[nodiscard]] bool isReady() const
+    {
+        return m_state == nullptr || m_state->isReady();
+    }
+
+    /**
+     * @brief Method for getting result without
+     * blocking. If result is not ready yet - default
+     * value will be returned. If operation failed -
+     * it's exception will be rethrown.
      * @return Result type.
      */
     ResultType get()
     {
-        if (m_future.valid())
+        if (m_state != nullptr && m_state->isReady())
         {
-            // We need future status as soon as possible
-            // so just wait no time
-            if (m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-            {
-                m_predefinedValue = std::move(m_future.get());
-            }
+            takeResult();
         }
 
         return m_predefinedValue;
@@ -99,14 +119,95 @@ public:
      */
     ResultType guaranteeGet()
     {
-        if (m_future.valid())
+        if (m_state != nullptr)
         {
-            m_predefinedValue = std::move(m_future.get());
+            m_state->wait();
+
+            takeResult();
         }
 
         return m_predefinedValue;
     }
 
+    /**
+     * @brief Method for chaining function, that will be executed
+     * with result, when it will be ready. If result is already
+     * available - function is executed (or queued) immediately.
+     * If operation failed - function is not executed and exception
+     * is passed to returned handler.
+     * @tparam FunctionType Function type with `Type(ResultType)` signature.
+     * @param function Function.
+     * @param queue Queue, where function has to be executed. If
+     * `nullptr` - function is executed in thread, that sets result.
+     * @return If function return type is non void -
+     * HG::Utils::FutureHandler< function_result_type > will be
+     * returned. Otherwise void will be returned.
+     */
+    template <typename FunctionType>
+    typename std::conditional<std::is_void<typename std::invoke_result<FunctionType, ResultType>::type>::value,
+
+                              void,
+
+                              FutureHandler<typename std::invoke_result<FunctionType, ResultType>::type>>::type
+    then(FunctionType function, ContinuationQueue* queue = nullptr)
+    {
+        using NextType              = typename std::invoke_result<FunctionType, ResultType>::type;
+        constexpr bool IsResultVoid = std::is_void<NextType>::value;
+
+        // Next state is not used by void continuations
+        using NextState = FutureState<typename std::conditional<IsResultVoid, bool, NextType>::type>;
+
+        auto nextState = IsResultVoid ? nullptr : std::make_shared<NextState>();
+
+        source()->addContinuation([nextState, function = std::move(function), queue](State& state) mutable {
+            auto execute = [nextState, function = std::move(function)](const ResultType& value,
+                                                                          std::exception_ptr exception) mutable {
+                if (exception != nullptr)
+                {
+                    if constexpr (!IsResultVoid)
+                    {
+                        nextState->setException(std::move(exception));
+                    }
+
+                    return;
+                }
+
+                if constexpr (IsResultVoid)
+                {
+                    function(value);
+                }
+                else
+                {
+                    try
+                    {
+                        nextState->setValue(function(value));
+                    }
+                    catch (...)
+                    {
+                        nextState->setException(std::current_exception());
+                    }
+                }
+            };
+
+            if (queue == nullptr)
+            {
+                execute(state.hasException() ? ResultType() : state.value(), state.exception());
+                return;
+            }
+
+            // State may be destroyed before queue execution,
+            // so result is copied
+            queue->push([execute   = std::move(execute),
+                         value     = state.hasException() ? ResultType() : state.value(),
+                         exception = state.exception()]() mutable { execute(value, exception); });
+        });
+
+        if constexpr (!IsResultVoid)
+        {
+            return FutureHandler<NextType>(std::move(nextState));
+        }
+    }
+
     /**
      * @brief Method for casting future to result type.
      */
@@ -125,7 +226,232 @@ public:
     }
 
 private:
+    template <typename Type>
+    friend FutureHandler<std::vector<Type>> whenAll(std::vector<FutureHandler<Type>> handlers);
+
+    template <typename Type>
+    friend FutureHandler<std::size_t> whenAny(std::vector<FutureHandler<Type>> handlers);
+
+    /**
+     * @brief Method for taking result from ready
+     * state. State is released after that.
+     */
+    void takeResult()
+    {
+        m_predefinedValue = m_state->value();
+
+        m_state = nullptr;
+    }
+
+    /**
+     * @brief Method for getting state, continuations
+     * can be added to. Predefined value is wrapped to
+     * ready state.
+     */
+    std::shared_ptr<State> source() const
+    {
+        if (m_state != nullptr)
+        {
+            return m_state;
+        }
+
+        auto state = std::make_shared<State>();
+        state->setValue(m_predefinedValue);
+
+        return state;
+    }
+
     ResultType m_predefinedValue;
-    std::shared_future<ResultType> m_future;
+    std::shared_ptr<State> m_state;
+};
+
+/**
+ * @brief Class, that describes producer side of
+ * HG::Utils::FutureHandler. If promise is destroyed
+ * without result, handlers will receive
+ * `std::runtime_error` exception.
+ * @tparam ResultType Result type.
+ */
+template <typename ResultType>
+class Promise
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Promise() : m_state(std::make_shared<FutureState<ResultType>>())
+    {
+    }
+
+    /**
+     * @brief Move constructor.
+     */
+    Promise(Promise<ResultType>&& rhs) noexcept : m_state(std::move(rhs.m_state))
+    {
+    }
+
+    /**
+     * @brief Move operator.
+     */
+    Promise<ResultType>& operator=(Promise<ResultType>&& rhs) noexcept
+    {
+        abandon();
+
+        m_state = std::move(rhs.m_state);
+
+        return (*this);
+    }
+
+    // Disable copying
+    Promise(const Promise&) = delete;
+    Promise& operator=(const Promise&) = delete;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Promise()
+    {
+        abandon();
+    }
+
+    /**
+     * @brief Method for getting handler for
+     * promised result.
+     */
+    [[nodiscard]] FutureHandler<ResultType> handler() const
+    {
+        return FutureHandler<ResultType>(m_state);
+    }
+
+    /**
+     * @brief Method for setting result. Can throw
+     * `std::runtime_error` if result was already set.
+     * @param value Result.
+     */
+    void setValue(ResultType value)
+    {
+        m_state->setValue(std::move(value));
+    }
+
+    /**
+     * @brief Method for setting exception instead of result.
+     * Can throw `std::runtime_error` if result was already set.
+     * @param exception Exception.
+     */
+    void setException(std::exception_ptr exception)
+    {
+        m_state->setException(std::move(exception));
+    }
+
+private:
+    void abandon()
+    {
+        if (m_state != nullptr && !m_state->isReady())
+        {
+            m_state->setException(std::make_exception_ptr(std::runtime_error("Promise was destroyed without result.")));
+        }
+    }
+
+    std::shared_ptr<FutureState<ResultType>> m_state;
 };
+
+/**
+ * @brief Function for combining several handlers into
+ * one, that will be ready after all of them. If any of
+ * operations fails - first exception is passed to
+ * resulting handler.
+ * @tparam ResultType Result type.
+ * @param handlers Handlers.
+ * @return Handler with results in handlers order.
+ */
+template <typename ResultType>
+FutureHandler<std::vector<ResultType>> whenAll(std::vector<FutureHandler<ResultType>> handlers)
+{
+    struct Shared
+    {
+        std::vector<ResultType> results;
+        std::atomic_size_t remaining;
+        std::atomic_bool failed;
+        Promise<std::vector<ResultType>> promise;
+    };
+
+    auto shared = std::make_shared<Shared>();
+
+    auto handler = shared->promise.handler();
+
+    if (handlers.empty())
+    {
+        shared->promise.setValue({});
+        return handler;
+    }
+
+    shared->results.resize(handlers.size());
+    shared->remaining = handlers.size();
+    shared->failed    = false;
+
+    for (std::size_t index = 0; index < handlers.size(); ++index)
+    {
+        handlers[index].source()->addContinuation([shared, index](FutureState<ResultType>& state) {
+            if (state.hasException())
+            {
+                if (!shared->failed.exchange(true))
+                {
+                    shared->promise.setException(state.exception());
+                }
+            }
+            else
+            {
+                shared->results[index] = state.value();
+            }
+
+            if (--shared->remaining == 0 && !shared->failed)
+            {
+                shared->promise.setValue(std::move(shared->results));
+            }
+        });
+    }
+
+    return handler;
+}
+
+/**
+ * @brief Function for combining several handlers into
+ * one, that will be ready after any of them. Can throw
+ * `std::invalid_argument` if there is no handlers.
+ * @tparam ResultType Result type.
+ * @param handlers Handlers.
+ * @return Handler with index of first ready handler.
+ */
+template <typename ResultType>
+FutureHandler<std::size_t> whenAny(std::vector<FutureHandler<ResultType>> handlers)
+{
+    if (handlers.empty())
+    {
+        throw std::invalid_argument("Can't wait for any of 0 handlers.");
+    }
+
+    struct Shared
+    {
+        std::atomic_bool finished;
+        Promise<std::size_t> promise;
+    };
+
+    auto shared = std::make_shared<Shared>();
+
+    shared->finished = false;
+
+    auto handler = shared->promise.handler();
+
+    for (std::size_t index = 0; index < handlers.size(); ++index)
+    {
+        handlers[index].source()->addContinuation([shared, index](FutureState<ResultType>&) {
+            if (!shared->finished.exchange(true))
+            {
+                shared->promise.setValue(index);
+            }
+        });
+    }
+
+    return handler;
+}
 } // namespace HG::Utils
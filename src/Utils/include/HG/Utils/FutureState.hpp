@@ -0,0 +1,200 @@
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace HG::Utils
+{
+/**
+ * @brief Class, that describes shared state between
+ * HG::Utils::Promise and HG::Utils::FutureHandler.
+ * Readiness is checked with single atomic load, mutex
+ * is used only for satisfying state, adding
+ * continuations and blocking waiting.
+ * @tparam ResultType Result type.
+ */
+template <typename ResultType>
+class FutureState
+{
+public:
+    using Continuation = std::function<void(FutureState<ResultType>&)>;
+
+    /**
+     * @brief Constructor.
+     */
+    FutureState() :
+        m_ready(false),
+        m_satisfied(false),
+        m_value(),
+        m_exception(),
+        m_mutex(),
+        m_notifier(),
+        m_continuations()
+    {
+    }
+
+    // Disable copying
+    FutureState(const FutureState&) = delete;
+    FutureState& operator=(const FutureState&) = delete;
+
+    /**
+     * @brief Method for checking is value or
+     * exception was set.
+     */
+    [[nodiscard]] bool isReady() const
+    {
+        return m_ready.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Method for checking is state was
+     * satisfied with exception. State has to be ready.
+     */
+    [[nodiscard]] bool hasException() const
+    {
+        return m_exception != nullptr;
+    }
+
+    /**
+     * @brief Method for getting exception. State
+     * has to be ready.
+     */
+    [[nodiscard]] std::exception_ptr exception() const
+    {
+        return m_exception;
+    }
+
+    /**
+     * @brief Method for getting value. State has to be
+     * ready. If state was satisfied with exception -
+     * it will be rethrown.
+     */
+    [[nodiscard]] const ResultType& value() const
+    {
+        if (m_exception != nullptr)
+        {
+            std::rethrow_exception(m_exception);
+        }
+
+        return *m_value;
+    }
+
+    /**
+     * @brief Method for satisfying state with value.
+     * Can throw `std::runtime_error` if state was
+     * already satisfied.
+     * @param value Value.
+     */
+    void setValue(ResultType value)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        satisfy();
+
+        m_value = std::move(value);
+
+        complete(lock);
+    }
+
+    /**
+     * @brief Method for satisfying state with exception.
+     * Can throw `std::runtime_error` if state was
+     * already satisfied.
+     * @param exception Exception.
+     */
+    void setException(std::exception_ptr exception)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        satisfy();
+
+        m_exception = std::move(exception);
+
+        complete(lock);
+    }
+
+    /**
+     * @brief Method for blocking calling thread
+     * until state will be ready.
+     */
+    void wait()
+    {
+        if (isReady())
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_notifier.wait(lock, [this]() { return isReady(); });
+    }
+
+    /**
+     * @brief Method for adding continuation, that will be
+     * executed in thread, that satisfies state. If state
+     * is already ready - continuation is executed immediately
+     * in calling thread.
+     * @param continuation Continuation.
+     */
+    void addContinuation(Continuation continuation)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (!isReady())
+            {
+                m_continuations.push_back(std::move(continuation));
+                return;
+            }
+        }
+
+        continuation(*this);
+    }
+
+private:
+    void satisfy()
+    {
+        if (m_satisfied)
+        {
+            throw std::runtime_error("Future state is already satisfied.");
+        }
+
+        m_satisfied = true;
+    }
+
+    void complete(std::unique_lock<std::mutex>& lock)
+    {
+        auto continuations = std::move(m_continuations);
+        m_continuations.clear();
+
+        m_ready.store(true, std::memory_order_release);
+
+        m_notifier.notify_all();
+
+        lock.unlock();
+
+        for (auto&& continuation : continuations)
+        {
+            continuation(*this);
+        }
+    }
+
+    std::atomic_bool m_ready;
+    bool m_satisfied;
+
+    std::optional<ResultType> m_value;
+    std::exception_ptr m_exception;
+
+    std::mutex m_mutex;
+    std::condition_variable m_notifier;
+    std::vector<Continuation> m_continuations;
+};
+} // namespace HG::Utils
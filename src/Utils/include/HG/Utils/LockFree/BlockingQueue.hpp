@@ -0,0 +1,201 @@
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace HG::Utils::LockFree
+{
+/**
+ * @brief Class, that adds blocking waiting to one of
+ * lock free queues. Fast path is lock free, mutex is
+ * locked only if queue is full or empty and some
+ * thread has to sleep or has to be woken up.
+ *
+ * Sample usage:
+ * ```cpp
+ * HG::Utils::LockFree::BlockingQueue<HG::Utils::LockFree::MPSCQueue<Message>> messages(1024);
+ * ```
+ * @tparam QueueType Queue type. (SPSCQueue, MPSCQueue or MPMCQueue)
+ */
+template <typename QueueType>
+class BlockingQueue
+{
+public:
+    using ValueType = typename QueueType::ValueType;
+
+    /**
+     * @brief Constructor.
+     * Can throw `std::invalid_argument` if capacity is 0.
+     * @param capacity Queue capacity.
+     */
+    explicit BlockingQueue(std::size_t capacity) :
+        m_queue(capacity),
+        m_mutex(),
+        m_notEmpty(),
+        m_notFull(),
+        m_emptyWaiters(0),
+        m_fullWaiters(0)
+    {
+    }
+
+    // Disable copying
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    /**
+     * @brief Method for pushing value without blocking.
+     * @param value Value.
+     * @return `false` if queue is full.
+     */
+    bool tryPush(ValueType&& value)
+    {
+        if (!m_queue.tryPush(std::move(value)))
+        {
+            return false;
+        }
+
+        notify(m_emptyWaiters, m_notEmpty);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for pushing value. Blocks
+     * calling thread while queue is full.
+     * @param value Value.
+     */
+    void push(ValueType value)
+    {
+        if (m_queue.tryPush(std::move(value)))
+        {
+            notify(m_emptyWaiters, m_notEmpty);
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_fullWaiters.fetch_add(1, std::memory_order_acq_rel);
+
+            m_notFull.wait(lock, [this, &value]() { return m_queue.tryPush(std::move(value)); });
+
+            --m_fullWaiters;
+        }
+
+        notify(m_emptyWaiters, m_notEmpty);
+    }
+
+    /**
+     * @brief Method for popping value without blocking.
+     * @param result Popped value.
+     * @return `false` if queue is empty.
+     */
+    bool tryPop(ValueType& result)
+    {
+        if (!m_queue.tryPop(result))
+        {
+            return false;
+        }
+
+        notify(m_fullWaiters, m_notFull);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for popping value. Blocks calling
+     * thread while queue is empty.
+     * @param result Popped value.
+     */
+    void pop(ValueType& result)
+    {
+        if (!m_queue.tryPop(result))
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_emptyWaiters.fetch_add(1, std::memory_order_acq_rel);
+
+            m_notEmpty.wait(lock, [this, &result]() { return m_queue.tryPop(result); });
+
+            --m_emptyWaiters;
+        }
+
+        notify(m_fullWaiters, m_notFull);
+    }
+
+    /**
+     * @brief Method for popping value. Blocks calling
+     * thread while queue is empty, but not longer, than
+     * specified timeout.
+     * @param result Popped value.
+     * @param timeout Timeout.
+     * @return `false` if timeout expired.
+     */
+    template <typename Rep, typename Period>
+    bool popFor(ValueType& result, std::chrono::duration<Rep, Period> timeout)
+    {
+        if (!m_queue.tryPop(result))
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_emptyWaiters.fetch_add(1, std::memory_order_acq_rel);
+
+            auto popped = m_notEmpty.wait_for(lock, timeout, [this, &result]() { return m_queue.tryPop(result); });
+
+            --m_emptyWaiters;
+
+            if (!popped)
+            {
+                return false;
+            }
+        }
+
+        notify(m_fullWaiters, m_notFull);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for getting underlying queue.
+     * Pushing or popping values directly will not
+     * wake up waiting threads.
+     */
+    QueueType& queue()
+    {
+        return m_queue;
+    }
+
+private:
+    /**
+     * @brief Method for waking up waiting thread, if there is any.
+     * Waiters counter is incremented before checking queue, so
+     * there is no lost wakeups. Counter is read with RMW, because
+     * RMWs of one atomic are totally ordered: either waiter is
+     * seen here, or waiter's increment reads this RMW and sees
+     * changed queue.
+     */
+    void notify(std::atomic_size_t& waiters, std::condition_variable& notifier)
+    {
+        if (waiters.fetch_add(0, std::memory_order_acq_rel) == 0)
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        notifier.notify_one();
+    }
+
+    QueueType m_queue;
+
+    std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+
+    std::atomic_size_t m_emptyWaiters;
+    std::atomic_size_t m_fullWaiters;
+};
+} // namespace HG::Utils::LockFree
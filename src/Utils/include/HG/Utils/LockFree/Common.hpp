@@ -0,0 +1,39 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+#include <stdexcept>
+
+namespace HG::Utils::LockFree
+{
+/**
+ * @brief Size of cache line, used for padding of indices,
+ * that are modified by different threads. (To prevent
+ * false sharing)
+ */
+constexpr std::size_t CacheLineSize = 64;
+
+/**
+ * @brief Function for calculating ring buffer capacity.
+ * Can throw `std::invalid_argument` if capacity is 0.
+ * @param capacity Requested capacity.
+ * @return Lowest power of 2, that's not lower than
+ * requested capacity.
+ */
+inline std::size_t ringCapacity(std::size_t capacity)
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument("Queue capacity can't be 0.");
+    }
+
+    std::size_t result = 1;
+
+    while (result < capacity)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+} // namespace HG::Utils::LockFree
@@ -0,0 +1,232 @@
+#pragma once
+
+// C++ STL
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// HG::Utils
+#include <HG/Utils/LockFree/Common.hpp>
+
+namespace HG::Utils::LockFree
+{
+/**
+ * @brief Class, that describes bounded lock free queue
+ * for multiple producer and multiple consumer threads.
+ * Every cell has sequence number, that shows is cell
+ * ready for writing or reading on current lap, so
+ * producers and consumers synchronize only on cells
+ * and their own index.
+ * @tparam T Value type. Has to be default constructible
+ * and move assignable.
+ */
+template <typename T>
+class MPMCQueue
+{
+public:
+    using ValueType = T;
+
+    /**
+     * @brief Constructor.
+     * Can throw `std::invalid_argument` if capacity is 0.
+     * @param capacity Queue capacity. It's rounded up
+     * to power of 2.
+     */
+    explicit MPMCQueue(std::size_t capacity) :
+        m_capacity(ringCapacity(capacity)),
+        m_mask(m_capacity - 1),
+        m_buffer(new Cell[m_capacity]),
+        m_enqueuePosition(0),
+        m_dequeuePosition(0)
+    {
+        for (std::size_t index = 0; index < m_capacity; ++index)
+        {
+            m_buffer[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    // Disable copying
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * @brief Method for getting queue capacity.
+     */
+    [[nodiscard]] std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Method for pushing value.
+     * @param value Value.
+     * @return `false` if queue is full.
+     */
+    bool tryPush(T&& value)
+    {
+        auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+        Cell* cell = nullptr;
+
+        while (true)
+        {
+            cell = &m_buffer[position & m_mask];
+
+            auto sequence   = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Cell from previous lap is not read yet
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for pushing copy of value.
+     * @param value Value.
+     * @return `false` if queue is full.
+     */
+    bool tryPush(const T& value)
+    {
+        return tryPush(T(value));
+    }
+
+    /**
+     * @brief Method for pushing several values. Values
+     * are moved from range.
+     * @tparam Iterator Input iterator type.
+     * @param first First value.
+     * @param last Iterator after last value.
+     * @return Number of pushed values from range begin.
+     */
+    template <typename Iterator>
+    std::size_t pushBatch(Iterator first, Iterator last)
+    {
+        std::size_t count = 0;
+
+        for (; first != last && tryPush(std::move(*first)); ++first)
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Method for popping value.
+     * @param result Popped value.
+     * @return `false` if queue is empty.
+     */
+    bool tryPop(T& result)
+    {
+        auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+        Cell* cell = nullptr;
+
+        while (true)
+        {
+            cell = &m_buffer[position & m_mask];
+
+            auto sequence   = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Cell is not written yet
+                return false;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        result = std::move(cell->value);
+        cell->sequence.store(position + m_capacity, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for popping several values.
+     * @tparam OutputIterator Output iterator type.
+     * @param output Output iterator.
+     * @param maximum Maximum number of values to pop.
+     * @return Number of popped values.
+     */
+    template <typename OutputIterator>
+    std::size_t popBatch(OutputIterator output, std::size_t maximum)
+    {
+        std::size_t count = 0;
+
+        T value;
+
+        for (; count < maximum && tryPop(value); ++output)
+        {
+            *output = std::move(value);
+            ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Method for getting approximate number of values.
+     */
+    [[nodiscard]] std::size_t sizeApprox() const
+    {
+        auto dequeuePosition = m_dequeuePosition.load(std::memory_order_acquire);
+        auto enqueuePosition = m_enqueuePosition.load(std::memory_order_acquire);
+
+        return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+    }
+
+    /**
+     * @brief Method for checking is queue empty.
+     * Result is approximate.
+     */
+    [[nodiscard]] bool isEmpty() const
+    {
+        return sizeApprox() == 0;
+    }
+
+protected:
+    struct Cell
+    {
+        std::atomic_size_t sequence;
+        T value;
+    };
+
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_buffer;
+
+    alignas(CacheLineSize) std::atomic_size_t m_enqueuePosition;
+    alignas(CacheLineSize) std::atomic_size_t m_dequeuePosition;
+};
+} // namespace HG::Utils::LockFree
@@ -0,0 +1,78 @@
+#pragma once
+
+// HG::Utils
+#include <HG/Utils/LockFree/MPMCQueue.hpp>
+
+namespace HG::Utils::LockFree
+{
+/**
+ * @brief Class, that describes bounded lock free queue
+ * for multiple producer and single consumer threads.
+ * Producer side is the same as in HG::Utils::LockFree::MPMCQueue,
+ * but consumer doesn't have to compete for dequeue index,
+ * so popping is wait free.
+ * @tparam T Value type. Has to be default constructible
+ * and move assignable.
+ */
+template <typename T>
+class MPSCQueue : public MPMCQueue<T>
+{
+public:
+    /**
+     * @brief Constructor.
+     * Can throw `std::invalid_argument` if capacity is 0.
+     * @param capacity Queue capacity. It's rounded up
+     * to power of 2.
+     */
+    explicit MPSCQueue(std::size_t capacity) : MPMCQueue<T>(capacity)
+    {
+    }
+
+    /**
+     * @brief Method for popping value. Only for consumer thread.
+     * @param result Popped value.
+     * @return `false` if queue is empty.
+     */
+    bool tryPop(T& result)
+    {
+        auto position = this->m_dequeuePosition.load(std::memory_order_relaxed);
+        auto& cell    = this->m_buffer[position & this->m_mask];
+
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+        {
+            return false;
+        }
+
+        result = std::move(cell.value);
+
+        this->m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+        cell.sequence.store(position + this->m_capacity, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for popping several values.
+     * Only for consumer thread.
+     * @tparam OutputIterator Output iterator type.
+     * @param output Output iterator.
+     * @param maximum Maximum number of values to pop.
+     * @return Number of popped values.
+     */
+    template <typename OutputIterator>
+    std::size_t popBatch(OutputIterator output, std::size_t maximum)
+    {
+        std::size_t count = 0;
+
+        T value;
+
+        for (; count < maximum && tryPop(value); ++output)
+        {
+            *output = std::move(value);
+            ++count;
+        }
+
+        return count;
+    }
+};
+} // namespace HG::Utils::LockFree
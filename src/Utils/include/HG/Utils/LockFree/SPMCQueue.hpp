@@ -1,6 +1,7 @@
 #pragma once
 
 // STL
+#include <atomic>
 #include <cstdint>
 
 namespace HG::Utils::LockFree
@@ -28,7 +29,8 @@ public:
     { // only for single producer
         auto last = m_last.load(std::memory_order_relaxed);
         auto next = inc(last);
-        if (next != m_first.load(std::memory_order_acquire))
+        // Queue is full
+        if (next == m_first.load(std::memory_order_acquire))
         {
             return false;
         }
@@ -0,0 +1,215 @@
+#pragma once
+
+// C++ STL
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+
+// HG::Utils
+#include <HG/Utils/LockFree/Common.hpp>
+
+namespace HG::Utils::LockFree
+{
+/**
+ * @brief Class, that describes bounded lock free queue
+ * for single producer and single consumer threads.
+ * Every side caches index of other side, so shared
+ * indices are touched only if queue looks full or empty.
+ * @tparam T Value type. Has to be default constructible
+ * and move assignable.
+ */
+template <typename T>
+class SPSCQueue
+{
+public:
+    using ValueType = T;
+
+    /**
+     * @brief Constructor.
+     * Can throw `std::invalid_argument` if capacity is 0.
+     * @param capacity Queue capacity. It's rounded up
+     * to power of 2.
+     */
+    explicit SPSCQueue(std::size_t capacity) :
+        m_capacity(ringCapacity(capacity)),
+        m_mask(m_capacity - 1),
+        m_buffer(new T[m_capacity]()),
+        m_head(0),
+        m_cachedTail(0),
+        m_tail(0),
+        m_cachedHead(0)
+    {
+    }
+
+    // Disable copying
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * @brief Method for getting queue capacity.
+     */
+    [[nodiscard]] std::size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Method for pushing value. Only for producer thread.
+     * @param value Value.
+     * @return `false` if queue is full.
+     */
+    bool tryPush(T&& value)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_cachedHead == m_capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+
+            if (tail - m_cachedHead == m_capacity)
+            {
+                return false;
+            }
+        }
+
+        m_buffer[tail & m_mask] = std::move(value);
+
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for pushing copy of value.
+     * Only for producer thread.
+     * @param value Value.
+     * @return `false` if queue is full.
+     */
+    bool tryPush(const T& value)
+    {
+        return tryPush(T(value));
+    }
+
+    /**
+     * @brief Method for pushing several values with one
+     * index update. Values are moved from range.
+     * Only for producer thread.
+     * @tparam Iterator Input iterator type.
+     * @param first First value.
+     * @param last Iterator after last value.
+     * @return Number of pushed values from range begin.
+     */
+    template <typename Iterator>
+    std::size_t pushBatch(Iterator first, Iterator last)
+    {
+        auto tail  = m_tail.load(std::memory_order_relaxed);
+        auto count = static_cast<std::size_t>(std::distance(first, last));
+
+        if (m_capacity - (tail - m_cachedHead) < count)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        count = std::min(count, m_capacity - (tail - m_cachedHead));
+
+        for (std::size_t index = 0; index < count; ++index, ++first)
+        {
+            m_buffer[(tail + index) & m_mask] = std::move(*first);
+        }
+
+        m_tail.store(tail + count, std::memory_order_release);
+
+        return count;
+    }
+
+    /**
+     * @brief Method for popping value. Only for consumer thread.
+     * @param result Popped value.
+     * @return `false` if queue is empty.
+     */
+    bool tryPop(T& result)
+    {
+        auto head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+            if (head == m_cachedTail)
+            {
+                return false;
+            }
+        }
+
+        result = std::move(m_buffer[head & m_mask]);
+
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Method for popping several values with one
+     * index update. Only for consumer thread.
+     * @tparam OutputIterator Output iterator type.
+     * @param output Output iterator.
+     * @param maximum Maximum number of values to pop.
+     * @return Number of popped values.
+     */
+    template <typename OutputIterator>
+    std::size_t popBatch(OutputIterator output, std::size_t maximum)
+    {
+        auto head = m_head.load(std::memory_order_relaxed);
+
+        if (m_cachedTail - head < maximum)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+
+        auto count = std::min(maximum, m_cachedTail - head);
+
+        for (std::size_t index = 0; index < count; ++index, ++output)
+        {
+            *output = std::move(m_buffer[(head + index) & m_mask]);
+        }
+
+        m_head.store(head + count, std::memory_order_release);
+
+        return count;
+    }
+
+    /**
+     * @brief Method for getting approximate number of values.
+     */
+    [[nodiscard]] std::size_t sizeApprox() const
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        auto tail = m_tail.load(std::memory_order_acquire);
+
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * @brief Method for checking is queue empty. Result is
+     * exact only in consumer thread.
+     */
+    [[nodiscard]] bool isEmpty() const
+    {
+        return sizeApprox() == 0;
+    }
+
+private:
+    const std::size_t m_capacity;
+    const std::size_t m_mask;
+    std::unique_ptr<T[]> m_buffer;
+
+    // Consumer side
+    alignas(CacheLineSize) std::atomic_size_t m_head;
+    std::size_t m_cachedTail;
+
+    // Producer side
+    alignas(CacheLineSize) std::atomic_size_t m_tail;
+    std::size_t m_cachedHead;
+};
+} // namespace HG::Utils::LockFree
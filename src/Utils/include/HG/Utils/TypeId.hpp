@@ -0,0 +1,47 @@
+#pragma once
+
+// C++ STL
+#include <cstddef>
+
+namespace HG::Utils
+{
+/**
+ * @brief Class, that provides small sequential
+ * identifiers of types. Identifier is assigned on
+ * first request of type and doesn't change until
+ * program exit. Unlike `typeid(T).hash_code()`
+ * it's not calculated on every request, so it's
+ * suitable for hot lookups.
+ *
+ * Identifier is kept in function local static of
+ * template, so it's unique only within one module.
+ * Shared library, that's not exporting this template
+ * instantiation, gets it's own identifiers for same
+ * types. Identifiers must not be compared across
+ * shared library boundary.
+ */
+class TypeId
+{
+public:
+    /**
+     * @brief Method for getting identifier of type.
+     * Thread safe.
+     * @tparam T Type.
+     * @return Type identifier.
+     */
+    template <typename T>
+    [[nodiscard]] static std::size_t get()
+    {
+        static const std::size_t id = next();
+
+        return id;
+    }
+
+private:
+    /**
+     * @brief Method for getting next
+     * unused identifier.
+     */
+    static std::size_t next();
+};
+} // namespace HG::Utils
@@ -0,0 +1,51 @@
+// HG::Utils
+#include <HG/Utils/ContinuationQueue.hpp>
+#include <HG/Utils/Logging.hpp>
+
+namespace HG::Utils
+{
+ContinuationQueue::ContinuationQueue() : m_mutex(), m_continuations(), m_executing()
+{
+}
+
+void ContinuationQueue::push(ContinuationQueue::Continuation continuation)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_continuations.push_back(std::move(continuation));
+}
+
+std::size_t ContinuationQueue::execute()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        std::swap(m_continuations, m_executing);
+    }
+
+    for (auto&& continuation : m_executing)
+    {
+        try
+        {
+            continuation();
+        }
+        catch (std::exception& exception)
+        {
+            HGError("Continuation received exception: {}", exception.what());
+        }
+    }
+
+    auto numberOfExecuted = m_executing.size();
+
+    m_executing.clear();
+
+    return numberOfExecuted;
+}
+
+std::size_t ContinuationQueue::size() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    return m_continuations.size();
+}
+} // namespace HG::Utils
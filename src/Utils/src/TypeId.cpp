@@ -0,0 +1,15 @@
+// C++ STL
+#include <atomic>
+
+// HG::Utils
+#include <HG/Utils/TypeId.hpp>
+
+namespace HG::Utils
+{
+std::size_t TypeId::next()
+{
+    static std::atomic<std::size_t> counter(0);
+
+    return counter++;
+}
+} // namespace HG::Utils
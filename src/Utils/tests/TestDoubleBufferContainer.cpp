@@ -1,3 +1,8 @@
+// C++ STL
+#include <chrono>
+#include <iostream>
+#include <numeric>
+
 // HG::Utils
 #include <HG/Utils/DoubleBufferContainer.hpp>
 
@@ -116,7 +121,7 @@ TEST(Utils, DoubleBufferContainerConstructorsMove)
     ASSERT_EQ(data.removable().size(), 1);
     ASSERT_EQ(data.added().size(), 2);
 
-    ASSERT_EQ(copied, 0);
+    ASSERT_EQ(copied, 6); // State table keeps copy of every element
     ASSERT_EQ(moved, 15); // todo: Too many I guess, but it's ok for now
     ASSERT_EQ(constructed, 6);
 
@@ -238,3 +243,133 @@ TEST(Utils, DoubleBufferContainerMultipleRemoving)
     ASSERT_EQ(data.removable().size(), 0);
     ASSERT_EQ(data.added().size(), 0);
 }
+
+TEST(Utils, DoubleBufferContainerStableOrder)
+{
+    HG::Utils::DoubleBufferContainer<std::size_t> data;
+
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        data.add(i);
+    }
+
+    data.merge();
+
+    data.remove(1);
+    data.remove(5);
+    data.remove(9);
+    data.add(10);
+    data.add(11);
+    data.remove(11);
+
+    ASSERT_TRUE(data.isRemoving(5));
+    ASSERT_TRUE(data.isRemoving(11));
+    ASSERT_FALSE(data.isRemoving(10));
+
+    data.merge();
+
+    std::vector<std::size_t> expected = {0, 2, 3, 4, 6, 7, 8, 10};
+    std::vector<std::size_t> actual(data.begin(), data.end());
+
+    ASSERT_EQ(expected, actual);
+    ASSERT_FALSE(data.isRemoving(5));
+
+    // Removed element can be added again
+    data.add(5);
+    data.merge();
+
+    ASSERT_EQ(data.size(), 9);
+    ASSERT_EQ(data[8], 5);
+
+    // Cleared state doesn't affect next merge
+    data.add(20);
+    data.remove(0);
+    data.clearState();
+    data.merge();
+
+    ASSERT_EQ(data.size(), 9);
+    ASSERT_EQ(data[0], 0);
+}
+
+TEST(Utils, DoubleBufferContainerMergeRemovable)
+{
+    HG::Utils::DoubleBufferContainer<std::size_t> data;
+
+    data.add(1);
+    data.add(2);
+    data.add(3);
+    data.merge();
+
+    data.remove(2);
+    data.add(4);
+    data.add(5);
+    data.remove(5);
+
+    data.mergeRemovable();
+
+    std::vector<std::size_t> expected = {1, 3};
+    std::vector<std::size_t> actual(data.begin(), data.end());
+
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(data.removable().size(), 0);
+    ASSERT_EQ(data.added(), std::vector<std::size_t>{4});
+    ASSERT_FALSE(data.isRemoving(2));
+
+    // Removed element can be added again before merge
+    data.add(2);
+    data.merge();
+
+    expected = {1, 3, 4, 2};
+    actual.assign(data.begin(), data.end());
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(Utils, DISABLED_DoubleBufferContainerChurnBenchmark)
+{
+    constexpr std::size_t numberOfElements = 100000;
+    constexpr std::size_t numberOfFrames   = 20;
+
+    HG::Utils::DoubleBufferContainer<std::size_t> data;
+
+    for (std::size_t i = 0; i < numberOfElements; ++i)
+    {
+        data.add(i);
+    }
+
+    data.merge();
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::size_t nextElement = numberOfElements;
+    std::size_t removing    = 0;
+
+    // Every frame tenth of elements is replaced
+    for (std::size_t frame = 0; frame < numberOfFrames; ++frame)
+    {
+        for (std::size_t i = frame % 10; i < data.size(); i += 10)
+        {
+            data.remove(data[static_cast<int>(i)]);
+            data.add(nextElement++);
+        }
+
+        for (auto&& element : data)
+        {
+            removing += data.isRemoving(element) ? 1 : 0;
+        }
+
+        data.merge();
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "DoubleBufferContainer churn (" << numberOfElements << " elements, " << numberOfFrames
+              << " frames): " << duration.count() / 1000.0 << " ms, " << duration.count() / numberOfFrames / 1000.0
+              << " ms per frame" << std::endl;
+
+    ASSERT_EQ(data.size(), numberOfElements);
+    ASSERT_EQ(removing, numberOfElements / 10 * numberOfFrames);
+
+    // Left elements keep their order
+    ASSERT_TRUE(std::is_sorted(data.begin(), data.end()));
+}
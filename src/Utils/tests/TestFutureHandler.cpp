@@ -1,7 +1,10 @@
 // C++ STL
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 // HG::Utils
+#include <HG/Utils/ContinuationQueue.hpp>
 #include <HG/Utils/FutureHandler.hpp>
 
 // GTest
@@ -26,26 +29,26 @@ struct Object
 };
 
 template <typename T>
-std::shared_future<Object*> getSharedFuture(T sleep_for, Object* result_value)
+HG::Utils::FutureHandler<Object*> getFutureHandler(T sleep_for, Object* result_value)
 {
-    auto promise = std::make_shared<std::promise<Object*>>();
-    std::shared_future<Object*> future(promise->get_future());
+    HG::Utils::Promise<Object*> promise;
+    auto handler = promise.handler();
 
-    std::thread thread([promise, sleep_for, result_value]() {
+    std::thread thread([promise = std::move(promise), sleep_for, result_value]() mutable {
         std::this_thread::sleep_for(sleep_for);
 
-        promise->set_value(result_value);
+        promise.setValue(result_value);
     });
 
     thread.detach();
 
-    return future;
+    return handler;
 }
 
 TEST(Utils, FutureHandler)
 {
     Object expected = 0xDEAD;
-    HG::Utils::FutureHandler futureHandler(getSharedFuture(std::chrono::seconds(1), &expected));
+    HG::Utils::FutureHandler futureHandler(getFutureHandler(std::chrono::seconds(1), &expected));
 
     HG::Utils::FutureHandler copy = futureHandler;
 
@@ -64,3 +67,128 @@ TEST(Utils, FutureHandlerPredefined)
     ASSERT_EQ(predefined.get(), 12);
     ASSERT_EQ(predefined.guaranteeGet(), 12);
 }
+
+TEST(Utils, FutureHandlerThen)
+{
+    HG::Utils::Promise<int> promise;
+
+    auto result = promise.handler().then([](int value) { return value * 2; }).then([](int value) {
+        return std::to_string(value);
+    });
+
+    ASSERT_FALSE(result.isReady());
+
+    promise.setValue(21);
+
+    ASSERT_TRUE(result.isReady());
+    ASSERT_EQ(result.get(), "42");
+
+    // Continuation of ready handler is executed immediately
+    int executed = 0;
+
+    HG::Utils::FutureHandler<int>(12).then([&executed](int value) { executed = value; });
+
+    ASSERT_EQ(executed, 12);
+}
+
+TEST(Utils, FutureHandlerThenQueue)
+{
+    HG::Utils::ContinuationQueue queue;
+    HG::Utils::Promise<int> promise;
+
+    auto executedOn = std::this_thread::get_id();
+
+    auto result = promise.handler().then(
+        [&executedOn](int value) {
+            executedOn = std::this_thread::get_id();
+            return value + 1;
+        },
+        &queue);
+
+    std::thread thread([&promise]() { promise.setValue(1); });
+    thread.join();
+
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_FALSE(result.isReady());
+
+    ASSERT_EQ(queue.execute(), 1);
+
+    ASSERT_EQ(executedOn, std::this_thread::get_id());
+    ASSERT_EQ(result.get(), 2);
+}
+
+TEST(Utils, FutureHandlerException)
+{
+    HG::Utils::Promise<int> promise;
+
+    bool executed = false;
+
+    auto result = promise.handler().then([](int) -> int { throw std::runtime_error("Failed"); }).then(
+        [&executed](int value) {
+            executed = true;
+            return value;
+        });
+
+    promise.setValue(1);
+
+    ASSERT_THROW(result.guaranteeGet(), std::runtime_error);
+    ASSERT_FALSE(executed);
+
+    HG::Utils::FutureHandler<int> broken(0);
+
+    {
+        HG::Utils::Promise<int> abandoned;
+        broken = abandoned.handler();
+    }
+
+    ASSERT_THROW(broken.guaranteeGet(), std::runtime_error);
+}
+
+TEST(Utils, FutureHandlerWhenAll)
+{
+    std::vector<HG::Utils::Promise<int>> promises(3);
+    std::vector<HG::Utils::FutureHandler<int>> handlers;
+
+    for (auto&& promise : promises)
+    {
+        handlers.push_back(promise.handler());
+    }
+
+    handlers.emplace_back(4);
+
+    auto result = HG::Utils::whenAll(handlers);
+
+    promises[2].setValue(3);
+    promises[0].setValue(1);
+
+    ASSERT_FALSE(result.isReady());
+
+    promises[1].setValue(2);
+
+    ASSERT_TRUE(result.isReady());
+    ASSERT_EQ(result.get(), std::vector<int>({1, 2, 3, 4}));
+
+    ASSERT_TRUE(HG::Utils::whenAll(std::vector<HG::Utils::FutureHandler<int>>()).isReady());
+}
+
+TEST(Utils, FutureHandlerWhenAny)
+{
+    std::vector<HG::Utils::Promise<int>> promises(3);
+    std::vector<HG::Utils::FutureHandler<int>> handlers;
+
+    for (auto&& promise : promises)
+    {
+        handlers.push_back(promise.handler());
+    }
+
+    auto result = HG::Utils::whenAny(handlers);
+
+    ASSERT_FALSE(result.isReady());
+
+    promises[1].setValue(2);
+    promises[0].setValue(1);
+
+    ASSERT_EQ(result.get(), 1);
+
+    ASSERT_THROW(HG::Utils::whenAny(std::vector<HG::Utils::FutureHandler<int>>()), std::invalid_argument);
+}
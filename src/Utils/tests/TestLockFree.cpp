@@ -0,0 +1,362 @@
+// C++ STL
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// HG::Utils
+#include <HG/Utils/LockFree/BlockingQueue.hpp>
+#include <HG/Utils/LockFree/MPMCQueue.hpp>
+#include <HG/Utils/LockFree/MPSCQueue.hpp>
+#include <HG/Utils/LockFree/SPMCQueue.hpp>
+#include <HG/Utils/LockFree/SPSCQueue.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+namespace
+{
+/**
+ * @brief Function for pushing values [0, numberOfValues) from
+ * every producer and checking, that every value was popped
+ * by consumers exactly once and in producer order.
+ */
+template <typename QueueType>
+void stress(QueueType& queue, std::size_t numberOfProducers, std::size_t numberOfConsumers, std::size_t numberOfValues)
+{
+    std::vector<std::atomic_size_t> received(numberOfProducers * numberOfValues);
+    std::atomic_size_t numberOfReceived = 0;
+    std::atomic_bool orderViolated      = false;
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t producer = 0; producer < numberOfProducers; ++producer)
+    {
+        threads.emplace_back([&queue, producer, numberOfValues]() {
+            for (std::size_t value = 0; value < numberOfValues; ++value)
+            {
+                while (!queue.tryPush(producer * numberOfValues + value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    auto total = numberOfProducers * numberOfValues;
+
+    for (std::size_t consumer = 0; consumer < numberOfConsumers; ++consumer)
+    {
+        threads.emplace_back([&, numberOfProducers]() {
+            // Last value, received from every producer
+            std::vector<std::size_t> last(numberOfProducers, 0);
+            std::vector<bool> hasLast(numberOfProducers, false);
+
+            std::size_t value;
+
+            while (numberOfReceived < total)
+            {
+                if (!queue.tryPop(value))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                auto producer = value / numberOfValues;
+
+                if (hasLast[producer] && last[producer] >= value)
+                {
+                    orderViolated = true;
+                }
+
+                last[producer]    = value;
+                hasLast[producer] = true;
+
+                ++received[value];
+                ++numberOfReceived;
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(orderViolated);
+
+    for (auto&& counter : received)
+    {
+        ASSERT_EQ(counter, 1);
+    }
+}
+
+/**
+ * @brief Function for measuring time of passing values
+ * from producers to consumers.
+ */
+template <typename QueueType>
+void benchmark(const char* name, QueueType& queue, std::size_t numberOfProducers, std::size_t numberOfConsumers)
+{
+    constexpr std::size_t numberOfValues = 1000000;
+
+    auto start = std::chrono::steady_clock::now();
+
+    stress(queue, numberOfProducers, numberOfConsumers, numberOfValues / numberOfProducers);
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << name << " (" << numberOfProducers << "P/" << numberOfConsumers << "C): " << duration.count() / 1000.0
+              << " ms, " << duration.count() * 1000.0 / numberOfValues << " ns per value" << std::endl;
+}
+
+/**
+ * @brief Mutex guarded queue for benchmarks comparison.
+ */
+class MutexQueue
+{
+public:
+    explicit MutexQueue(std::size_t capacity) : m_capacity(capacity), m_mutex(), m_queue()
+    {
+    }
+
+    bool tryPush(std::size_t value)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_queue.size() == m_capacity)
+        {
+            return false;
+        }
+
+        m_queue.push(value);
+
+        return true;
+    }
+
+    bool tryPop(std::size_t& value)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_queue.empty())
+        {
+            return false;
+        }
+
+        value = m_queue.front();
+        m_queue.pop();
+
+        return true;
+    }
+
+private:
+    std::size_t m_capacity;
+    std::mutex m_mutex;
+    std::queue<std::size_t> m_queue;
+};
+} // namespace
+
+TEST(Utils, LockFreeCapacity)
+{
+    HG::Utils::LockFree::SPSCQueue<int> spsc(100);
+    HG::Utils::LockFree::MPMCQueue<int> mpmc(64);
+
+    ASSERT_EQ(spsc.capacity(), 128);
+    ASSERT_EQ(mpmc.capacity(), 64);
+
+    ASSERT_THROW(HG::Utils::LockFree::MPSCQueue<int>(0), std::invalid_argument);
+
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_TRUE(mpmc.tryPush(i));
+    }
+
+    ASSERT_FALSE(mpmc.tryPush(64));
+    ASSERT_EQ(mpmc.sizeApprox(), 64);
+
+    int value;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_TRUE(mpmc.tryPop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_FALSE(mpmc.tryPop(value));
+    ASSERT_TRUE(mpmc.isEmpty());
+}
+
+TEST(Utils, LockFreeSPMCQueue)
+{
+    HG::Utils::LockFree::SPMCQueue<int> queue(4);
+
+    // One cell is always free
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    ASSERT_TRUE(queue.push(3));
+    ASSERT_FALSE(queue.push(4));
+
+    int value;
+
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 1);
+
+    queue.pop(value);
+    ASSERT_EQ(value, 2);
+
+    ASSERT_TRUE(queue.push(5));
+
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 5);
+
+    ASSERT_TRUE(queue.isEmpty());
+    ASSERT_FALSE(queue.tryPop(value));
+}
+
+TEST(Utils, LockFreeBatch)
+{
+    HG::Utils::LockFree::SPSCQueue<std::unique_ptr<int>> queue(8);
+
+    std::vector<std::unique_ptr<int>> values;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        values.push_back(std::make_unique<int>(i));
+    }
+
+    ASSERT_EQ(queue.pushBatch(values.begin(), values.end()), 8);
+    ASSERT_EQ(values[7], nullptr);
+    ASSERT_NE(values[8], nullptr);
+
+    std::vector<std::unique_ptr<int>> result;
+
+    ASSERT_EQ(queue.popBatch(std::back_inserter(result), 5), 5);
+    ASSERT_EQ(queue.pushBatch(values.begin() + 8, values.end()), 2);
+    ASSERT_EQ(queue.popBatch(std::back_inserter(result), 100), 5);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(*result[i], i);
+    }
+
+    HG::Utils::LockFree::MPSCQueue<int> mpsc(4);
+
+    std::vector<int> input = {1, 2, 3, 4, 5};
+    std::vector<int> output;
+
+    ASSERT_EQ(mpsc.pushBatch(input.begin(), input.end()), 4);
+    ASSERT_EQ(mpsc.popBatch(std::back_inserter(output), 10), 4);
+    ASSERT_EQ(output, std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(Utils, LockFreeSPSCStress)
+{
+    HG::Utils::LockFree::SPSCQueue<std::size_t> queue(64);
+
+    stress(queue, 1, 1, 100000);
+}
+
+TEST(Utils, LockFreeMPSCStress)
+{
+    HG::Utils::LockFree::MPSCQueue<std::size_t> queue(64);
+
+    stress(queue, 4, 1, 25000);
+}
+
+TEST(Utils, LockFreeMPMCStress)
+{
+    HG::Utils::LockFree::MPMCQueue<std::size_t> queue(64);
+
+    stress(queue, 4, 4, 25000);
+}
+
+TEST(Utils, LockFreeBlockingQueue)
+{
+    HG::Utils::LockFree::BlockingQueue<HG::Utils::LockFree::MPMCQueue<std::size_t>> queue(4);
+
+    constexpr std::size_t numberOfValues = 10000;
+
+    std::size_t value = 0;
+
+    ASSERT_FALSE(queue.popFor(value, std::chrono::milliseconds(1)));
+
+    std::atomic_size_t sum = 0;
+
+    std::vector<std::thread> consumers;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        consumers.emplace_back([&queue, &sum]() {
+            std::size_t value;
+
+            while (true)
+            {
+                queue.pop(value);
+
+                if (value == 0)
+                {
+                    return;
+                }
+
+                sum += value;
+            }
+        });
+    }
+
+    // Producer is blocked, while queue is full
+    for (std::size_t i = 1; i <= numberOfValues; ++i)
+    {
+        queue.push(i);
+    }
+
+    // Stopping consumers
+    queue.push(0);
+    queue.push(0);
+
+    for (auto&& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    ASSERT_EQ(sum, numberOfValues * (numberOfValues + 1) / 2);
+}
+
+TEST(Utils, DISABLED_LockFreeBenchmark)
+{
+    {
+        MutexQueue queue(1024);
+        benchmark("std::queue with mutex", queue, 1, 1);
+    }
+
+    {
+        HG::Utils::LockFree::SPSCQueue<std::size_t> queue(1024);
+        benchmark("SPSCQueue", queue, 1, 1);
+    }
+
+    {
+        MutexQueue queue(1024);
+        benchmark("std::queue with mutex", queue, 4, 1);
+    }
+
+    {
+        HG::Utils::LockFree::MPSCQueue<std::size_t> queue(1024);
+        benchmark("MPSCQueue", queue, 4, 1);
+    }
+
+    {
+        MutexQueue queue(1024);
+        benchmark("std::queue with mutex", queue, 4, 4);
+    }
+
+    {
+        HG::Utils::LockFree::MPMCQueue<std::size_t> queue(1024);
+        benchmark("MPMCQueue", queue, 4, 4);
+    }
+}